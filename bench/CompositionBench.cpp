@@ -0,0 +1,174 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "ChemicalComposition.h"
+#include "FlatChemicalComposition.h"
+
+using namespace ChemToolkit::Generic;
+
+
+using size_type = std::size_t;
+using MapChemicalComposition = ChemicalComposition<AtomicNumber>;
+
+
+// Small species and count ranges, so that equal compositions built in different insertion orders occur often.
+std::vector<std::vector<std::pair<AtomicNumber, size_type>>> createRandomRecipes(const size_type numRecipes, const unsigned short maxAtomicNumber, const size_type maxNumAdds, std::mt19937& randomEngine)
+{
+	std::uniform_int_distribution<unsigned short> atomicNumberDistribution{ 1, maxAtomicNumber };
+	std::uniform_int_distribution<size_type> numAddsDistribution{ 1, maxNumAdds };
+	std::uniform_int_distribution<size_type> countDistribution{ 1, 3 };
+
+	std::vector<std::vector<std::pair<AtomicNumber, size_type>>> recipes(numRecipes);
+	{
+		for (auto& recipe : recipes)
+		{
+			const size_type numAdds = numAddsDistribution(randomEngine);
+
+			for (size_type index = 0; index < numAdds; ++index)
+				recipe.emplace_back(AtomicNumber{ atomicNumberDistribution(randomEngine) }, countDistribution(randomEngine));
+		}
+	}
+
+	return recipes;
+}
+
+template <typename C>
+std::vector<C> createCompositions(const std::vector<std::vector<std::pair<AtomicNumber, size_type>>>& recipes)
+{
+	std::vector<C> compositions(recipes.size());
+	{
+		for (size_type index = 0; index < recipes.size(); ++index)
+		{
+			for (const auto& numAndCount : recipes[index])
+				compositions[index].add(numAndCount.first, numAndCount.second);
+		}
+	}
+
+	return compositions;
+}
+
+size_type countMismatches(const std::vector<MapChemicalComposition>& mapCompositions, const std::vector<FlatChemicalComposition>& flatCompositions)
+{
+	size_type numMismatches = 0;
+
+	for (size_type formerIndex = 0; formerIndex < mapCompositions.size(); ++formerIndex)
+	{
+		if (!(flatCompositions[formerIndex].toChemicalComposition() == mapCompositions[formerIndex]) || !(flatCompositions[formerIndex].count() == mapCompositions[formerIndex].count()))
+			++numMismatches;
+
+
+		for (size_type latterIndex = 0; latterIndex < mapCompositions.size(); ++latterIndex)
+		{
+			const MapChemicalComposition& mapFormer = mapCompositions[formerIndex];
+			const MapChemicalComposition& mapLatter = mapCompositions[latterIndex];
+			const FlatChemicalComposition& flatFormer = flatCompositions[formerIndex];
+			const FlatChemicalComposition& flatLatter = flatCompositions[latterIndex];
+
+			if (!((mapFormer < mapLatter) == (flatFormer < flatLatter)))
+				++numMismatches;
+			else if (!((mapFormer == mapLatter) == (flatFormer == flatLatter)))
+				++numMismatches;
+			else if ((flatFormer == flatLatter) && !(FlatChemicalComposition::Hasher{}(flatFormer) == FlatChemicalComposition::Hasher{}(flatLatter)))
+				++numMismatches;
+		}
+	}
+
+	return numMismatches;
+}
+
+template <typename F>
+double measureMicroseconds(const size_type numRepetitions, const F& function, size_type& checksum)
+{
+	const auto startTime = std::chrono::steady_clock::now();
+
+	for (size_type rep = 0; rep < numRepetitions; ++rep)
+		checksum += function();
+
+	return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count() / numRepetitions;
+}
+
+template <typename C>
+size_type runSetOperations(const std::vector<C>& compositions)
+{
+	std::set<C> compositionSet{ compositions.begin(), compositions.end() };
+	size_type numFound = 0;
+
+	for (const auto& composition : compositions)
+	{
+		if (!(compositionSet.find(composition) == compositionSet.end()))
+			++numFound;
+	}
+
+	return (compositionSet.size() + numFound);
+}
+
+template <typename C>
+size_type runLookupTable(const std::vector<C>& compositions)
+{
+	std::unordered_map<C, size_type, typename C::Hasher> compositionTable;
+	size_type numFound = 0;
+
+	for (size_type index = 0; index < compositions.size(); ++index)
+		compositionTable.emplace(compositions[index], index);
+
+	for (const auto& composition : compositions)
+	{
+		if (!(compositionTable.find(composition) == compositionTable.end()))
+			++numFound;
+	}
+
+	return (compositionTable.size() + numFound);
+}
+
+
+int main()
+{
+	std::mt19937 randomEngine{ 20260418 };
+	size_type numMismatches = 0;
+
+	{
+		const auto recipes = createRandomRecipes(2000, 4, 6, randomEngine);
+		numMismatches += countMismatches(createCompositions<MapChemicalComposition>(recipes), createCompositions<FlatChemicalComposition>(recipes));
+	}
+
+	// More species than the inline capacity, so that most compositions spill to the heap.
+	{
+		const auto recipes = createRandomRecipes(500, 60, 40, randomEngine);
+		numMismatches += countMismatches(createCompositions<MapChemicalComposition>(recipes), createCompositions<FlatChemicalComposition>(recipes));
+	}
+
+	std::cout << "Equivalence against ChemicalComposition: " << numMismatches << " mismatches" << std::endl;
+
+
+	std::cout << std::setw(14) << "compositions" << std::setw(18) << "set map [us]" << std::setw(18) << "set flat [us]" << std::setw(18) << "table map [us]" << std::setw(18) << "table flat [us]" << std::endl;
+
+	for (const size_type numCompositions : { 100, 1000, 10000 })
+	{
+		const auto recipes = createRandomRecipes(numCompositions, 20, 6, randomEngine);
+		const std::vector<MapChemicalComposition> mapCompositions = createCompositions<MapChemicalComposition>(recipes);
+		const std::vector<FlatChemicalComposition> flatCompositions = createCompositions<FlatChemicalComposition>(recipes);
+
+		const size_type numRepetitions = 200000 / numCompositions;
+
+		size_type mapChecksum = 0;
+		size_type flatChecksum = 0;
+
+		const double mapSetTime = measureMicroseconds(numRepetitions, [&]() { return runSetOperations(mapCompositions); }, mapChecksum);
+		const double flatSetTime = measureMicroseconds(numRepetitions, [&]() { return runSetOperations(flatCompositions); }, flatChecksum);
+		const double mapTableTime = measureMicroseconds(numRepetitions, [&]() { return runLookupTable(mapCompositions); }, mapChecksum);
+		const double flatTableTime = measureMicroseconds(numRepetitions, [&]() { return runLookupTable(flatCompositions); }, flatChecksum);
+
+		if (!(mapChecksum == flatChecksum))
+			++numMismatches;
+
+		std::cout << std::setw(14) << numCompositions << std::fixed << std::setprecision(2) << std::setw(18) << mapSetTime << std::setw(18) << flatSetTime << std::setw(18) << mapTableTime << std::setw(18) << flatTableTime << std::endl;
+	}
+
+	return ((numMismatches == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,300 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "AtomicRadiusDictionary.h"
+#include "LengthCasting.h"
+#include "StreamReader.h"
+
+#include "ConstrainingAtomicSpecies.h"
+#include "ConstrainingCrystalStructure.h"
+#include "ObjectiveCrystalStructure.h"
+
+using namespace MathematicalCrystalChemistry::CrystalModel::Components;
+
+
+using size_type = std::size_t;
+using OriginalAtomIndex = ChemToolkit::Crystallography::OriginalAtomIndex;
+using TranslatedAtomIndex = ChemToolkit::Crystallography::TranslatedAtomIndex;
+using IonicAtomicNumber = ChemToolkit::Generic::IonicAtomicNumber;
+using NumericalVector = MathToolkit::LinearAlgebra::NumericalVector<double, 3>;
+using CoordinationConstraintsHandle = std::shared_ptr<const MathematicalCrystalChemistry::CrystalModel::Constraints::CoordinationConstraints>;
+
+
+// Covalent (min, max), ionic (min, max) and ionic repulsion (min) radii in angstrom, close to the tabulated values.
+void initializeAtomicRadii()
+{
+	MathematicalCrystalChemistry::CrystalModel::Constraints::AtomicRadiusDictionary::initialize(System::IO::StreamReader{ std::vector<std::string>{ "Na+ 1.40 1.70 0.95 1.16 0.90", "Cl- 0.90 1.10 1.67 1.81 1.40" } });
+}
+
+// Builds an nx * ny * nz simple cubic grid of alternating Na+ and Cl-, ionically bonded to nearest neighbours of opposite charge.
+// An odd extent leaves like-charged neighbours across the cell boundary, so repulsion and exclusion arrays are populated as well.
+ConstrainingCrystalStructure createGridStructure(const short nx, const short ny, const short nz)
+{
+	using namespace MathToolkit::UnitConversion::LengthCasting;
+	const double spacing = cast<Unit::Angstrom, Unit::AtomicUnit>(2.8);
+
+	ChemToolkit::Crystallography::UnitCell unitCell;
+	{
+		unitCell.basisVectors()(0, 0) = nx * spacing;
+		unitCell.basisVectors()(1, 1) = ny * spacing;
+		unitCell.basisVectors()(2, 2) = nz * spacing;
+	}
+
+	const ConstrainingAtomicSpecies cationSpecies{ IonicAtomicNumber{ ChemToolkit::Generic::AtomicNumber{ 11 }, ChemToolkit::Generic::FormalCharge{ 1 } } };
+	const ConstrainingAtomicSpecies anionSpecies{ IonicAtomicNumber{ ChemToolkit::Generic::AtomicNumber{ 17 }, ChemToolkit::Generic::FormalCharge{ -1 } } };
+
+	std::vector<SphericalAtom> atoms;
+	std::vector<IonicAtomicNumber> ionicAtomicNumbers;
+	std::vector<CoordinationConstraintsHandle> coordinationConstraints;
+	std::vector<std::array<short, 3>> gridPoints;
+	{
+		for (short x = 0; x < nx; ++x)
+		{
+			for (short y = 0; y < ny; ++y)
+			{
+				for (short z = 0; z < nz; ++z)
+				{
+					const ConstrainingAtomicSpecies& species = (((x + y + z) % 2 == 0) ? cationSpecies : anionSpecies);
+
+					atoms.push_back(SphericalAtom{ species.ionicAtomicNumber().atomicNumber(), species.ionicAtomicNumber().formalCharge(), NumericalVector{ x * spacing, y * spacing, z * spacing } });
+					ionicAtomicNumbers.push_back(species.ionicAtomicNumber());
+					coordinationConstraints.push_back(species.coordinationConstraintsHandle());
+					gridPoints.push_back(std::array<short, 3>{ x, y, z });
+				}
+			}
+		}
+	}
+
+
+	std::vector<ConstrainerIndices<OriginalAtomIndex>> ionicBondedIndices;
+	std::vector<ConstrainerIndices<TranslatedAtomIndex>> translatedIonicBondedIndices;
+	{
+		const std::array<short, 3> extents{ nx, ny, nz };
+
+		for (size_type index = 0; index < gridPoints.size(); ++index)
+		{
+			for (size_type axis = 0; axis < 3; ++axis)
+			{
+				std::array<short, 3> neighbor = gridPoints[index];
+				TranslatedAtomIndex::LatticePoint latticePoint{ 0, 0, 0 };
+				{
+					if (++neighbor[axis] == extents[axis])
+					{
+						neighbor[axis] = 0;
+						latticePoint[axis] = 1;
+					}
+				}
+
+				const OriginalAtomIndex neighborIndex = static_cast<OriginalAtomIndex>((neighbor[0] * ny + neighbor[1]) * nz + neighbor[2]);
+
+				if (ionicAtomicNumbers[index].formalCharge().isCation() == ionicAtomicNumbers[neighborIndex].formalCharge().isCation())
+					continue;
+				else if ((latticePoint[0] == 0) && (latticePoint[1] == 0) && (latticePoint[2] == 0))
+					ionicBondedIndices.push_back(ConstrainerIndices<OriginalAtomIndex>{ static_cast<OriginalAtomIndex>(index), neighborIndex });
+				else
+					translatedIonicBondedIndices.push_back(ConstrainerIndices<TranslatedAtomIndex>{ static_cast<OriginalAtomIndex>(index), TranslatedAtomIndex{ neighborIndex, latticePoint } });
+			}
+		}
+	}
+
+
+	ObjectiveCrystalStructure objectiveStructure{ unitCell, atoms, ionicAtomicNumbers, coordinationConstraints };
+	{
+		objectiveStructure.setIonicBondedIndices(std::move(ionicBondedIndices));
+		objectiveStructure.setTranslatedIonicBondedIndices(std::move(translatedIonicBondedIndices));
+	}
+
+	return ConstrainingCrystalStructure{ objectiveStructure };
+}
+
+// The all-pairs classification used before the neighbour list pass, kept here as the reference output.
+ObjectiveCrystalStructure createReferenceStructure(const ConstrainingCrystalStructure& structure)
+{
+	std::vector<SphericalAtom> atoms;
+	std::vector<IonicAtomicNumber> ionicAtomicNumbers;
+	std::vector<CoordinationConstraintsHandle> coordinationConstraints;
+	{
+		for (const auto& atom : structure.atoms())
+		{
+			atoms.push_back(SphericalAtom{ atom });
+			ionicAtomicNumbers.push_back(atom.ionicAtomicNumber());
+			coordinationConstraints.push_back(atom.coordinationConstraintsHandle());
+		}
+	}
+
+	std::vector<ConstrainerIndices<OriginalAtomIndex>> covalentBondedIndices;
+	std::vector<ConstrainerIndices<OriginalAtomIndex>> covalentExcludedIndices;
+	std::vector<ConstrainerIndices<OriginalAtomIndex>> ionicBondedIndices;
+	std::vector<ConstrainerIndices<OriginalAtomIndex>> ionicExcludedIndices;
+	std::vector<ConstrainerIndices<OriginalAtomIndex>> ionicRepulsedIndices;
+
+	for (size_type originalIndex = 0; originalIndex < structure.atoms().size(); ++originalIndex)
+	{
+		const ConstrainingAtom& constrainingAtom = structure.atoms()[originalIndex];
+
+
+		for (size_type translatedOriginalIndex = (1 + originalIndex); translatedOriginalIndex < structure.atoms().size(); ++translatedOriginalIndex)
+		{
+			const ConstrainerIndices<OriginalAtomIndex> indices{ static_cast<OriginalAtomIndex>(originalIndex), static_cast<OriginalAtomIndex>(translatedOriginalIndex) };
+
+			if (structure.isIonicAttractive(originalIndex, translatedOriginalIndex))
+			{
+				if (constrainingAtom.hasIonicBondWith(translatedOriginalIndex))
+					ionicBondedIndices.push_back(indices);
+				else if (structure.isConstrainableIonicExclusionDistance(originalIndex, translatedOriginalIndex))
+					ionicExcludedIndices.push_back(indices);
+			}
+
+			else if (structure.isIonicRepulsive(originalIndex, translatedOriginalIndex))
+			{
+				if (constrainingAtom.hasCovalentBondWith(translatedOriginalIndex))
+					covalentBondedIndices.push_back(indices);
+				else if (structure.isConstrainableIonicRepulsionDistance(originalIndex, translatedOriginalIndex))
+					ionicRepulsedIndices.push_back(indices);
+			}
+
+			else
+			{
+				if (constrainingAtom.hasCovalentBondWith(translatedOriginalIndex))
+					covalentBondedIndices.push_back(indices);
+				else if (structure.isConstrainableCovalentExclusionDistance(originalIndex, translatedOriginalIndex))
+					covalentExcludedIndices.push_back(indices);
+			}
+		}
+	}
+
+
+	std::vector<ConstrainerIndices<TranslatedAtomIndex>> translatedCovalentBondedIndices;
+	std::vector<ConstrainerIndices<TranslatedAtomIndex>> translatedCovalentExcludedIndices;
+	std::vector<ConstrainerIndices<TranslatedAtomIndex>> translatedIonicBondedIndices;
+	std::vector<ConstrainerIndices<TranslatedAtomIndex>> translatedIonicExcludedIndices;
+	std::vector<ConstrainerIndices<TranslatedAtomIndex>> translatedIonicRepulsedIndices;
+
+	for (const auto& indices : structure.constrainingIndexPairs())
+	{
+		const ConstrainingAtom& constrainingAtom = structure.atoms()[indices.originalAtomIndex()];
+
+
+		if (structure.isIonicAttractive(indices.originalAtomIndex(), indices.translatedAtomIndex().originalIndex()))
+		{
+			if (constrainingAtom.hasIonicBondWith(indices.translatedAtomIndex()))
+				translatedIonicBondedIndices.push_back(indices);
+			else
+				translatedIonicExcludedIndices.push_back(indices);
+		}
+
+		else if (structure.isIonicRepulsive(indices.originalAtomIndex(), indices.translatedAtomIndex().originalIndex()))
+		{
+			if (constrainingAtom.hasCovalentBondWith(indices.translatedAtomIndex()))
+				translatedCovalentBondedIndices.push_back(indices);
+			else
+				translatedIonicRepulsedIndices.push_back(indices);
+		}
+
+		else
+		{
+			if (constrainingAtom.hasCovalentBondWith(indices.translatedAtomIndex()))
+				translatedCovalentBondedIndices.push_back(indices);
+			else
+				translatedCovalentExcludedIndices.push_back(indices);
+		}
+	}
+
+
+	ObjectiveCrystalStructure referenceStructure{ structure.unitCell(), std::move(atoms), std::move(ionicAtomicNumbers), std::move(coordinationConstraints) };
+	{
+		referenceStructure.setCovalentBondedIndices(std::move(covalentBondedIndices));
+		referenceStructure.setCovalentExcludedIndices(std::move(covalentExcludedIndices));
+		referenceStructure.setIonicBondedIndices(std::move(ionicBondedIndices));
+		referenceStructure.setIonicExcludedIndices(std::move(ionicExcludedIndices));
+		referenceStructure.setIonicRepulsedIndices(std::move(ionicRepulsedIndices));
+
+		referenceStructure.setTranslatedCovalentBondedIndices(std::move(translatedCovalentBondedIndices));
+		referenceStructure.setTranslatedCovalentExcludedIndices(std::move(translatedCovalentExcludedIndices));
+		referenceStructure.setTranslatedIonicBondedIndices(std::move(translatedIonicBondedIndices));
+		referenceStructure.setTranslatedIonicExcludedIndices(std::move(translatedIonicExcludedIndices));
+		referenceStructure.setTranslatedIonicRepulsedIndices(std::move(translatedIonicRepulsedIndices));
+	}
+
+	return referenceStructure;
+}
+
+bool isSameConstraintArrays(const ObjectiveCrystalStructure& formerStructure, const ObjectiveCrystalStructure& latterStructure)
+{
+	if (!(formerStructure.covalentBondedIndices() == latterStructure.covalentBondedIndices()) || !(formerStructure.covalentExcludedIndices() == latterStructure.covalentExcludedIndices()))
+		return false;
+	else if (!(formerStructure.ionicBondedIndices() == latterStructure.ionicBondedIndices()) || !(formerStructure.ionicExcludedIndices() == latterStructure.ionicExcludedIndices()) || !(formerStructure.ionicRepulsedIndices() == latterStructure.ionicRepulsedIndices()))
+		return false;
+	else if (!(formerStructure.translatedCovalentBondedIndices() == latterStructure.translatedCovalentBondedIndices()) || !(formerStructure.translatedCovalentExcludedIndices() == latterStructure.translatedCovalentExcludedIndices()))
+		return false;
+	else if (!(formerStructure.translatedIonicBondedIndices() == latterStructure.translatedIonicBondedIndices()) || !(formerStructure.translatedIonicExcludedIndices() == latterStructure.translatedIonicExcludedIndices()) || !(formerStructure.translatedIonicRepulsedIndices() == latterStructure.translatedIonicRepulsedIndices()))
+		return false;
+	else
+		return true;
+}
+
+size_type countConstraints(const ObjectiveCrystalStructure& structure)
+{
+	size_type numConstraints = structure.covalentBondedIndices().size() + structure.covalentExcludedIndices().size() + structure.ionicBondedIndices().size() + structure.ionicExcludedIndices().size() + structure.ionicRepulsedIndices().size();
+	numConstraints += structure.translatedCovalentBondedIndices().size() + structure.translatedCovalentExcludedIndices().size() + structure.translatedIonicBondedIndices().size() + structure.translatedIonicExcludedIndices().size() + structure.translatedIonicRepulsedIndices().size();
+
+	return numConstraints;
+}
+
+// The best of several trials, which is less sensitive to other load on the machine.
+template <typename F>
+double measureMicroseconds(const size_type numRepetitions, const F& function, size_type& checksum)
+{
+	double minimumTime = 0.0;
+
+	for (size_type trial = 0; trial < 5; ++trial)
+	{
+		const auto startTime = std::chrono::steady_clock::now();
+
+		for (size_type rep = 0; rep < numRepetitions; ++rep)
+			checksum += function();
+
+		const double time = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count() / numRepetitions;
+		minimumTime = ((trial == 0) ? time : std::min(minimumTime, time));
+	}
+
+	return minimumTime;
+}
+
+
+int main()
+{
+	const std::vector<std::array<short, 3>> gridExtents{ { 2, 2, 5 }, { 4, 4, 5 }, { 4, 4, 20 }, { 4, 4, 80 } };
+	bool isSame = true;
+
+	initializeAtomicRadii();
+
+	std::cout << std::setw(8) << "atoms" << std::setw(14) << "constraints" << std::setw(16) << "reference [us]" << std::setw(16) << "current [us]" << std::setw(10) << "equal" << std::endl;
+
+	for (const auto& extents : gridExtents)
+	{
+		const ConstrainingCrystalStructure structure = createGridStructure(extents[0], extents[1], extents[2]);
+		const size_type numRepetitions = 20000 / structure.atoms().size();
+
+		const ObjectiveCrystalStructure currentStructure{ structure };
+		const bool isSameArrays = isSameConstraintArrays(createReferenceStructure(structure), currentStructure);
+		isSame = isSame && isSameArrays;
+
+		size_type referenceChecksum = 0;
+		size_type currentChecksum = 0;
+
+		const double referenceTime = measureMicroseconds(numRepetitions, [&]() { return countConstraints(createReferenceStructure(structure)); }, referenceChecksum);
+		const double currentTime = measureMicroseconds(numRepetitions, [&]() { return countConstraints(ObjectiveCrystalStructure{ structure }); }, currentChecksum);
+
+		isSame = isSame && (referenceChecksum == currentChecksum);
+
+		std::cout << std::setw(8) << structure.atoms().size() << std::setw(14) << countConstraints(currentStructure) << std::fixed << std::setprecision(2) << std::setw(16) << referenceTime << std::setw(16) << currentTime << std::setw(10) << (isSameArrays ? "yes" : "NO") << std::endl;
+	}
+
+	return (isSame ? EXIT_SUCCESS : EXIT_FAILURE);
+}
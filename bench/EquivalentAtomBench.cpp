@@ -0,0 +1,230 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "SpaceGroupTypeSearcher.h"
+
+using namespace ChemToolkit::Crystallography;
+
+
+using size_type = std::size_t;
+using AtomicNumber = ChemToolkit::Generic::AtomicNumber;
+using NumericalVector = MathToolkit::LinearAlgebra::NumericalVector<double, 3>;
+using UniqueIndices = std::vector<unsigned short>;
+
+
+struct PeriodicAtoms
+{
+	UnitCell unitCell;
+	std::vector<AtomicNumber> atomicNumbers;
+	std::vector<NumericalVector> fractionalCoordinates;
+};
+
+
+// The loop that removeEquivalentAtoms() used before the periodic bucket hash: every atom against every unique atom, over 27 images.
+UniqueIndices getReferenceUniqueAtomIndices(const PeriodicAtoms& periodicAtoms)
+{
+	constexpr double samePositionDistanceRange = 0.001;
+
+	UniqueIndices uniqueIndices;
+
+	for (size_type index = 0; index < periodicAtoms.atomicNumbers.size(); ++index)
+	{
+		bool hasSameFractionalCoordinate = false;
+		{
+			for (int indexA = (-1); ((indexA < 2) && !hasSameFractionalCoordinate); ++indexA)
+			{
+				for (int indexB = (-1); ((indexB < 2) && !hasSameFractionalCoordinate); ++indexB)
+				{
+					for (int indexC = (-1); ((indexC < 2) && !hasSameFractionalCoordinate); ++indexC)
+					{
+						NumericalVector translatedFractionalCoordinate = periodicAtoms.fractionalCoordinates.at(index);
+						{
+							translatedFractionalCoordinate[0] += static_cast<double>(indexA);
+							translatedFractionalCoordinate[1] += static_cast<double>(indexB);
+							translatedFractionalCoordinate[2] += static_cast<double>(indexC);
+						}
+
+
+						for (const auto& uniqueIndex : uniqueIndices)
+						{
+							if (periodicAtoms.atomicNumbers.at(index) == periodicAtoms.atomicNumbers.at(uniqueIndex))
+							{
+								NumericalVector displacement = periodicAtoms.unitCell.basisVectors() * (periodicAtoms.fractionalCoordinates.at(uniqueIndex) - translatedFractionalCoordinate);
+
+								if (displacement.normSquare() < (samePositionDistanceRange * samePositionDistanceRange))
+								{
+									hasSameFractionalCoordinate = true;
+									break;
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+
+		if (!hasSameFractionalCoordinate)
+			uniqueIndices.push_back(static_cast<unsigned short>(index));
+	}
+
+	return uniqueIndices;
+}
+
+// A sheared cell whose edges are scaled by cellLength, holding numSites random sites of three species.
+// About half of the sites get a copy, either a near-duplicate just inside or just outside the distance range, or a periodic image across a cell face.
+PeriodicAtoms createRandomPeriodicAtoms(const size_type numSites, const double cellLength, std::mt19937& randomEngine)
+{
+	std::uniform_real_distribution<double> unitDistribution{ 0.0, 1.0 };
+	std::uniform_real_distribution<double> shearDistribution{ -0.3, 0.3 };
+	std::uniform_int_distribution<unsigned short> atomicNumberDistribution{ 1, 3 };
+	std::uniform_int_distribution<int> copyDistribution{ 0, 5 };
+
+	PeriodicAtoms periodicAtoms;
+	{
+		for (size_type row = 0; row < 3; ++row)
+		{
+			for (size_type column = 0; column < 3; ++column)
+				periodicAtoms.unitCell.basisVectors()(row, column) = cellLength * ((row == column) ? (1.0 + unitDistribution(randomEngine)) : shearDistribution(randomEngine));
+		}
+	}
+
+	const auto inverseBasisVectors = periodicAtoms.unitCell.getInverseBasisVectors();
+
+	const auto wrap = [](NumericalVector fractionalCoordinate)
+	{
+		for (size_type row = 0; row < 3; ++row)
+			fractionalCoordinate[row] -= std::floor(fractionalCoordinate[row]);
+
+		return fractionalCoordinate;
+	};
+
+	const auto addAtom = [&](const AtomicNumber atomicNumber, const NumericalVector& fractionalCoordinate)
+	{
+		periodicAtoms.atomicNumbers.push_back(atomicNumber);
+		periodicAtoms.fractionalCoordinates.push_back(wrap(fractionalCoordinate));
+	};
+
+
+	for (size_type site = 0; site < numSites; ++site)
+	{
+		const AtomicNumber atomicNumber{ atomicNumberDistribution(randomEngine) };
+
+		NumericalVector fractionalCoordinate;
+		{
+			for (size_type row = 0; row < 3; ++row)
+				fractionalCoordinate[row] = unitDistribution(randomEngine);
+
+			// Pull some sites onto a cell face, so that their copies land on the other side after wrapping.
+			if (copyDistribution(randomEngine) == 0)
+				fractionalCoordinate[site % 3] = 1.0e-6 * unitDistribution(randomEngine);
+		}
+
+		addAtom(atomicNumber, fractionalCoordinate);
+
+
+		const int copyType = copyDistribution(randomEngine);
+
+		if (copyType < 3)
+		{
+			// Cartesian offsets of 0.9, 0.999 and 1.1 times the distance range.
+			const double offsetLength = 0.001 * ((copyType == 0) ? 0.9 : ((copyType == 1) ? 0.999 : 1.1));
+
+			NumericalVector cartesianOffset;
+			{
+				for (size_type row = 0; row < 3; ++row)
+					cartesianOffset[row] = unitDistribution(randomEngine) - 0.5;
+
+				cartesianOffset *= (offsetLength / std::sqrt(cartesianOffset.normSquare()));
+			}
+
+			NumericalVector copiedFractionalCoordinate = fractionalCoordinate + (inverseBasisVectors * cartesianOffset);
+			addAtom(atomicNumber, copiedFractionalCoordinate);
+		}
+
+		else if (copyType == 3)
+		{
+			NumericalVector copiedFractionalCoordinate = fractionalCoordinate;
+			copiedFractionalCoordinate[site % 3] -= 1.0;
+			addAtom(atomicNumber, copiedFractionalCoordinate);
+		}
+	}
+
+	return periodicAtoms;
+}
+
+template <typename F>
+double measureMicroseconds(const size_type numRepetitions, const F& function, size_type& checksum)
+{
+	constexpr size_type numTrials = 5;
+	double bestTime = 0.0;
+
+	for (size_type trial = 0; trial < numTrials; ++trial)
+	{
+		const auto startTime = std::chrono::steady_clock::now();
+
+		for (size_type rep = 0; rep < numRepetitions; ++rep)
+			checksum += function();
+
+		const double time = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count() / numRepetitions;
+
+		if ((trial == 0) || (time < bestTime))
+			bestTime = time;
+	}
+
+	return bestTime;
+}
+
+
+int main()
+{
+	std::mt19937 randomEngine{ 20260419 };
+	size_type numMismatches = 0;
+
+	// Cell edges of 0.002 to 10 cover single-bucket axes, few-bucket axes and the 64-bucket cap.
+	{
+		size_type numCells = 0;
+
+		for (const double cellLength : { 0.002, 0.005, 0.05, 1.0, 10.0 })
+		{
+			for (size_type cell = 0; cell < 60; ++cell)
+			{
+				const PeriodicAtoms periodicAtoms = createRandomPeriodicAtoms(40, cellLength, randomEngine);
+
+				if (!(Symmetry::SpaceGroupTypeSearcher::getUniqueAtomIndices(periodicAtoms.unitCell, periodicAtoms.atomicNumbers, periodicAtoms.fractionalCoordinates) == getReferenceUniqueAtomIndices(periodicAtoms)))
+					++numMismatches;
+
+				++numCells;
+			}
+		}
+
+		std::cout << "Equivalence against the 27-image loop: " << numMismatches << " mismatches in " << numCells << " cells" << std::endl;
+	}
+
+
+	std::cout << std::setw(10) << "atoms" << std::setw(12) << "unique" << std::setw(18) << "loop [us]" << std::setw(18) << "buckets [us]" << std::endl;
+
+	for (const size_type numSites : { 20, 100, 400, 1600 })
+	{
+		const PeriodicAtoms periodicAtoms = createRandomPeriodicAtoms(numSites, 10.0, randomEngine);
+		const size_type numRepetitions = std::max<size_type>(1, 20000 / (numSites * numSites));
+
+		size_type referenceChecksum = 0;
+		size_type bucketChecksum = 0;
+
+		const double referenceTime = measureMicroseconds(numRepetitions, [&]() { return getReferenceUniqueAtomIndices(periodicAtoms).size(); }, referenceChecksum);
+		const double bucketTime = measureMicroseconds(numRepetitions, [&]() { return Symmetry::SpaceGroupTypeSearcher::getUniqueAtomIndices(periodicAtoms.unitCell, periodicAtoms.atomicNumbers, periodicAtoms.fractionalCoordinates).size(); }, bucketChecksum);
+
+		if (!(referenceChecksum == bucketChecksum))
+			++numMismatches;
+
+		std::cout << std::setw(10) << periodicAtoms.atomicNumbers.size() << std::setw(12) << (bucketChecksum / (5 * numRepetitions)) << std::fixed << std::setprecision(2) << std::setw(18) << referenceTime << std::setw(18) << bucketTime << std::endl;
+	}
+
+	return ((numMismatches == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,251 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "OptimalCrystalStructure.h"
+
+using namespace MathematicalCrystalChemistry::CrystalModel::Components;
+
+
+using size_type = std::size_t;
+using AtomicNumber = ChemToolkit::Generic::AtomicNumber;
+using FormalCharge = ChemToolkit::Generic::FormalCharge;
+using IonicAtomicNumber = ChemToolkit::Generic::IonicAtomicNumber;
+using SiteSymmetrySymbol = ChemToolkit::Crystallography::Symmetry::SiteSymmetrySymbol;
+using NumericalVector = MathToolkit::LinearAlgebra::NumericalVector<double, 3>;
+
+
+// Few species, site symmetries and polyhedral linkings, so that equal fingerprints occur often and
+// near-equal ones differ in a single count, neighbour species or bridging atom.
+// A site label fixes the species, symmetry and environment of every atom that carries it.
+OptimalAtom createRandomSite(const std::string& siteLabel, const std::vector<IonicAtomicNumber>& cations, const std::vector<IonicAtomicNumber>& anions, std::mt19937& randomEngine)
+{
+	static const std::vector<std::string> siteSymmetrySymbols{ "m-3m", "4mm", "-1" };
+
+	std::uniform_int_distribution<size_type> binaryDistribution{ 0, 1 };
+	std::uniform_int_distribution<size_type> symbolDistribution{ 0, (siteSymmetrySymbols.size() - 1) };
+	std::uniform_int_distribution<size_type> numLinkingsDistribution{ 0, 2 };
+
+	const bool isCation = (binaryDistribution(randomEngine) == 0);
+	const std::vector<IonicAtomicNumber>& sameSpecies = (isCation ? cations : anions);
+	const std::vector<IonicAtomicNumber>& otherSpecies = (isCation ? anions : cations);
+
+	const auto pickSame = [&]() { return sameSpecies[binaryDistribution(randomEngine)]; };
+	const auto pickOther = [&]() { return otherSpecies[binaryDistribution(randomEngine)]; };
+
+	OptimalAtom optimalAtom{ pickSame(), NumericalVector{} };
+	{
+		optimalAtom.setSiteLabel(siteLabel);
+		optimalAtom.setSiteSymmetrySymbol(SiteSymmetrySymbol{ siteSymmetrySymbols[symbolDistribution(randomEngine)] });
+		optimalAtom.setWyckoffSymbol(ChemToolkit::Crystallography::Symmetry::WyckoffSymbol{ "a" });
+
+		const size_type coordinationNumber = 4 + (2 * binaryDistribution(randomEngine));
+
+		for (size_type index = 0; index < coordinationNumber; ++index)
+			optimalAtom.addCoordination(pickOther());
+
+		for (size_type index = numLinkingsDistribution(randomEngine); 0 < index; --index)
+			optimalAtom.addVertexSharings(std::make_pair(pickSame(), pickOther()));
+
+		for (size_type index = numLinkingsDistribution(randomEngine); 0 < index; --index)
+			optimalAtom.addEdgeSharings(std::make_pair(pickSame(), std::array<IonicAtomicNumber, 2>{ pickOther(), pickOther() }));
+
+		for (size_type index = numLinkingsDistribution(randomEngine); 0 < index; --index)
+			optimalAtom.addFaceSharings(std::make_pair(pickSame(), std::vector<IonicAtomicNumber>(3 + binaryDistribution(randomEngine), pickOther())));
+	}
+
+	return optimalAtom;
+}
+
+// Changes a single detail of every atom on the site: the species of one neighbour, the site symmetry, or one more vertex sharing.
+// Only the last one changes the counts that the plain fingerprint sees.
+std::vector<OptimalAtom> mutateSite(std::vector<OptimalAtom> atoms, const std::vector<IonicAtomicNumber>& species, std::mt19937& randomEngine)
+{
+	std::uniform_int_distribution<size_type> atomDistribution{ 0, (atoms.size() - 1) };
+	std::uniform_int_distribution<int> mutationDistribution{ 0, 2 };
+
+	const std::string siteLabel = atoms[atomDistribution(randomEngine)].siteLabel();
+	const int mutation = mutationDistribution(randomEngine);
+
+	for (auto& atom : atoms)
+	{
+		if (!(atom.siteLabel() == siteLabel))
+			continue;
+
+		if (mutation == 0)
+		{
+			std::vector<IonicAtomicNumber> coordinations = atom.coordinations();
+			coordinations.front() = ((coordinations.front() == species.front()) ? species.back() : species.front());
+
+			atom.setCoordinations(std::move(coordinations));
+		}
+
+		else if (mutation == 1)
+			atom.setSiteSymmetrySymbol(SiteSymmetrySymbol{ (static_cast<std::string>(atom.siteSymmetrySymbol()) == "mm2") ? "-1" : "mm2" });
+
+		else
+			atom.addVertexSharings(std::make_pair(atom.ionicAtomicNumber(), atom.coordinations().front()));
+	}
+
+	return atoms;
+}
+
+// With variants, every random structure is followed by a copy with its atoms in reverse order and by a copy with one site mutated.
+std::vector<OptimalCrystalStructure> createCorpus(const size_type numStructures, const size_type maxNumSites, const bool withVariants, std::mt19937& randomEngine)
+{
+	const std::vector<IonicAtomicNumber> cations{ IonicAtomicNumber{ AtomicNumber{ 11 }, FormalCharge{ 1 } }, IonicAtomicNumber{ AtomicNumber{ 12 }, FormalCharge{ 2 } } };
+	const std::vector<IonicAtomicNumber> anions{ IonicAtomicNumber{ AtomicNumber{ 8 }, FormalCharge{ -2 } }, IonicAtomicNumber{ AtomicNumber{ 17 }, FormalCharge{ -1 } } };
+
+	std::uniform_int_distribution<size_type> numSitesDistribution{ 1, maxNumSites };
+	std::uniform_int_distribution<size_type> multiplicityDistribution{ 1, 2 };
+
+	std::vector<OptimalCrystalStructure> corpus;
+	{
+		for (size_type structure = 0; structure < numStructures; ++structure)
+		{
+			std::vector<OptimalAtom> atoms;
+			{
+				const size_type numSites = numSitesDistribution(randomEngine);
+
+				for (size_type site = 0; site < numSites; ++site)
+				{
+					const OptimalAtom optimalAtom = createRandomSite(std::string{ "site" } + std::to_string(site), cations, anions, randomEngine);
+					atoms.insert(atoms.end(), multiplicityDistribution(randomEngine), optimalAtom);
+				}
+			}
+
+			if (withVariants)
+			{
+				corpus.emplace_back(ChemToolkit::Crystallography::UnitCell{}, std::vector<OptimalAtom>{ atoms.rbegin(), atoms.rend() });
+				corpus.emplace_back(ChemToolkit::Crystallography::UnitCell{}, mutateSite(atoms, { cations.front(), anions.front() }, randomEngine));
+			}
+
+			corpus.emplace_back(ChemToolkit::Crystallography::UnitCell{}, std::move(atoms));
+		}
+	}
+
+	return corpus;
+}
+
+template <typename F>
+double measureMicroseconds(const size_type numRepetitions, const F& function, size_type& checksum)
+{
+	constexpr size_type numTrials = 5;
+	double bestTime = 0.0;
+
+	for (size_type trial = 0; trial < numTrials; ++trial)
+	{
+		const auto startTime = std::chrono::steady_clock::now();
+
+		for (size_type rep = 0; rep < numRepetitions; ++rep)
+			checksum += function();
+
+		const double time = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count() / numRepetitions;
+
+		if ((trial == 0) || (time < bestTime))
+			bestTime = time;
+	}
+
+	return bestTime;
+}
+
+
+int main()
+{
+	std::mt19937 randomEngine{ 20260420 };
+	size_type numMismatches = 0;
+
+	// Every pair of the corpus must agree on hash equality and fingerprint equality, for both fingerprint levels.
+	{
+		const std::vector<OptimalCrystalStructure> corpus = createCorpus(200, 3, true, randomEngine);
+
+		std::vector<std::string> fingerprints;
+		std::vector<std::string> detailedFingerprints;
+		std::vector<StructuralHash> hashes;
+		std::vector<StructuralHash> detailedHashes;
+		{
+			for (const auto& structure : corpus)
+			{
+				const auto uniqueOptimalAtoms = structure.getUniqueOptimalAtoms();
+
+				fingerprints.push_back(structure.toStructuralFingerprint(uniqueOptimalAtoms));
+				detailedFingerprints.push_back(structure.toDetailedStructuralFingerprint(uniqueOptimalAtoms));
+				hashes.push_back(structure.toStructuralHash(uniqueOptimalAtoms));
+				detailedHashes.push_back(structure.toDetailedStructuralHash(uniqueOptimalAtoms));
+
+				if (!(hashes.back() == structure.toStructuralHash()) || !(detailedHashes.back() == structure.toDetailedStructuralHash()))
+					++numMismatches;
+			}
+		}
+
+		size_type numEqualFingerprints = 0;
+		size_type numEqualDetailedFingerprints = 0;
+
+		for (size_type formerIndex = 0; formerIndex < corpus.size(); ++formerIndex)
+		{
+			for (size_type latterIndex = (formerIndex + 1); latterIndex < corpus.size(); ++latterIndex)
+			{
+				const bool isSameFingerprint = (fingerprints[formerIndex] == fingerprints[latterIndex]);
+				const bool isSameDetailedFingerprint = (detailedFingerprints[formerIndex] == detailedFingerprints[latterIndex]);
+
+				if (!(isSameFingerprint == (hashes[formerIndex] == hashes[latterIndex])))
+					++numMismatches;
+
+				if (!(isSameDetailedFingerprint == (detailedHashes[formerIndex] == detailedHashes[latterIndex])))
+					++numMismatches;
+
+				if (isSameFingerprint)
+					++numEqualFingerprints;
+
+				if (isSameDetailedFingerprint)
+					++numEqualDetailedFingerprints;
+			}
+		}
+
+		std::cout << "Equivalence against fingerprint texts: " << numMismatches << " mismatches in " << (corpus.size() * (corpus.size() - 1) / 2) << " pairs ("
+			<< numEqualFingerprints << " equal fingerprints, " << numEqualDetailedFingerprints << " equal detailed fingerprints)" << std::endl;
+	}
+
+
+	std::cout << std::setw(10) << "sites" << std::setw(20) << "fingerprint [us]" << std::setw(14) << "hash [us]" << std::setw(22) << "detailed text [us]" << std::setw(22) << "detailed hash [us]" << std::endl;
+
+	for (const size_type maxNumSites : { 4, 16, 64 })
+	{
+		const std::vector<OptimalCrystalStructure> corpus = createCorpus(50, maxNumSites, false, randomEngine);
+		const size_type numRepetitions = 400 / maxNumSites;
+
+		std::vector<decltype(corpus.front().getUniqueOptimalAtoms())> uniqueOptimalAtoms;
+		{
+			for (const auto& structure : corpus)
+				uniqueOptimalAtoms.push_back(structure.getUniqueOptimalAtoms());
+		}
+
+		size_type checksum = 0;
+
+		const auto measure = [&](const auto& function)
+		{
+			return measureMicroseconds(numRepetitions, [&]()
+			{
+				size_type sum = 0;
+
+				for (size_type index = 0; index < corpus.size(); ++index)
+					sum += function(corpus[index], uniqueOptimalAtoms[index]);
+
+				return sum;
+			}, checksum) / corpus.size();
+		};
+
+		const double fingerprintTime = measure([](const OptimalCrystalStructure& structure, const auto& unique) { return structure.toStructuralFingerprint(unique).size(); });
+		const double hashTime = measure([](const OptimalCrystalStructure& structure, const auto& unique) { return static_cast<size_type>(structure.toStructuralHash(unique).low()); });
+		const double detailedFingerprintTime = measure([](const OptimalCrystalStructure& structure, const auto& unique) { return structure.toDetailedStructuralFingerprint(unique).size(); });
+		const double detailedHashTime = measure([](const OptimalCrystalStructure& structure, const auto& unique) { return static_cast<size_type>(structure.toDetailedStructuralHash(unique).low()); });
+
+		std::cout << std::setw(10) << (maxNumSites + 1) / 2 << std::fixed << std::setprecision(2) << std::setw(20) << fingerprintTime << std::setw(14) << hashTime << std::setw(22) << detailedFingerprintTime << std::setw(22) << detailedHashTime << std::endl;
+	}
+
+	return ((numMismatches == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,235 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "AtomicRadiusDictionary.h"
+#include "CoordinationConstraintsDictionary.h"
+#include "LengthCasting.h"
+#include "StreamReader.h"
+
+#include "ConstrainingAtomicSpecies.h"
+#include "ConstrainingCrystalStructure.h"
+
+using namespace MathematicalCrystalChemistry::CrystalModel::Components;
+
+
+using size_type = std::size_t;
+using IonicAtomicNumber = ChemToolkit::Generic::IonicAtomicNumber;
+using NumericalVector = MathToolkit::LinearAlgebra::NumericalVector<double, 3>;
+using CoordinationConstraints = MathematicalCrystalChemistry::CrystalModel::Constraints::CoordinationConstraints;
+using CoordinationConstraintsHandle = std::shared_ptr<const CoordinationConstraints>;
+
+
+// Heap bytes requested through the global operator new since the last reset, so that a single copy can be weighed.
+size_type s_numAllocatedBytes = 0;
+
+void* operator new(std::size_t size)
+{
+	s_numAllocatedBytes += size;
+
+	if (void* pointer = std::malloc((0 < size) ? size : 1))
+		return pointer;
+	else
+		throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+	std::free(pointer);
+}
+
+
+// Covalent (min, max), ionic (min, max) and ionic repulsion (min) radii in angstrom, close to the tabulated values.
+void initializeAtomicRadii()
+{
+	MathematicalCrystalChemistry::CrystalModel::Constraints::AtomicRadiusDictionary::initialize(System::IO::StreamReader{ std::vector<std::string>{ "Na+ 1.40 1.70 0.95 1.16 0.90", "Cl- 0.90 1.10 1.67 1.81 1.40", "O2- 0.60 0.73 1.26 1.42 1.20" } });
+}
+
+// Na+ takes every mixed Cl/O environment of 4, 5, 6 and 8 neighbours, the anions take lower bounds and ionic coordination numbers,
+// which gives constraint sets of the size that a mixed-anion composition produces.
+void initializeCoordinationConstraints()
+{
+	std::string feasibleCompositions{ "Na+" };
+	{
+		for (const size_type coordinationNumber : { 4, 5, 6, 8 })
+		{
+			for (size_type numChlorine = 0; numChlorine <= coordinationNumber; ++numChlorine)
+			{
+				const size_type numOxygen = coordinationNumber - numChlorine;
+
+				feasibleCompositions += " ";
+				feasibleCompositions += ((0 < numChlorine) ? ("Cl" + std::to_string(numChlorine)) : std::string{});
+				feasibleCompositions += ((0 < numOxygen) ? ("O" + std::to_string(numOxygen)) : std::string{});
+			}
+		}
+	}
+
+	MathematicalCrystalChemistry::CrystalModel::Constraints::CoordinationConstraintsDictionary::initialize(System::IO::StreamReader{ std::vector<std::string>{
+		"&FEASIBLE_COORDINATION_COMPOSITIONS", feasibleCompositions,
+		"&FEASIBLE_IONIC_COORDINATION_NUMBERS", "Cl- 3 4 5 6 8", "O2- 2 3 4 5 6",
+		"&LOWER_BOUND_COORDINATION_COMPOSITIONS", "Cl- Na1", "O2- Na2" } });
+}
+
+// An n * n * n simple cubic grid of Na+ on one sublattice and alternating Cl- and O2- on the other.
+ConstrainingCrystalStructure createGridStructure(const short n, const std::vector<ConstrainingAtomicSpecies>& species)
+{
+	using namespace MathToolkit::UnitConversion::LengthCasting;
+	const double spacing = cast<Unit::Angstrom, Unit::AtomicUnit>(2.8);
+
+	ChemToolkit::Crystallography::UnitCell unitCell;
+	{
+		for (size_type axis = 0; axis < 3; ++axis)
+			unitCell.basisVectors()(axis, axis) = n * spacing;
+	}
+
+	std::vector<ConstrainingAtom> atoms;
+	{
+		for (short x = 0; x < n; ++x)
+		{
+			for (short y = 0; y < n; ++y)
+			{
+				for (short z = 0; z < n; ++z)
+				{
+					const size_type speciesIndex = (((x + y + z) % 2 == 0) ? 0 : (1 + (x % 2)));
+					atoms.emplace_back(species[speciesIndex], NumericalVector{ x * spacing, y * spacing, z * spacing });
+				}
+			}
+		}
+	}
+
+	return ConstrainingCrystalStructure{ unitCell, std::move(atoms) };
+}
+
+// Every atom of a copy must point at the constraints of its species and see the same contents.
+size_type countMismatches(const ConstrainingCrystalStructure& structure, const std::vector<ConstrainingAtomicSpecies>& species)
+{
+	size_type numMismatches = 0;
+
+	for (const auto& atom : structure.atoms())
+	{
+		auto speciesIter = std::find_if(species.begin(), species.end(), [&](const ConstrainingAtomicSpecies& value) { return (value.ionicAtomicNumber() == atom.ionicAtomicNumber()); });
+
+		if (speciesIter == species.end())
+			++numMismatches;
+		else if (!(atom.coordinationConstraintsHandle() == speciesIter->coordinationConstraintsHandle()))
+			++numMismatches;
+		else if (!(atom.coordinationConstraints().feasibleCompositions() == CoordinationConstraints{ atom.ionicAtomicNumber() }.feasibleCompositions()))
+			++numMismatches;
+		else if (!(atom.coordinationConstraints().maxCoordinationNumber() == CoordinationConstraints{ atom.ionicAtomicNumber() }.maxCoordinationNumber()))
+			++numMismatches;
+	}
+
+	return numMismatches;
+}
+
+// The best of several trials, which is less sensitive to other load on the machine.
+template <typename F>
+double measureMicroseconds(const size_type numRepetitions, const F& function, size_type& checksum)
+{
+	double minimumTime = 0.0;
+
+	for (size_type trial = 0; trial < 5; ++trial)
+	{
+		const auto startTime = std::chrono::steady_clock::now();
+
+		for (size_type rep = 0; rep < numRepetitions; ++rep)
+			checksum += function();
+
+		const double time = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count() / numRepetitions;
+		minimumTime = ((trial == 0) ? time : std::min(minimumTime, time));
+	}
+
+	return minimumTime;
+}
+
+template <typename F>
+size_type measureAllocatedBytes(const F& function, size_type& checksum)
+{
+	s_numAllocatedBytes = 0;
+	checksum += function();
+
+	return s_numAllocatedBytes;
+}
+
+
+int main()
+{
+	initializeAtomicRadii();
+	initializeCoordinationConstraints();
+
+	const std::vector<ConstrainingAtomicSpecies> species{
+		ConstrainingAtomicSpecies{ IonicAtomicNumber::toIonicAtomicNumber("Na+") },
+		ConstrainingAtomicSpecies{ IonicAtomicNumber::toIonicAtomicNumber("Cl-") },
+		ConstrainingAtomicSpecies{ IonicAtomicNumber::toIonicAtomicNumber("O2-") } };
+
+	size_type numMismatches = 0;
+	{
+		for (const short n : { 2, 3, 4 })
+		{
+			const ConstrainingCrystalStructure structure = createGridStructure(n, species);
+			const ConstrainingCrystalStructure copiedStructure{ structure };
+
+			numMismatches += countMismatches(copiedStructure, species);
+		}
+
+		std::cout << "Sharing against the species constraints: " << numMismatches << " mismatches" << std::endl;
+	}
+
+
+	// Before the change every atom held its own CoordinationConstraints, so a structure copy also deep-copied one per atom.
+	// The reconstruction copies the current structure and a by-value constraint array; its atoms still carry a handle,
+	// which is subtracted from the bytes but not from the time, so the old copy time is overstated by one reference count per atom.
+	std::cout << std::setw(8) << "atoms" << std::setw(18) << "before [us]" << std::setw(18) << "after [us]" << std::setw(22) << "before [B/struct]" << std::setw(22) << "after [B/struct]" << std::endl;
+
+	for (const short n : { 2, 4, 8 })
+	{
+		const ConstrainingCrystalStructure structure = createGridStructure(n, species);
+		const size_type numRepetitions = std::max<size_type>(1, 20000 / structure.atoms().size());
+
+		std::vector<CoordinationConstraints> perAtomConstraints;
+		{
+			for (const auto& atom : structure.atoms())
+				perAtomConstraints.push_back(atom.coordinationConstraints());
+		}
+
+		const auto copyBefore = [&]()
+		{
+			const ConstrainingCrystalStructure copiedStructure{ structure };
+			const std::vector<CoordinationConstraints> copiedConstraints{ perAtomConstraints };
+
+			return (copiedStructure.atoms().size() + copiedConstraints.size());
+		};
+
+		const auto copyAfter = [&]()
+		{
+			const ConstrainingCrystalStructure copiedStructure{ structure };
+			return (2 * copiedStructure.atoms().size());
+		};
+
+		size_type beforeChecksum = 0;
+		size_type afterChecksum = 0;
+
+		const double beforeTime = measureMicroseconds(numRepetitions, copyBefore, beforeChecksum);
+		const double afterTime = measureMicroseconds(numRepetitions, copyAfter, afterChecksum);
+
+		const size_type beforeBytes = sizeof(ConstrainingCrystalStructure) + measureAllocatedBytes(copyBefore, beforeChecksum) - (structure.atoms().size() * sizeof(CoordinationConstraintsHandle));
+		const size_type afterBytes = sizeof(ConstrainingCrystalStructure) + measureAllocatedBytes(copyAfter, afterChecksum);
+
+		if (!(beforeChecksum == afterChecksum))
+			++numMismatches;
+
+		std::cout << std::setw(8) << structure.atoms().size() << std::fixed << std::setprecision(2) << std::setw(18) << beforeTime << std::setw(18) << afterTime << std::setw(22) << beforeBytes << std::setw(22) << afterBytes << std::endl;
+	}
+
+	return ((numMismatches == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,168 @@
+#ifndef SYSTEM_PARALLEL_BOUNDEDCONCURRENTQUEUE_H
+#define SYSTEM_PARALLEL_BOUNDEDCONCURRENTQUEUE_H
+
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <utility>
+
+#include "ArgumentOutOfRangeException.h"
+
+
+namespace System
+{
+	namespace Parallel
+	{
+		template <typename T>
+		class BoundedConcurrentQueue final
+		{
+		public:
+			using size_type = std::size_t;
+			using value_type = T;
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Constructors and destructor
+
+		public:
+			explicit BoundedConcurrentQueue(const size_type capacity);
+			~BoundedConcurrentQueue() = default;
+
+		// Constructors and destructor
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Public methods
+
+			size_type capacity() const noexcept;
+
+			bool push(value_type);
+			bool pop(value_type&);
+			void close();
+
+		// Public methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+		private:
+			size_type _capacity;
+			std::queue<value_type> _values;
+			bool _isClosed;
+
+			std::mutex _queueMutex;
+			std::condition_variable _notFullCondition;
+			std::condition_variable _notEmptyCondition;
+
+
+		private:
+			BoundedConcurrentQueue(const BoundedConcurrentQueue&) = delete;
+			BoundedConcurrentQueue(BoundedConcurrentQueue&&) noexcept = delete;
+			BoundedConcurrentQueue& operator=(const BoundedConcurrentQueue&) = delete;
+			BoundedConcurrentQueue& operator=(BoundedConcurrentQueue&&) noexcept = delete;
+		};
+	}
+}
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Constructors and destructor
+
+template <typename T>
+inline System::Parallel::BoundedConcurrentQueue<T>::BoundedConcurrentQueue(const size_type capacity)
+	: _capacity{ capacity }
+	, _values{}
+	, _isClosed{ false }
+	, _queueMutex{}
+	, _notFullCondition{}
+	, _notEmptyCondition{}
+{
+	if (capacity == 0)
+		throw System::ExceptionServices::ArgumentOutOfRangeException{ typeid(*this), "constructor", "\"capacity\" must be positive." };
+}
+
+// Constructors and destructor
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Public methods
+
+template <typename T>
+inline typename System::Parallel::BoundedConcurrentQueue<T>::size_type System::Parallel::BoundedConcurrentQueue<T>::capacity() const noexcept
+{
+	return _capacity;
+}
+
+template <typename T>
+inline bool System::Parallel::BoundedConcurrentQueue<T>::push(value_type value)
+{
+	std::unique_lock<std::mutex> guard{ _queueMutex };
+	_notFullCondition.wait(guard, [this]() { return (_isClosed || (_values.size() < _capacity)); });
+
+	if (_isClosed)
+		return false;
+
+	else
+	{
+		_values.push(std::move(value));
+		guard.unlock();
+
+		_notEmptyCondition.notify_one();
+		return true;
+	}
+}
+
+template <typename T>
+inline bool System::Parallel::BoundedConcurrentQueue<T>::pop(value_type& value)
+{
+	std::unique_lock<std::mutex> guard{ _queueMutex };
+	_notEmptyCondition.wait(guard, [this]() { return (_isClosed || !(_values.empty())); });
+
+	if (_values.empty())
+		return false;
+
+	else
+	{
+		value = std::move(_values.front());
+		_values.pop();
+		guard.unlock();
+
+		_notFullCondition.notify_one();
+		return true;
+	}
+}
+
+template <typename T>
+inline void System::Parallel::BoundedConcurrentQueue<T>::close()
+{
+	{
+		std::lock_guard<std::mutex> guard{ _queueMutex };
+		_isClosed = true;
+	}
+
+	_notFullCondition.notify_all();
+	_notEmptyCondition.notify_all();
+}
+
+// Public methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+
+#endif // !SYSTEM_PARALLEL_BOUNDEDCONCURRENTQUEUE_H
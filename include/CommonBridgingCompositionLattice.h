@@ -0,0 +1,128 @@
+#ifndef MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_CONSTRAINTS_COMMONBRIDGINGCOMPOSITIONLATTICE_H
+#define MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_CONSTRAINTS_COMMONBRIDGINGCOMPOSITIONLATTICE_H
+
+#include <vector>
+
+#include "AtomicNumber.h"
+#include "ChemicalComposition.h"
+#include "FlatChemicalComposition.h"
+
+
+namespace MathematicalCrystalChemistry
+{
+	namespace CrystalModel
+	{
+		namespace Constraints
+		{
+			class CommonBridgingCompositionLattice
+			{
+				using size_type = unsigned short;
+
+				using AtomicNumber = ChemToolkit::Generic::AtomicNumber;
+				using BasicChemicalComposition = ChemToolkit::Generic::ChemicalComposition<AtomicNumber>;
+				using ChemicalComposition = ChemToolkit::Generic::FlatChemicalComposition;
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Constructors, destructor, and operators
+
+			public:
+				CommonBridgingCompositionLattice() noexcept;
+				explicit CommonBridgingCompositionLattice(const std::vector<ChemicalComposition>&);
+				explicit CommonBridgingCompositionLattice(const std::vector<BasicChemicalComposition>&);
+
+				virtual ~CommonBridgingCompositionLattice() = default;
+
+				CommonBridgingCompositionLattice(const CommonBridgingCompositionLattice&) = default;
+				CommonBridgingCompositionLattice(CommonBridgingCompositionLattice&&) noexcept = default;
+				CommonBridgingCompositionLattice& operator=(const CommonBridgingCompositionLattice&) = default;
+				CommonBridgingCompositionLattice& operator=(CommonBridgingCompositionLattice&&) noexcept = default;
+
+			// Constructors, destructor, and operators
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Property
+
+				const std::vector<ChemicalComposition>& feasibleCompositions() const noexcept;
+
+			// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Methods
+
+				bool isFeasibleComposition(const ChemicalComposition&) const;
+				ChemicalComposition getClosestLowerFeasibleComposition(const ChemicalComposition&) const;
+
+			// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Private methods
+
+			private:
+				void buildClosestLowerIndices();
+				std::size_t toLatticeIndex(const ChemicalComposition&) const;
+
+				ChemicalComposition scanClosestLowerFeasibleComposition(const ChemicalComposition&) const;
+
+				static std::size_t maxLatticeSize() noexcept;
+
+			// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+			private:
+				std::vector<ChemicalComposition> _feasibleCompositions;
+
+				std::vector<size_type> _latticeAtomicNumbers;
+				std::vector<size_type> _latticeMaxCounts;
+				std::vector<std::size_t> _latticeStrides;
+				std::vector<int> _closestLowerIndices;
+			};
+		}
+	}
+}
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Property
+
+inline const std::vector<MathematicalCrystalChemistry::CrystalModel::Constraints::CommonBridgingCompositionLattice::ChemicalComposition>& MathematicalCrystalChemistry::CrystalModel::Constraints::CommonBridgingCompositionLattice::feasibleCompositions() const noexcept
+{
+	return _feasibleCompositions;
+}
+
+// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+inline std::size_t MathematicalCrystalChemistry::CrystalModel::Constraints::CommonBridgingCompositionLattice::maxLatticeSize() noexcept
+{
+	return 65536;
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+
+#endif // !MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_CONSTRAINTS_COMMONBRIDGINGCOMPOSITIONLATTICE_H
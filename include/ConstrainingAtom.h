@@ -1,11 +1,15 @@
 #ifndef MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_COMPONENTS_CONSTRAININGATOM_H
 #define MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_COMPONENTS_CONSTRAININGATOM_H
 
+#include <memory>
 #include <vector>
 #include <unordered_set>
 
 #include "NumericalVector.h"
 #include "AtomIndex.h"
+#include "AtomicNumber.h"
+#include "ChemicalComposition.h"
+#include "FlatChemicalComposition.h"
 #include "IonicAtomicNumber.h"
 
 #include "ConstrainingAtomicSpecies.h"
@@ -24,13 +28,16 @@ namespace MathematicalCrystalChemistry
 			class ConstrainingAtom final
 			{
 				using size_type = unsigned short;
+				using AtomicNumber = ChemToolkit::Generic::AtomicNumber;
 				using IonicAtomicNumber = ChemToolkit::Generic::IonicAtomicNumber;
+				using ChemicalComposition = ChemToolkit::Generic::FlatChemicalComposition;
 				using NumericalVector = MathToolkit::LinearAlgebra::NumericalVector<double, 3>;
 
 				using OriginalAtomIndex = ChemToolkit::Crystallography::OriginalAtomIndex;
 				using TranslatedAtomIndex = ChemToolkit::Crystallography::TranslatedAtomIndex;
 
 				using CoordinationConstraints = MathematicalCrystalChemistry::CrystalModel::Constraints::CoordinationConstraints;
+				using CoordinationConstraintsHandle = std::shared_ptr<const CoordinationConstraints>;
 				using CovalentRadius = MathematicalCrystalChemistry::CrystalModel::Constraints::CovalentRadius;
 				using IonicRadius = MathematicalCrystalChemistry::CrystalModel::Constraints::IonicRadius;
 				using IonicRepulsionRadius = MathematicalCrystalChemistry::CrystalModel::Constraints::IonicRepulsionRadius;
@@ -51,12 +58,12 @@ namespace MathematicalCrystalChemistry
 
 			public:
 				ConstrainingAtom() noexcept;
-				explicit ConstrainingAtom(const ConstrainingAtomicSpecies&) noexcept;
-				ConstrainingAtom(const ConstrainingAtomicSpecies&, const NumericalVector&) noexcept;
+				explicit ConstrainingAtom(const ConstrainingAtomicSpecies&);
+				ConstrainingAtom(const ConstrainingAtomicSpecies&, const NumericalVector&);
 				explicit ConstrainingAtom(const IonicAtomicNumber&);
 				ConstrainingAtom(const IonicAtomicNumber&, const NumericalVector&);
 
-				ConstrainingAtom(const IonicAtomicNumber&, const CoordinationConstraints&, const SphericalAtom&) noexcept;
+				ConstrainingAtom(const IonicAtomicNumber&, const CoordinationConstraintsHandle&, const SphericalAtom&);
 				explicit ConstrainingAtom(const OptimalAtom&);
 
 				~ConstrainingAtom() = default;
@@ -72,14 +79,20 @@ namespace MathematicalCrystalChemistry
 			// Property
 
 				const IonicAtomicNumber& ionicAtomicNumber() const noexcept;
+				size_type speciesIndex() const noexcept;
 				const NumericalVector& cartesianCoordinate() const noexcept;
 				NumericalVector& cartesianCoordinate() noexcept;
 
 				const CoordinationConstraints& coordinationConstraints() const noexcept;
+				const CoordinationConstraintsHandle& coordinationConstraintsHandle() const noexcept;
 				const CovalentRadius& covalentRadius() const noexcept;
 				const IonicRadius& ionicRadius() const noexcept;
 				const IonicRepulsionRadius& ionicRepulsionRadius() const noexcept;
 
+				const ChemicalComposition& coordinationComposition() const noexcept;
+				const ChemicalComposition& covalentCoordinationComposition() const noexcept;
+				const ChemicalComposition& ionicCoordinationComposition() const noexcept;
+
 				std::vector<OriginalAtomIndex> getCovalentBondedOriginalAtomIndices() const noexcept;
 				std::vector<OriginalAtomIndex> getIonicBondedOriginalAtomIndices() const noexcept;
 				std::vector<OriginalAtomIndex> getIonicRepulsedOriginalAtomIndices() const noexcept;
@@ -103,17 +116,17 @@ namespace MathematicalCrystalChemistry
 				bool hasIonicRepulsionWith(const OriginalAtomIndex) const noexcept;
 				bool hasIonicRepulsionWith(const TranslatedAtomIndex&) const noexcept;
 
-				bool createCovalentBondWith(const OriginalAtomIndex) noexcept;
-				bool createCovalentBondWith(const TranslatedAtomIndex&) noexcept;
-				bool createIonicBondWith(const OriginalAtomIndex) noexcept;
-				bool createIonicBondWith(const TranslatedAtomIndex&) noexcept;
+				bool createCovalentBondWith(const OriginalAtomIndex, const AtomicNumber) noexcept;
+				bool createCovalentBondWith(const TranslatedAtomIndex&, const AtomicNumber) noexcept;
+				bool createIonicBondWith(const OriginalAtomIndex, const AtomicNumber) noexcept;
+				bool createIonicBondWith(const TranslatedAtomIndex&, const AtomicNumber) noexcept;
 				bool createIonicRepulsionWith(const OriginalAtomIndex) noexcept;
 				bool createIonicRepulsionWith(const TranslatedAtomIndex&) noexcept;
 
-				bool eraseCovalentBond(const OriginalAtomIndex) noexcept;
-				bool eraseCovalentBond(const TranslatedAtomIndex&) noexcept;
-				bool eraseIonicBond(const OriginalAtomIndex) noexcept;
-				bool eraseIonicBond(const TranslatedAtomIndex&) noexcept;
+				bool eraseCovalentBond(const OriginalAtomIndex, const AtomicNumber) noexcept;
+				bool eraseCovalentBond(const TranslatedAtomIndex&, const AtomicNumber) noexcept;
+				bool eraseIonicBond(const OriginalAtomIndex, const AtomicNumber) noexcept;
+				bool eraseIonicBond(const TranslatedAtomIndex&, const AtomicNumber) noexcept;
 				bool eraseIonicRepulsion(const OriginalAtomIndex) noexcept;
 				bool eraseIonicRepulsion(const TranslatedAtomIndex&) noexcept;
 
@@ -126,9 +139,10 @@ namespace MathematicalCrystalChemistry
 
 			private:
 				IonicAtomicNumber _ionicAtomicNumber;
+				size_type _speciesIndex;
 				NumericalVector _cartesianCoordinate;
 
-				CoordinationConstraints _coordinationConstraints;
+				CoordinationConstraintsHandle _coordinationConstraints;
 				CovalentRadius _covalentRadius;
 				IonicRadius _ionicRadius;
 				IonicRepulsionRadius _ionicRepulsionRadius;
@@ -139,6 +153,10 @@ namespace MathematicalCrystalChemistry
 				std::unordered_set<TranslatedAtomIndex, TranslatedHasher> _covalentBondedTranslatedAtomIndices;
 				std::unordered_set<TranslatedAtomIndex, TranslatedHasher> _ionicBondedTranslatedAtomIndices;
 				std::unordered_set<TranslatedAtomIndex, TranslatedHasher> _ionicRepulsedTranslatedAtomIndices;
+
+				ChemicalComposition _coordinationComposition;
+				ChemicalComposition _covalentCoordinationComposition;
+				ChemicalComposition _ionicCoordinationComposition;
 			};
 
 
@@ -170,6 +188,11 @@ inline const MathematicalCrystalChemistry::CrystalModel::Components::Constrainin
 	return _ionicAtomicNumber;
 }
 
+inline MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::size_type MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::speciesIndex() const noexcept
+{
+	return _speciesIndex;
+}
+
 inline const MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::NumericalVector& MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::cartesianCoordinate() const noexcept
 {
 	return _cartesianCoordinate;
@@ -181,6 +204,11 @@ inline MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom:
 }
 
 inline const MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::CoordinationConstraints& MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::coordinationConstraints() const noexcept
+{
+	return *_coordinationConstraints;
+}
+
+inline const MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::CoordinationConstraintsHandle& MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::coordinationConstraintsHandle() const noexcept
 {
 	return _coordinationConstraints;
 }
@@ -200,6 +228,21 @@ inline const MathematicalCrystalChemistry::CrystalModel::Components::Constrainin
 	return _ionicRepulsionRadius;
 }
 
+inline const MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::ChemicalComposition& MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::coordinationComposition() const noexcept
+{
+	return _coordinationComposition;
+}
+
+inline const MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::ChemicalComposition& MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::covalentCoordinationComposition() const noexcept
+{
+	return _covalentCoordinationComposition;
+}
+
+inline const MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::ChemicalComposition& MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::ionicCoordinationComposition() const noexcept
+{
+	return _ionicCoordinationComposition;
+}
+
 inline std::vector<MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::OriginalAtomIndex> MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::getCovalentBondedOriginalAtomIndices() const noexcept
 {
 	std::vector<OriginalAtomIndex> indices;
@@ -327,24 +370,60 @@ inline bool MathematicalCrystalChemistry::CrystalModel::Components::Constraining
 	return !(_ionicRepulsedTranslatedAtomIndices.find(index) == _ionicRepulsedTranslatedAtomIndices.end());
 }
 
-inline bool MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::createCovalentBondWith(const OriginalAtomIndex index) noexcept
+inline bool MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::createCovalentBondWith(const OriginalAtomIndex index, const AtomicNumber atomicNumber) noexcept
 {
-	return _covalentBondedOriginalAtomIndices.emplace(index).second;
+	if (_covalentBondedOriginalAtomIndices.emplace(index).second)
+	{
+		_covalentCoordinationComposition.add(atomicNumber);
+		_coordinationComposition.add(atomicNumber);
+
+		return true;
+	}
+
+	else
+		return false;
 }
 
-inline bool MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::createCovalentBondWith(const TranslatedAtomIndex& index) noexcept
+inline bool MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::createCovalentBondWith(const TranslatedAtomIndex& index, const AtomicNumber atomicNumber) noexcept
 {
-	return _covalentBondedTranslatedAtomIndices.emplace(index).second;
+	if (_covalentBondedTranslatedAtomIndices.emplace(index).second)
+	{
+		_covalentCoordinationComposition.add(atomicNumber);
+		_coordinationComposition.add(atomicNumber);
+
+		return true;
+	}
+
+	else
+		return false;
 }
 
-inline bool MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::createIonicBondWith(const OriginalAtomIndex index) noexcept
+inline bool MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::createIonicBondWith(const OriginalAtomIndex index, const AtomicNumber atomicNumber) noexcept
 {
-	return _ionicBondedOriginalAtomIndices.emplace(index).second;
+	if (_ionicBondedOriginalAtomIndices.emplace(index).second)
+	{
+		_ionicCoordinationComposition.add(atomicNumber);
+		_coordinationComposition.add(atomicNumber);
+
+		return true;
+	}
+
+	else
+		return false;
 }
 
-inline bool MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::createIonicBondWith(const TranslatedAtomIndex& index) noexcept
+inline bool MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::createIonicBondWith(const TranslatedAtomIndex& index, const AtomicNumber atomicNumber) noexcept
 {
-	return _ionicBondedTranslatedAtomIndices.emplace(index).second;
+	if (_ionicBondedTranslatedAtomIndices.emplace(index).second)
+	{
+		_ionicCoordinationComposition.add(atomicNumber);
+		_coordinationComposition.add(atomicNumber);
+
+		return true;
+	}
+
+	else
+		return false;
 }
 
 inline bool MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::createIonicRepulsionWith(const OriginalAtomIndex index) noexcept
@@ -357,24 +436,60 @@ inline bool MathematicalCrystalChemistry::CrystalModel::Components::Constraining
 	return _ionicRepulsedTranslatedAtomIndices.emplace(index).second;
 }
 
-inline bool MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::eraseCovalentBond(const OriginalAtomIndex index) noexcept
+inline bool MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::eraseCovalentBond(const OriginalAtomIndex index, const AtomicNumber atomicNumber) noexcept
 {
-	return static_cast<bool>(_covalentBondedOriginalAtomIndices.erase(index));
+	if (0 < _covalentBondedOriginalAtomIndices.erase(index))
+	{
+		_covalentCoordinationComposition.remove(atomicNumber);
+		_coordinationComposition.remove(atomicNumber);
+
+		return true;
+	}
+
+	else
+		return false;
 }
 
-inline bool MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::eraseCovalentBond(const TranslatedAtomIndex& index) noexcept
+inline bool MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::eraseCovalentBond(const TranslatedAtomIndex& index, const AtomicNumber atomicNumber) noexcept
 {
-	return static_cast<bool>(_covalentBondedTranslatedAtomIndices.erase(index));
+	if (0 < _covalentBondedTranslatedAtomIndices.erase(index))
+	{
+		_covalentCoordinationComposition.remove(atomicNumber);
+		_coordinationComposition.remove(atomicNumber);
+
+		return true;
+	}
+
+	else
+		return false;
 }
 
-inline bool MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::eraseIonicBond(const OriginalAtomIndex index) noexcept
+inline bool MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::eraseIonicBond(const OriginalAtomIndex index, const AtomicNumber atomicNumber) noexcept
 {
-	return static_cast<bool>(_ionicBondedOriginalAtomIndices.erase(index));
+	if (0 < _ionicBondedOriginalAtomIndices.erase(index))
+	{
+		_ionicCoordinationComposition.remove(atomicNumber);
+		_coordinationComposition.remove(atomicNumber);
+
+		return true;
+	}
+
+	else
+		return false;
 }
 
-inline bool MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::eraseIonicBond(const TranslatedAtomIndex& index) noexcept
+inline bool MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::eraseIonicBond(const TranslatedAtomIndex& index, const AtomicNumber atomicNumber) noexcept
 {
-	return static_cast<bool>(_ionicBondedTranslatedAtomIndices.erase(index));
+	if (0 < _ionicBondedTranslatedAtomIndices.erase(index))
+	{
+		_ionicCoordinationComposition.remove(atomicNumber);
+		_coordinationComposition.remove(atomicNumber);
+
+		return true;
+	}
+
+	else
+		return false;
 }
 
 inline bool MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::eraseIonicRepulsion(const OriginalAtomIndex index) noexcept
@@ -391,12 +506,22 @@ inline void MathematicalCrystalChemistry::CrystalModel::Components::Constraining
 {
 	_covalentBondedOriginalAtomIndices.clear();
 	_covalentBondedTranslatedAtomIndices.clear();
+
+	for (const auto& numAndCount : _covalentCoordinationComposition)
+		_coordinationComposition.remove(numAndCount.first, numAndCount.second);
+
+	_covalentCoordinationComposition.clear();
 }
 
 inline void MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::clearIonicBonds() noexcept
 {
 	_ionicBondedOriginalAtomIndices.clear();
 	_ionicBondedTranslatedAtomIndices.clear();
+
+	for (const auto& numAndCount : _ionicCoordinationComposition)
+		_coordinationComposition.remove(numAndCount.first, numAndCount.second);
+
+	_ionicCoordinationComposition.clear();
 }
 
 inline void MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtom::clearIonicRepulsions() noexcept
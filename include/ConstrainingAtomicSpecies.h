@@ -2,6 +2,7 @@
 #define MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_COMPONENTS_CONSTRAININGATOMSPECIES_H
 
 #include <cmath>
+#include <memory>
 #include <vector>
 #include <unordered_set>
 
@@ -23,6 +24,7 @@ namespace MathematicalCrystalChemistry
 			class ConstrainingAtomicSpecies final
 			{
 				using CoordinationConstraints = MathematicalCrystalChemistry::CrystalModel::Constraints::CoordinationConstraints;
+				using CoordinationConstraintsHandle = std::shared_ptr<const CoordinationConstraints>;
 				using CovalentRadius = MathematicalCrystalChemistry::CrystalModel::Constraints::CovalentRadius;
 				using IonicRadius = MathematicalCrystalChemistry::CrystalModel::Constraints::IonicRadius;
 				using IonicRepulsionRadius = MathematicalCrystalChemistry::CrystalModel::Constraints::IonicRepulsionRadius;
@@ -59,6 +61,7 @@ namespace MathematicalCrystalChemistry
 
 				const IonicAtomicNumber& ionicAtomicNumber() const noexcept;
 				const CoordinationConstraints& coordinationConstraints() const noexcept;
+				const CoordinationConstraintsHandle& coordinationConstraintsHandle() const noexcept;
 
 				const CovalentRadius& covalentRadius() const noexcept;
 				const IonicRadius& ionicRadius() const noexcept;
@@ -66,7 +69,7 @@ namespace MathematicalCrystalChemistry
 
 
 				void setIonicAtomicNumber(const IonicAtomicNumber&) noexcept;
-				void setCoordinationConstraints(const CoordinationConstraints&) noexcept;
+				void setCoordinationConstraints(const CoordinationConstraints&);
 
 				void setCovalentRadius(const CovalentRadius&) noexcept;
 				void setIonicRadius(const IonicRadius&) noexcept;
@@ -81,12 +84,14 @@ namespace MathematicalCrystalChemistry
 				std::string toHashString() const;
 				std::string toElementSymbol() const;
 
+				static const CoordinationConstraintsHandle& emptyCoordinationConstraints() noexcept;
+
 			// Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 
 			private:
 				IonicAtomicNumber _ionicAtomicNumber;
-				CoordinationConstraints _coordinationConstraints;
+				CoordinationConstraintsHandle _coordinationConstraints;
 
 				CovalentRadius _covalentRadius;
 				IonicRadius _ionicRadius;
@@ -144,6 +149,11 @@ inline const MathematicalCrystalChemistry::CrystalModel::Components::Constrainin
 }
 
 inline const MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtomicSpecies::CoordinationConstraints& MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtomicSpecies::coordinationConstraints() const noexcept
+{
+	return *_coordinationConstraints;
+}
+
+inline const MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtomicSpecies::CoordinationConstraintsHandle& MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtomicSpecies::coordinationConstraintsHandle() const noexcept
 {
 	return _coordinationConstraints;
 }
@@ -168,9 +178,9 @@ inline void MathematicalCrystalChemistry::CrystalModel::Components::Constraining
 	_ionicAtomicNumber = number;
 }
 
-inline void MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtomicSpecies::setCoordinationConstraints(const CoordinationConstraints& constraints) noexcept
+inline void MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtomicSpecies::setCoordinationConstraints(const CoordinationConstraints& constraints)
 {
-	_coordinationConstraints = constraints;
+	_coordinationConstraints = std::make_shared<const CoordinationConstraints>(constraints);
 }
 
 inline void MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtomicSpecies::setCovalentRadius(const CovalentRadius& radius) noexcept
@@ -4,8 +4,10 @@
 #include <cmath>
 #include <utility>
 #include <random>
+#include <vector>
 
 #include "LinkedPolyhedraRetriever.h"
+#include "StructuralHash.h"
 
 
 namespace MathematicalCrystalChemistry
@@ -43,8 +45,10 @@ namespace MathematicalCrystalChemistry
 			// Property
 
 				double minimumFeasiblePackingFraction() const noexcept;
+				bool needReductionValidation() const noexcept;
 
 				void setMinimumFeasiblePackingFraction(const double);
+				void setReductionValidationNecessity(const bool) noexcept;
 
 			// Property
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -73,6 +77,8 @@ namespace MathematicalCrystalChemistry
 				bool hasFeasibleUnitCell() const;
 				double getPackingFraction() const;
 
+				StructuralHash toTopologicalHash() const;
+
 			// Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -84,6 +90,9 @@ namespace MathematicalCrystalChemistry
 
 				double getAtomicSphereVolume() const;
 
+				void validateReducedConstraints(const ConstrainingCrystalStructure& remappedStructure, const std::vector<double>& unreducedBondLengths) const;
+				std::vector<double> getChemicalBondLengths() const;
+
 			// Private methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -95,11 +104,15 @@ namespace MathematicalCrystalChemistry
 
 				bool willChooseOriginalAtomIndex(const ConstrainerIndices<TranslatedAtomIndex>&) const;
 
+				ChemicalBondType classifyChemicalBond(const OriginalAtomIndex, const OriginalAtomIndex) const noexcept;
+				ChemicalBondType classifyChemicalBond(const OriginalAtomIndex, const TranslatedAtomIndex&) const noexcept;
+
 			// Private utility
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 
 			private:
 				double _minimumFeasiblePackingFraction;
+				bool _needReductionValidation;
 
 				mutable std::mt19937 m_randomEngine;
 
@@ -123,6 +136,11 @@ inline double MathematicalCrystalChemistry::CrystalModel::Components::Constraini
 	return _minimumFeasiblePackingFraction;
 }
 
+inline bool MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingCrystalStructure::needReductionValidation() const noexcept
+{
+	return _needReductionValidation;
+}
+
 inline void MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingCrystalStructure::setMinimumFeasiblePackingFraction(const double val)
 {
 	if (val < 0.0)
@@ -131,6 +149,11 @@ inline void MathematicalCrystalChemistry::CrystalModel::Components::Constraining
 		_minimumFeasiblePackingFraction = val;
 }
 
+inline void MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingCrystalStructure::setReductionValidationNecessity(const bool necessity) noexcept
+{
+	_needReductionValidation = necessity;
+}
+
 // Property
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -0,0 +1,207 @@
+#ifndef MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_CONSTRAINTS_CONSTRAININGSPECIESDICTIONARY_H
+#define MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_CONSTRAINTS_CONSTRAININGSPECIESDICTIONARY_H
+
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+#include "ChemicalComposition.h"
+
+#include "IonicAtomicNumber.h"
+
+#include "ConstrainingAtomicSpecies.h"
+
+
+namespace MathematicalCrystalChemistry
+{
+	namespace CrystalModel
+	{
+		namespace Constraints
+		{
+			class ConstrainingSpeciesDictionary
+			{
+			public:
+				using size_type = unsigned short;
+
+			private:
+				using IonicAtomicNumber = ChemToolkit::Generic::IonicAtomicNumber;
+				using ChemicalComposition = ChemToolkit::Generic::ChemicalComposition<IonicAtomicNumber>;
+
+				using ConstrainingAtomicSpecies = MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtomicSpecies;
+				using ConstrainingChemicalComposition = ChemToolkit::Generic::ChemicalComposition<ConstrainingAtomicSpecies>;
+
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Constructors, destructor, and operators
+
+			private:
+				ConstrainingSpeciesDictionary() noexcept = delete;
+
+			public:
+				virtual ~ConstrainingSpeciesDictionary() = default;
+
+				ConstrainingSpeciesDictionary(const ConstrainingSpeciesDictionary&) = default;
+				ConstrainingSpeciesDictionary(ConstrainingSpeciesDictionary&&) noexcept = default;
+				ConstrainingSpeciesDictionary& operator=(const ConstrainingSpeciesDictionary&) = default;
+				ConstrainingSpeciesDictionary& operator=(ConstrainingSpeciesDictionary&&) noexcept = default;
+
+			// Constructors, destructor, and operators
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Methods
+
+				static void initialize(const ChemicalComposition& crystalComposition);
+				static void initialize(const ConstrainingChemicalComposition& constrainingCrystalComposition);
+
+				static size_type numSpecies() noexcept;
+				static size_type maxNumSpecies() noexcept;
+				static size_type invalidSpeciesIndex() noexcept;
+
+				static size_type getSpeciesIndex(const IonicAtomicNumber&);
+				static ConstrainingAtomicSpecies getConstrainingAtomicSpecies(const IonicAtomicNumber&);
+
+				static bool isIonicAttractive(const size_type, const size_type) noexcept;
+				static bool isIonicRepulsive(const size_type, const size_type) noexcept;
+				static bool isInnateChemicalBondable(const size_type, const size_type) noexcept;
+				static bool isInnateCovalentBondable(const size_type, const size_type) noexcept;
+				static bool isInnateIonicBondable(const size_type, const size_type) noexcept;
+
+			// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Private methods
+
+			private:
+				static size_type findSpeciesIndex(const IonicAtomicNumber&) noexcept;
+				static size_type internSpecies(const ConstrainingAtomicSpecies&);
+				static void setPairTables(const size_type, const size_type) noexcept;
+
+				static std::size_t toPairIndex(const size_type, const size_type) noexcept;
+
+			// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+			private:
+				static std::vector<ConstrainingAtomicSpecies> s_constrainingAtomicSpecies;
+				static std::atomic<size_type> s_numSpecies;
+				static std::mutex s_internMutex;
+
+				static std::vector<char> s_ionicAttractivities;
+				static std::vector<char> s_ionicRepulsivities;
+				static std::vector<char> s_innateChemicalBondabilities;
+				static std::vector<char> s_innateCovalentBondabilities;
+				static std::vector<char> s_innateIonicBondabilities;
+			};
+		}
+	}
+}
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Methods
+
+inline MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::size_type MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::numSpecies() noexcept
+{
+	return s_numSpecies.load(std::memory_order_acquire);
+}
+
+inline MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::size_type MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::maxNumSpecies() noexcept
+{
+	return 128;
+}
+
+inline MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::size_type MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::invalidSpeciesIndex() noexcept
+{
+	return std::numeric_limits<size_type>::max();
+}
+
+inline MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::size_type MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::getSpeciesIndex(const IonicAtomicNumber& ionicAtomicNumber)
+{
+	size_type speciesIndex = findSpeciesIndex(ionicAtomicNumber);
+
+	if (speciesIndex == invalidSpeciesIndex())
+		return internSpecies(ConstrainingAtomicSpecies{ ionicAtomicNumber });
+	else
+		return speciesIndex;
+}
+
+inline MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::ConstrainingAtomicSpecies MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::getConstrainingAtomicSpecies(const IonicAtomicNumber& ionicAtomicNumber)
+{
+	return s_constrainingAtomicSpecies[getSpeciesIndex(ionicAtomicNumber)];
+}
+
+inline bool MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::isIonicAttractive(const size_type speciesIndexA, const size_type speciesIndexB) noexcept
+{
+	return (s_ionicAttractivities[toPairIndex(speciesIndexA, speciesIndexB)] != 0);
+}
+
+inline bool MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::isIonicRepulsive(const size_type speciesIndexA, const size_type speciesIndexB) noexcept
+{
+	return (s_ionicRepulsivities[toPairIndex(speciesIndexA, speciesIndexB)] != 0);
+}
+
+inline bool MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::isInnateChemicalBondable(const size_type speciesIndexA, const size_type speciesIndexB) noexcept
+{
+	return (s_innateChemicalBondabilities[toPairIndex(speciesIndexA, speciesIndexB)] != 0);
+}
+
+inline bool MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::isInnateCovalentBondable(const size_type speciesIndexA, const size_type speciesIndexB) noexcept
+{
+	return (s_innateCovalentBondabilities[toPairIndex(speciesIndexA, speciesIndexB)] != 0);
+}
+
+inline bool MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::isInnateIonicBondable(const size_type speciesIndexA, const size_type speciesIndexB) noexcept
+{
+	return (s_innateIonicBondabilities[toPairIndex(speciesIndexA, speciesIndexB)] != 0);
+}
+
+// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+inline MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::size_type MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::findSpeciesIndex(const IonicAtomicNumber& ionicAtomicNumber) noexcept
+{
+	const size_type numInternedSpecies = s_numSpecies.load(std::memory_order_acquire);
+
+	for (size_type speciesIndex = 0; speciesIndex < numInternedSpecies; ++speciesIndex)
+	{
+		if (s_constrainingAtomicSpecies[speciesIndex].ionicAtomicNumber() == ionicAtomicNumber)
+			return speciesIndex;
+	}
+
+	return invalidSpeciesIndex();
+}
+
+inline std::size_t MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::toPairIndex(const size_type speciesIndexA, const size_type speciesIndexB) noexcept
+{
+	return ((static_cast<std::size_t>(speciesIndexA) * maxNumSpecies()) + speciesIndexB);
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+#endif // !MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_CONSTRAINTS_CONSTRAININGSPECIESDICTIONARY_H
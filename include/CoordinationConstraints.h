@@ -6,6 +6,7 @@
 
 #include "AtomicNumber.h"
 #include "ChemicalComposition.h"
+#include "FlatChemicalComposition.h"
 
 #include "IonicAtomicNumber.h"
 
@@ -23,7 +24,7 @@ namespace MathematicalCrystalChemistry
 
 				using AtomicNumber = ChemToolkit::Generic::AtomicNumber;
 				using IonicAtomicNumber = ChemToolkit::Generic::IonicAtomicNumber;
-				using ChemicalComposition = ChemToolkit::Generic::ChemicalComposition<AtomicNumber>;
+				using ChemicalComposition = ChemToolkit::Generic::FlatChemicalComposition;
 
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 			// Constructors, destructor, and operators
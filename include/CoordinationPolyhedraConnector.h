@@ -75,7 +75,7 @@ namespace MathematicalCrystalChemistry
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 				// Private utility
 
-					std::set<BasicChemicalComposition> getPossibleBridgingCompositionDictionary(const std::set<BasicChemicalComposition>&, const std::set<BasicChemicalComposition>&) const;
+					std::set<BasicChemicalComposition> getPossibleBridgingCompositionDictionary(const std::set<FlatChemicalComposition>&, const std::set<FlatChemicalComposition>&) const;
 					void initializeBridgingComposition(BasicChemicalComposition& bridgingComposition, const BasicChemicalComposition& maximumBridgingComposition) const;
 					bool advanceBridgingComposition(BasicChemicalComposition& bridgingComposition, const BasicChemicalComposition& maximumBridgingComposition) const;
 
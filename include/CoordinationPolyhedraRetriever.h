@@ -5,6 +5,7 @@
 
 #include "AtomicNumber.h"
 #include "ChemicalComposition.h"
+#include "FlatChemicalComposition.h"
 
 #include "CrystallineConstraintManager.h"
 
@@ -21,7 +22,7 @@ namespace MathematicalCrystalChemistry
 				{
 				protected:
 					using AtomicNumber = ChemToolkit::Generic::AtomicNumber;
-					using ChemicalComposition = ChemToolkit::Generic::ChemicalComposition<AtomicNumber>;
+					using ChemicalComposition = ChemToolkit::Generic::FlatChemicalComposition;
 
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 				// Constructors, destructor, and operators
@@ -58,9 +59,9 @@ namespace MathematicalCrystalChemistry
 					bool hasFeasibleCoordinationComposition(const OriginalAtomIndex) const;
 					bool hasInfeasibleChemicalBonds(const OriginalAtomIndex, const double errorRate) const;
 
-					ChemicalComposition getCoordinationComposition(const OriginalAtomIndex) const;
-					ChemicalComposition getCovalentCoordinationComposition(const OriginalAtomIndex) const;
-					ChemicalComposition getIonicCoordinationComposition(const OriginalAtomIndex) const;
+					const ChemicalComposition& getCoordinationComposition(const OriginalAtomIndex) const noexcept;
+					const ChemicalComposition& getCovalentCoordinationComposition(const OriginalAtomIndex) const noexcept;
+					const ChemicalComposition& getIonicCoordinationComposition(const OriginalAtomIndex) const noexcept;
 					ChemicalComposition toChemicalComposition(const std::vector<TranslatedAtomIndex>& translatedIndices) const;
 					ChemicalComposition toCoordinationComposition(const std::vector<std::pair<double, OriginalAtomIndex>>&, const std::vector<std::pair<double, TranslatedAtomIndex>>&) const;
 
@@ -116,61 +117,19 @@ inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::Co
 		eraseIonicBond(originalAtomIndex, coordinatedIndex);
 }
 
-inline MathematicalCrystalChemistry::CrystalModel::Components::Internal::CoordinationPolyhedraRetriever::ChemicalComposition MathematicalCrystalChemistry::CrystalModel::Components::Internal::CoordinationPolyhedraRetriever::getCoordinationComposition(const OriginalAtomIndex centralAtomIndex) const
+inline const MathematicalCrystalChemistry::CrystalModel::Components::Internal::CoordinationPolyhedraRetriever::ChemicalComposition& MathematicalCrystalChemistry::CrystalModel::Components::Internal::CoordinationPolyhedraRetriever::getCoordinationComposition(const OriginalAtomIndex centralAtomIndex) const noexcept
 {
-	ChemicalComposition coordinationComposition;
-	{
-		const ConstrainingAtom& constrainingAtom = atoms()[centralAtomIndex];
-
-
-		for (const auto originalIndex : constrainingAtom.getCovalentBondedOriginalAtomIndices())
-			coordinationComposition.add(atoms()[originalIndex].ionicAtomicNumber().atomicNumber());
-
-		for (const auto& translatedIndex : constrainingAtom.getCovalentBondedTranslatedAtomIndices())
-			coordinationComposition.add(atoms()[translatedIndex.originalIndex()].ionicAtomicNumber().atomicNumber());
-
-		for (const auto originalIndex : constrainingAtom.getIonicBondedOriginalAtomIndices())
-			coordinationComposition.add(atoms()[originalIndex].ionicAtomicNumber().atomicNumber());
-
-		for (const auto& translatedIndex : constrainingAtom.getIonicBondedTranslatedAtomIndices())
-			coordinationComposition.add(atoms()[translatedIndex.originalIndex()].ionicAtomicNumber().atomicNumber());
-	}
-
-	return coordinationComposition;
+	return atoms()[centralAtomIndex].coordinationComposition();
 }
 
-inline MathematicalCrystalChemistry::CrystalModel::Components::Internal::CoordinationPolyhedraRetriever::ChemicalComposition MathematicalCrystalChemistry::CrystalModel::Components::Internal::CoordinationPolyhedraRetriever::getCovalentCoordinationComposition(const OriginalAtomIndex centralAtomIndex) const
+inline const MathematicalCrystalChemistry::CrystalModel::Components::Internal::CoordinationPolyhedraRetriever::ChemicalComposition& MathematicalCrystalChemistry::CrystalModel::Components::Internal::CoordinationPolyhedraRetriever::getCovalentCoordinationComposition(const OriginalAtomIndex centralAtomIndex) const noexcept
 {
-	ChemicalComposition coordinationComposition;
-	{
-		const ConstrainingAtom& constrainingAtom = atoms()[centralAtomIndex];
-
-
-		for (const auto originalIndex : constrainingAtom.getCovalentBondedOriginalAtomIndices())
-			coordinationComposition.add(atoms()[originalIndex].ionicAtomicNumber().atomicNumber());
-
-		for (const auto& translatedIndex : constrainingAtom.getCovalentBondedTranslatedAtomIndices())
-			coordinationComposition.add(atoms()[translatedIndex.originalIndex()].ionicAtomicNumber().atomicNumber());
-	}
-
-	return coordinationComposition;
+	return atoms()[centralAtomIndex].covalentCoordinationComposition();
 }
 
-inline MathematicalCrystalChemistry::CrystalModel::Components::Internal::CoordinationPolyhedraRetriever::ChemicalComposition MathematicalCrystalChemistry::CrystalModel::Components::Internal::CoordinationPolyhedraRetriever::getIonicCoordinationComposition(const OriginalAtomIndex centralAtomIndex) const
+inline const MathematicalCrystalChemistry::CrystalModel::Components::Internal::CoordinationPolyhedraRetriever::ChemicalComposition& MathematicalCrystalChemistry::CrystalModel::Components::Internal::CoordinationPolyhedraRetriever::getIonicCoordinationComposition(const OriginalAtomIndex centralAtomIndex) const noexcept
 {
-	ChemicalComposition coordinationComposition;
-	{
-		const ConstrainingAtom& constrainingAtom = atoms()[centralAtomIndex];
-
-
-		for (const auto originalIndex : constrainingAtom.getIonicBondedOriginalAtomIndices())
-			coordinationComposition.add(atoms()[originalIndex].ionicAtomicNumber().atomicNumber());
-
-		for (const auto& translatedIndex : constrainingAtom.getIonicBondedTranslatedAtomIndices())
-			coordinationComposition.add(atoms()[translatedIndex.originalIndex()].ionicAtomicNumber().atomicNumber());
-	}
-
-	return coordinationComposition;
+	return atoms()[centralAtomIndex].ionicCoordinationComposition();
 }
 
 inline MathematicalCrystalChemistry::CrystalModel::Components::Internal::CoordinationPolyhedraRetriever::ChemicalComposition MathematicalCrystalChemistry::CrystalModel::Components::Internal::CoordinationPolyhedraRetriever::toChemicalComposition(const std::vector<TranslatedAtomIndex>& translatedIndices) const
@@ -50,6 +50,7 @@ namespace MathematicalCrystalChemistry
 			const StructuralOptimizationParameters& globalStructuralOptimizationParameters() const noexcept;
 			const StructuralOptimizationParameters& localStructuralOptimizationParameters() const noexcept;
 			const StructuralOptimizationParameters& preciseStructuralOptimizationParameters() const noexcept;
+			bool needEarlyDuplicateRejection() const noexcept;
 
 
 			void setMaxTotalStructuralOptimizing(const size_type) noexcept;
@@ -61,6 +62,7 @@ namespace MathematicalCrystalChemistry
 			void setGlobalStructuralOptimizationParameters(const StructuralOptimizationParameters&) noexcept;
 			void setLocalStructuralOptimizationParameters(const StructuralOptimizationParameters&) noexcept;
 			void setPreciseStructuralOptimizationParameters(const StructuralOptimizationParameters&) noexcept;
+			void setEarlyDuplicateRejectionNecessity(const bool) noexcept;
 
 		// Property
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -73,7 +75,15 @@ namespace MathematicalCrystalChemistry
 			bool isValid() const noexcept;
 
 			// Methods
-	// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Private methods
+
+		private:
+			bool toNecessity(const std::string&) const;
+
+		// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
 
 		private:
 			size_type _maxTotalStructuralOptimizing;
@@ -86,6 +96,8 @@ namespace MathematicalCrystalChemistry
 			StructuralOptimizationParameters _localStructuralOptimizationParameters;
 			StructuralOptimizationParameters _preciseStructuralOptimizationParameters;
 
+			bool _needEarlyDuplicateRejection;
+
 
 			static size_type s_defaultMaxCeaselessGlobalStructuralOptimizing;
 		};
@@ -136,6 +148,11 @@ inline const MathematicalCrystalChemistry::Design::Optimization::StructuralOptim
 	return _preciseStructuralOptimizationParameters;
 }
 
+inline bool MathematicalCrystalChemistry::Design::CrystalDesignParameters::needEarlyDuplicateRejection() const noexcept
+{
+	return _needEarlyDuplicateRejection;
+}
+
 inline void MathematicalCrystalChemistry::Design::CrystalDesignParameters::setMaxTotalStructuralOptimizing(const size_type val) noexcept
 {
 	_maxTotalStructuralOptimizing = val;
@@ -179,6 +196,11 @@ inline void MathematicalCrystalChemistry::Design::CrystalDesignParameters::setPr
 	_preciseStructuralOptimizationParameters = parameters;
 }
 
+inline void MathematicalCrystalChemistry::Design::CrystalDesignParameters::setEarlyDuplicateRejectionNecessity(const bool necessity) noexcept
+{
+	_needEarlyDuplicateRejection = necessity;
+}
+
 // Property
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
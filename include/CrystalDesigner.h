@@ -1,6 +1,10 @@
 #ifndef MATHEMATICALCRYSTALCHEMISTRY_DESIGN_CRYSTALDESIGNER_H
 #define MATHEMATICALCRYSTALCHEMISTRY_DESIGN_CRYSTALDESIGNER_H
 
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include "ChemicalComposition.h"
@@ -14,6 +18,7 @@
 #include "ConstrainingAtomicSpecies.h"
 #include "ConstrainingCrystalStructure.h"
 #include "ObjectiveCrystalStructure.h"
+#include "StructuralHash.h"
 
 
 namespace MathematicalCrystalChemistry
@@ -34,6 +39,7 @@ namespace MathematicalCrystalChemistry
 			using ChemicalComposition = ChemToolkit::Generic::ChemicalComposition<ConstrainingAtomicSpecies>;			
 			using ConstrainingCrystalStructure = MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingCrystalStructure;
 			using ObjectiveCrystalStructure = MathematicalCrystalChemistry::CrystalModel::Components::ObjectiveCrystalStructure;
+			using StructuralHash = MathematicalCrystalChemistry::CrystalModel::Components::StructuralHash;
 
 
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -56,6 +62,9 @@ namespace MathematicalCrystalChemistry
 		// Property
 
 			const StructuralOptimizationParameters& preciseStructuralOptimizationParameters() const noexcept;
+			static size_type countTriggeredUnitCellReductions() noexcept;
+			static size_type countAvoidedUnitCellReductions() noexcept;
+			bool isRejectedAsDuplicate() const noexcept;
 
 			void setCrystalDesignParameters(const CrystalDesignParameters&);
 			void setProductChemicalComposition();
@@ -72,6 +81,11 @@ namespace MathematicalCrystalChemistry
 			void execute(ConstrainingCrystalStructure& initialStructure) const;
 			void execute(ConstrainingCrystalStructure& initialStructure, CrystalDesignRecorder&) const;
 
+			static size_type countTopologyLookups() noexcept;
+			static size_type countDuplicateRejections() noexcept;
+			static void initializeDuplicateRejectionStatistics() noexcept;
+			static void initializeUnitCellReductionStatistics() noexcept;
+
 		// Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -90,11 +104,17 @@ namespace MathematicalCrystalChemistry
 			bool applyPreciseStructuralOptimization(ObjectiveCrystalStructure&, CrystalDesignRecorder&) const;
 
 			bool isFeasible(ConstrainingCrystalStructure&) const;
+			bool isSkewedUnitCell(const ConstrainingCrystalStructure&) const;
 
 			void reduceStructure(ConstrainingCrystalStructure&) const;
 			void updateConstraints(ConstrainingCrystalStructure&) const;
 			void forceUpdateConstraints(ConstrainingCrystalStructure&) const;
 
+			bool isKnownTopology(const ConstrainingCrystalStructure&) const;
+			void registerTopology(const ConstrainingCrystalStructure&) const;
+
+			static StructuralHash toCompositionHash(const ConstrainingCrystalStructure&);
+
 		// Private methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 
@@ -102,6 +122,7 @@ namespace MathematicalCrystalChemistry
 			size_type _maxTotalStructuralOptimizing;
 			size_type _maxCeaselessGlobalStructuralOptimizing;
 			GeometricalConstraintParameters _geometricalConstraintParameters;
+			bool _needEarlyDuplicateRejection;
 
 			RandomStructureGenerator _randomStructureGenerator;
 			CrystalOptimizer _globalStructuralOptimizer;
@@ -113,6 +134,18 @@ namespace MathematicalCrystalChemistry
 			mutable size_type m_ceaselessGlobalStructuralOptimizing;
 			mutable size_type m_interatomicDistanceTrackerUsing;
 			mutable size_type m_unitCellUsing;
+
+			mutable StructuralHash m_topologicalHash;
+			mutable bool m_isRejectedAsDuplicate;
+
+
+			static std::unordered_map<StructuralHash, std::unordered_set<StructuralHash, StructuralHash::Hasher>, StructuralHash::Hasher> s_knownTopologies;
+			static size_type s_numTopologyLookups;
+			static size_type s_numDuplicateRejections;
+			static std::mutex s_topologyMutex;
+
+			static std::atomic<size_type> s_numTriggeredUnitCellReductions;
+			static std::atomic<size_type> s_numAvoidedUnitCellReductions;
 		};
 	}
 }
@@ -131,11 +164,27 @@ inline const MathematicalCrystalChemistry::Design::CrystalDesigner::StructuralOp
 	return _preciseStructuralOptimizer.structuralOptimizationParameters();
 }
 
+inline MathematicalCrystalChemistry::Design::CrystalDesigner::size_type MathematicalCrystalChemistry::Design::CrystalDesigner::countTriggeredUnitCellReductions() noexcept
+{
+	return s_numTriggeredUnitCellReductions;
+}
+
+inline MathematicalCrystalChemistry::Design::CrystalDesigner::size_type MathematicalCrystalChemistry::Design::CrystalDesigner::countAvoidedUnitCellReductions() noexcept
+{
+	return s_numAvoidedUnitCellReductions;
+}
+
+inline bool MathematicalCrystalChemistry::Design::CrystalDesigner::isRejectedAsDuplicate() const noexcept
+{
+	return m_isRejectedAsDuplicate;
+}
+
 inline void MathematicalCrystalChemistry::Design::CrystalDesigner::setCrystalDesignParameters(const CrystalDesignParameters& parameters)
 {
 	_maxTotalStructuralOptimizing = parameters.maxTotalStructuralOptimizing();
 	_maxCeaselessGlobalStructuralOptimizing = parameters.maxCeaselessGlobalStructuralOptimizing();
 	_geometricalConstraintParameters = parameters.geometricalConstraintParameters();
+	_needEarlyDuplicateRejection = parameters.needEarlyDuplicateRejection();
 
 	_randomStructureGenerator.setRandomStructureGenerationParameters(parameters.initialStructureGenerationParameters().randomStructureGenerationParameters());
 	_globalStructuralOptimizer.setParameters(parameters.globalStructuralOptimizationParameters(), parameters.geometricalConstraintParameters());
@@ -318,6 +367,28 @@ inline bool MathematicalCrystalChemistry::Design::CrystalDesigner::isFeasible(Co
 	}
 }
 
+inline bool MathematicalCrystalChemistry::Design::CrystalDesigner::isSkewedUnitCell(const ConstrainingCrystalStructure& constrainingCrystalStructure) const
+{
+	if (_geometricalConstraintParameters.maxUnitCellSkewness() < constrainingCrystalStructure.unitCell().getOrthogonalityDefect())
+		return true;
+
+	else
+	{
+		const double minimumAngle = _geometricalConstraintParameters.minimumUnitCellAngle() * MathToolkit::Generic::MathConstants::getPi() / 180.0;
+		const double maximumAngle = MathToolkit::Generic::MathConstants::getPi() - minimumAngle;
+
+		ChemToolkit::Crystallography::UnitCell::LatticeParameters latticeParameters = constrainingCrystalStructure.unitCell().getLatticeParameters();
+
+		for (const double angle : { latticeParameters.angles.alpha, latticeParameters.angles.beta, latticeParameters.angles.gamma })
+		{
+			if ((angle < minimumAngle) || (maximumAngle < angle))
+				return true;
+		}
+
+		return false;
+	}
+}
+
 inline void MathematicalCrystalChemistry::Design::CrystalDesigner::reduceStructure(ConstrainingCrystalStructure& constrainingCrystalStructure) const
 {
 	constrainingCrystalStructure.reduceStructure();
@@ -339,17 +410,22 @@ inline void MathematicalCrystalChemistry::Design::CrystalDesigner::reduceStructu
 
 inline void MathematicalCrystalChemistry::Design::CrystalDesigner::updateConstraints(ConstrainingCrystalStructure& constrainingCrystalStructure) const
 {
-	if (_geometricalConstraintParameters.unitCellReductionTimeout() < m_unitCellUsing)
+	if (isSkewedUnitCell(constrainingCrystalStructure))
 	{
 		constrainingCrystalStructure.reduceStructure();
+		++s_numTriggeredUnitCellReductions;
 		{
 			if (constrainingCrystalStructure.hasFeasibleUnitCell())
 			{
-				constrainingCrystalStructure.updateTracingIndexPairs();
+				if (_geometricalConstraintParameters.interatomicDistanceTracerTimeout() < m_interatomicDistanceTrackerUsing)
+				{
+					constrainingCrystalStructure.updateTracingIndexPairs();
+					m_interatomicDistanceTrackerUsing = 0;
+				}
+
 				constrainingCrystalStructure.createInteratomicDistanceConstraints();
 				constrainingCrystalStructure.eraseInfeasibleIonicPolyhedraConnections();
 
-				m_interatomicDistanceTrackerUsing = 0;
 				m_unitCellUsing = 0;
 			}
 
@@ -360,6 +436,12 @@ inline void MathematicalCrystalChemistry::Design::CrystalDesigner::updateConstra
 
 	else
 	{
+		if (_geometricalConstraintParameters.unitCellReductionTimeout() < m_unitCellUsing)
+		{
+			++s_numAvoidedUnitCellReductions;
+			m_unitCellUsing = 0;
+		}
+
 		if (constrainingCrystalStructure.hasFeasibleUnitCell())
 		{
 			if (_geometricalConstraintParameters.interatomicDistanceTracerTimeout() < m_interatomicDistanceTrackerUsing)
@@ -5,8 +5,10 @@
 #include <filesystem>
 
 #include "GeometricalConstraintParameters.h"
+#include "NearDuplicateDetectionParameters.h"
 
 #include "CrystalOptimalityAnalysisParameters.h"
+#include "CrystalScreeningParameters.h"
 #include "IsotypicCrystalExtractionParameters.h"
 #include "PromisingCrystalExtractionParameters.h"
 
@@ -18,8 +20,10 @@ namespace MathematicalCrystalChemistry
 		class CrystalExtractionTask
 		{
 			using GeometricalConstraintParameters = MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters;
+			using NearDuplicateDetectionParameters = MathematicalCrystalChemistry::Design::Diagnostics::NearDuplicateDetectionParameters;
 
 			using CrystalOptimalityAnalysisParameters = MathematicalCrystalChemistry::Analysis::CrystalOptimalityAnalysisParameters;
+			using CrystalScreeningParameters = MathematicalCrystalChemistry::Analysis::CrystalScreeningParameters;
 			using IsotypicCrystalExtractionParameters = MathematicalCrystalChemistry::Analysis::IsotypicCrystalExtractionParameters;
 			using PromisingCrystalExtractionParameters = MathematicalCrystalChemistry::Analysis::PromisingCrystalExtractionParameters;
 
@@ -45,7 +49,9 @@ namespace MathematicalCrystalChemistry
 
 			double spaceGroupPrecision() const noexcept;
 			const GeometricalConstraintParameters& geometricalConstraintParameters() const noexcept;
+			const NearDuplicateDetectionParameters& nearDuplicateDetectionParameters() const noexcept;
 
+			const CrystalScreeningParameters& crystalScreeningParameters() const noexcept;
 			const CrystalOptimalityAnalysisParameters& crystalOptimalityAnalysisParameters() const noexcept;
 			const IsotypicCrystalExtractionParameters& isotypicCrystalExtractionParameters() const noexcept;
 			const PromisingCrystalExtractionParameters& promisingCrystalExtractionParameters() const noexcept;
@@ -85,7 +91,9 @@ namespace MathematicalCrystalChemistry
 
 			double _spaceGroupPrecision;
 			GeometricalConstraintParameters _geometricalConstraintParameters;
+			NearDuplicateDetectionParameters _nearDuplicateDetectionParameters;
 
+			CrystalScreeningParameters _crystalScreeningParameters;
 			CrystalOptimalityAnalysisParameters _crystalOptimalityAnalysisParameters;
 			IsotypicCrystalExtractionParameters _isotypicCrystalExtractionParameters;
 			PromisingCrystalExtractionParameters _promisingCrystalExtractionParameters;
@@ -124,11 +132,21 @@ inline const MathematicalCrystalChemistry::Design::Optimization::GeometricalCons
 	return _geometricalConstraintParameters;
 }
 
+inline const MathematicalCrystalChemistry::Design::Diagnostics::NearDuplicateDetectionParameters& MathematicalCrystalChemistry::Extraction::CrystalExtractionTask::nearDuplicateDetectionParameters() const noexcept
+{
+	return _nearDuplicateDetectionParameters;
+}
+
 inline double MathematicalCrystalChemistry::Extraction::CrystalExtractionTask::defaultSpaceGroupPrecision() noexcept
 {
 	return s_defaultSpaceGroupPrecision;
 }
 
+inline const MathematicalCrystalChemistry::Analysis::CrystalScreeningParameters& MathematicalCrystalChemistry::Extraction::CrystalExtractionTask::crystalScreeningParameters() const noexcept
+{
+	return _crystalScreeningParameters;
+}
+
 inline const MathematicalCrystalChemistry::Analysis::CrystalOptimalityAnalysisParameters& MathematicalCrystalChemistry::Extraction::CrystalExtractionTask::crystalOptimalityAnalysisParameters() const noexcept
 {
 	return _crystalOptimalityAnalysisParameters;
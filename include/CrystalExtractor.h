@@ -1,6 +1,8 @@
 #ifndef MATHEMATICALCRYSTALCHEMISTRY_EXTRACTION_CRYSTALEXTRACTOR_H
 #define MATHEMATICALCRYSTALCHEMISTRY_EXTRACTION_CRYSTALEXTRACTOR_H
 
+#include <string>
+
 #include "CrystalExtractionTask.h"
 
 
@@ -40,6 +42,15 @@ namespace MathematicalCrystalChemistry
 
 		// Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Private methods
+
+		private:
+			void reduceExtractionStatistics() const;
+			std::string reduceOutputDirectoryLockStatistics() const;
+
+		// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
 
 		private:
 			CrystalExtractionTask _crystalExtractionTask;
@@ -6,6 +6,7 @@
 #include "StreamReader.h"
 
 #include "CrystalDesignRecordParameters.h"
+#include "NearDuplicateDetectionParameters.h"
 
 
 namespace MathematicalCrystalChemistry
@@ -40,6 +41,7 @@ namespace MathematicalCrystalChemistry
 
 				double spaceGroupPrecision() const noexcept;
 				const CrystalDesignRecordParameters& crystalDesignRecordParameters() const noexcept;
+				const NearDuplicateDetectionParameters& nearDuplicateDetectionParameters() const noexcept;
 
 				static double defaultSpaceGroupPrecision() noexcept;
 
@@ -51,6 +53,7 @@ namespace MathematicalCrystalChemistry
 
 				void setSpaceGroupPrecision(const double);
 				void setCrystalDesignRecordParameters(const CrystalDesignRecordParameters&) noexcept;
+				void setNearDuplicateDetectionParameters(const NearDuplicateDetectionParameters&) noexcept;
 
 			// Property
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -81,6 +84,7 @@ namespace MathematicalCrystalChemistry
 
 				double _spaceGroupPrecision;
 				CrystalDesignRecordParameters _crystalDesignRecordParameters;
+				NearDuplicateDetectionParameters _nearDuplicateDetectionParameters;
 
 				static double s_defaultSpaceGroupPrecision;
 			};
@@ -127,6 +131,11 @@ inline const MathematicalCrystalChemistry::Design::Diagnostics::CrystalDesignRec
 	return _crystalDesignRecordParameters;
 }
 
+inline const MathematicalCrystalChemistry::Design::Diagnostics::NearDuplicateDetectionParameters& MathematicalCrystalChemistry::Design::Diagnostics::CrystalProductionReportParameters::nearDuplicateDetectionParameters() const noexcept
+{
+	return _nearDuplicateDetectionParameters;
+}
+
 inline double MathematicalCrystalChemistry::Design::Diagnostics::CrystalProductionReportParameters::defaultSpaceGroupPrecision() noexcept
 {
 	return s_defaultSpaceGroupPrecision;
@@ -168,6 +177,11 @@ inline void MathematicalCrystalChemistry::Design::Diagnostics::CrystalProduction
 	_crystalDesignRecordParameters = parameters;
 }
 
+inline void MathematicalCrystalChemistry::Design::Diagnostics::CrystalProductionReportParameters::setNearDuplicateDetectionParameters(const NearDuplicateDetectionParameters& parameters) noexcept
+{
+	_nearDuplicateDetectionParameters = parameters;
+}
+
 // Property
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -1,9 +1,17 @@
 #ifndef MATHEMATICALCRYSTALCHEMISTRY_DESIGN_DIAGNOSTICS_CRYSTALPRODUCTIONREPORTER_H
 #define MATHEMATICALCRYSTALCHEMISTRY_DESIGN_DIAGNOSTICS_CRYSTALPRODUCTIONREPORTER_H
 
+#include <atomic>
 #include <filesystem>
 #include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
+
+#include "ShardedMutexTable.h"
 
 #include "CrystalDesignRecorder.h"
 #include "CrystalProductionReportParameters.h"
@@ -11,6 +19,8 @@
 #include "ChemicalComposition.h"
 
 #include "OptimalCrystalStructure.h"
+#include "StructuralDescriptor.h"
+#include "StructuralDescriptorIndex.h"
 
 
 namespace MathematicalCrystalChemistry
@@ -28,6 +38,21 @@ namespace MathematicalCrystalChemistry
 				using ChemicalComposition = ChemToolkit::Generic::ChemicalComposition<AtomicNumber>;
 
 				using OptimalCrystalStructure = MathematicalCrystalChemistry::CrystalModel::Components::OptimalCrystalStructure;
+				using StructuralDescriptor = MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptor;
+				using StructuralDescriptorIndex = MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptorIndex;
+
+				struct FingerprintIndex
+				{
+					std::unordered_map<std::string, std::filesystem::path> fingerprintAndDirectory;
+					std::unordered_set<std::string> indexedDirectoryNames;
+				};
+
+				struct DescriptorIndex
+				{
+					StructuralDescriptorIndex descriptorIndex;
+					std::vector<std::filesystem::path> descriptorDirectories;
+					std::unordered_set<std::string> indexedDirectoryPaths;
+				};
 
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 			// Constructors, destructor, and operators
@@ -69,6 +94,12 @@ namespace MathematicalCrystalChemistry
 				void outputExceptionalCrystalStructure(const OptimalCrystalStructure&, const ChemicalComposition&, const std::string& productionName) const;
 				void outputExceptionalCrystalStructure(const OptimalCrystalStructure&, const ChemicalComposition&, const std::filesystem::path& producedDirectoryPath) const;
 
+				static const System::Parallel::ShardedMutexTable& outputDirectoryLocks() noexcept;
+
+				static size_type countNearDuplicateMerges() noexcept;
+				static void initializeNearDuplicateStatistics() noexcept;
+				static void initializeOutputDirectoryLockStatistics() noexcept;
+
 			// Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -78,8 +109,19 @@ namespace MathematicalCrystalChemistry
 				std::filesystem::path getSpaceGroupDirectoryPath(const SpaceGroupNumber, const ChemicalComposition&) const;
 
 				std::pair<bool, std::filesystem::path> getOutputDirectoryPath(const std::string& outputFingerprint, const std::filesystem::path& spaceGroupPath) const;
+				std::pair<bool, std::filesystem::path> findIndexedDirectoryPath(const std::string& outputFingerprint, const std::filesystem::path& spaceGroupPath) const;
+				std::pair<bool, std::filesystem::path> findNearDuplicateDirectoryPath(const StructuralDescriptor&, const std::filesystem::path& spaceGroupPath) const;
+				void indexFingerprints(const std::filesystem::path& spaceGroupPath) const;
+				void indexDescriptors(const std::filesystem::path& spaceGroupPath) const;
+				std::string getDescriptorIndexKey(const std::filesystem::path& spaceGroupPath) const;
+				std::string toReducedCompositionName(const std::string& compositionName) const;
+				void registerFingerprint(const std::string& outputFingerprint, const StructuralDescriptor&, const std::filesystem::path& spaceGroupPath, const std::filesystem::path& outputDirectoryPath) const;
+				void registerMergedFingerprint(const std::string& outputFingerprint, const std::filesystem::path& spaceGroupPath, const std::filesystem::path& outputDirectoryPath) const;
+				void createOutputDirectory(const std::filesystem::path& outputDirectoryPath, const std::filesystem::path& spaceGroupPath) const;
 				std::string getDirectoryName(const std::filesystem::path& directoryPath) const;
 
+				StructuralDescriptor toStructuralDescriptor(const OptimalCrystalStructure& conventionalCrystalStructure) const;
+
 				void outputFeasibleCrystallographicData(const OptimalCrystalStructure& conventionalCrystalStructure, const OptimalCrystalStructure& optimalCrystalStructure, const std::filesystem::path& outputDirectoryPath) const;
 				void outputInfeasibleCrystallographicData(const OptimalCrystalStructure& optimalCrystalStructure, const std::filesystem::path& outputDirectoryPath) const;
 
@@ -90,8 +132,15 @@ namespace MathematicalCrystalChemistry
 				CrystalDesignRecorder _crystalDesignRecorder;
 				CrystalProductionReportParameters _crystalProductionReportParameters;
 
-				static std::mutex s_reportMutex;
+				static System::Parallel::ShardedMutexTable s_outputDirectoryLocks;
 				static std::string s_fingerprintFilename;
+				static std::string s_descriptorFilename;
+
+				static std::unordered_map<std::string, FingerprintIndex> s_fingerprintIndices;
+				static std::unordered_map<std::string, DescriptorIndex> s_descriptorIndices;
+				static std::shared_mutex s_fingerprintIndexMutex;
+
+				static std::atomic<size_type> s_numNearDuplicateMerges;
 			};
 		}
 	}
@@ -0,0 +1,137 @@
+#ifndef MATHEMATICALCRYSTALCHEMISTRY_ANALYSIS_CRYSTALSCREENINGPARAMETERS_H
+#define MATHEMATICALCRYSTALCHEMISTRY_ANALYSIS_CRYSTALSCREENINGPARAMETERS_H
+
+#include "StreamReader.h"
+
+#include "AtomicNumber.h"
+#include "SpaceGroupNumber.h"
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+
+namespace MathematicalCrystalChemistry
+{
+	namespace Analysis
+	{
+		class CrystalScreeningParameters
+		{
+			using size_type = unsigned short;
+			using AtomicNumber = ChemToolkit::Generic::AtomicNumber;
+			using SpaceGroupNumber = ChemToolkit::Crystallography::Symmetry::SpaceGroupNumber;
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Constructors, destructor, and operators
+
+		public:
+			CrystalScreeningParameters() noexcept;
+			virtual ~CrystalScreeningParameters() = default;
+
+			CrystalScreeningParameters(const CrystalScreeningParameters&) = default;
+			CrystalScreeningParameters(CrystalScreeningParameters&&) noexcept = default;
+			CrystalScreeningParameters& operator=(const CrystalScreeningParameters&) = default;
+			CrystalScreeningParameters& operator=(CrystalScreeningParameters&&) noexcept = default;
+
+		// Constructors, destructor, and operators
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Property
+
+			bool needCostOrdering() const noexcept;
+
+			const std::pair<SpaceGroupNumber, SpaceGroupNumber>& spaceGroupRange() const noexcept;
+			const std::pair<size_type, size_type>& numAtomsRange() const noexcept;
+			const std::vector<AtomicNumber>& allowedAtomicNumbers() const noexcept;
+
+			bool needSpaceGroupScreening() const noexcept;
+			bool needNumAtomsScreening() const noexcept;
+			bool needChemicalElementScreening() const noexcept;
+
+		// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Methods
+
+			void initialize() noexcept;
+			void initialize(const System::IO::StreamReader&);
+
+			bool isAllowedAtomicNumber(const AtomicNumber) const noexcept;
+
+		// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Private methods
+
+		private:
+			bool toNecessity(const std::string&) const;
+			void validate() const;
+
+		// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+		private:
+			bool _needCostOrdering;
+
+			std::pair<SpaceGroupNumber, SpaceGroupNumber> _spaceGroupRange;
+			std::pair<size_type, size_type> _numAtomsRange;
+			std::vector<AtomicNumber> _allowedAtomicNumbers;
+		};
+	}
+}
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Property
+
+inline bool MathematicalCrystalChemistry::Analysis::CrystalScreeningParameters::needCostOrdering() const noexcept
+{
+	return _needCostOrdering;
+}
+
+inline const std::pair<MathematicalCrystalChemistry::Analysis::CrystalScreeningParameters::SpaceGroupNumber, MathematicalCrystalChemistry::Analysis::CrystalScreeningParameters::SpaceGroupNumber>& MathematicalCrystalChemistry::Analysis::CrystalScreeningParameters::spaceGroupRange() const noexcept
+{
+	return _spaceGroupRange;
+}
+
+inline const std::pair<MathematicalCrystalChemistry::Analysis::CrystalScreeningParameters::size_type, MathematicalCrystalChemistry::Analysis::CrystalScreeningParameters::size_type>& MathematicalCrystalChemistry::Analysis::CrystalScreeningParameters::numAtomsRange() const noexcept
+{
+	return _numAtomsRange;
+}
+
+inline const std::vector<ChemToolkit::Generic::AtomicNumber>& MathematicalCrystalChemistry::Analysis::CrystalScreeningParameters::allowedAtomicNumbers() const noexcept
+{
+	return _allowedAtomicNumbers;
+}
+
+inline bool MathematicalCrystalChemistry::Analysis::CrystalScreeningParameters::needSpaceGroupScreening() const noexcept
+{
+	return ((SpaceGroupNumber{ 1 } < _spaceGroupRange.first) || (_spaceGroupRange.second < SpaceGroupNumber{ 230 }));
+}
+
+inline bool MathematicalCrystalChemistry::Analysis::CrystalScreeningParameters::needNumAtomsScreening() const noexcept
+{
+	return ((0 < _numAtomsRange.first) || (_numAtomsRange.second < std::numeric_limits<size_type>::max()));
+}
+
+inline bool MathematicalCrystalChemistry::Analysis::CrystalScreeningParameters::needChemicalElementScreening() const noexcept
+{
+	return !(_allowedAtomicNumbers.empty());
+}
+
+// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+
+#endif // !MATHEMATICALCRYSTALCHEMISTRY_ANALYSIS_CRYSTALSCREENINGPARAMETERS_H
@@ -4,11 +4,15 @@
 #include <vector>
 
 #include "ArgumentOutOfRangeException.h"
+#include "ParallelTaskPool.h"
+#include "ThreadingPolicy.h"
 
 #include "CrystalStructure.h"
+#include "DelaunayReducer.h"
 
 #include "ConstrainerIndices.h"
 #include "ConstrainingAtom.h"
+#include "ConstrainingSpeciesDictionary.h"
 
 
 namespace MathematicalCrystalChemistry
@@ -21,6 +25,11 @@ namespace MathematicalCrystalChemistry
 			{
 				class CrystallineConstraintManager :public ChemToolkit::Crystallography::CrystalStructure<ConstrainingAtom>
 				{
+				protected:
+					using TransformationMatrix = ChemToolkit::Crystallography::DelaunayReducer::TransformationMatrix;
+
+					enum class ChemicalBondType { none, covalentBond, ionicBond, ionicRepulsion };
+
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 				// Constructors, destructor, and operators
 
@@ -48,11 +57,14 @@ namespace MathematicalCrystalChemistry
 					double interatomicDistanceTracerCutoffRatio() const noexcept;
 					double interatomicDistanceConstrainerCutoffRatio() const noexcept;
 					const std::vector<ConstrainerIndices<TranslatedAtomIndex>>& constrainingIndexPairs() const noexcept;
+					const std::vector<ConstrainerIndices<TranslatedAtomIndex>>& tracingIndexPairs() const noexcept;
+					std::size_t parallelConstrainingAtomThreshold() const noexcept;
 
 					void setFeasibleErrorRate(const double);
 					void setExclusiveRadiusRatio(const double);
 					void setInteratomicDistanceTracerCutoffRatio(const double);
 					void setInteratomicDistanceConstrainerCutoffRatio(const double);
+					void setParallelConstrainingAtomThreshold(const std::size_t);
 
 				// Property
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -65,6 +77,7 @@ namespace MathematicalCrystalChemistry
 
 					void updateTracingIndexPairs();
 					void clearInteratomicDistanceConstraints() noexcept;
+					std::vector<std::vector<OriginalAtomIndex>> getConstrainableNeighborIndices() const;
 
 					bool isIonicAttractive(const OriginalAtomIndex, const OriginalAtomIndex) const noexcept;
 					bool isIonicAttractive(const OriginalAtomIndex, const TranslatedAtomIndex&) const noexcept;
@@ -82,6 +95,7 @@ namespace MathematicalCrystalChemistry
 
 				protected:
 					void updateConstrainingIndexPairs();
+					void transformUnitCell(const TransformationMatrix&);
 
 					bool isInnateChemicalBondable(const OriginalAtomIndex, const OriginalAtomIndex) const noexcept;
 					bool isInnateCovalentBondable(const OriginalAtomIndex, const OriginalAtomIndex) const noexcept;
@@ -116,6 +130,8 @@ namespace MathematicalCrystalChemistry
 					void createIonicBond(const OriginalAtomIndex, const TranslatedAtomIndex&) noexcept;
 					void createIonicRepulsion(const OriginalAtomIndex, const OriginalAtomIndex) noexcept;
 					void createIonicRepulsion(const OriginalAtomIndex, const TranslatedAtomIndex&) noexcept;
+					void createChemicalBond(const OriginalAtomIndex, const OriginalAtomIndex, const ChemicalBondType) noexcept;
+					void createChemicalBond(const OriginalAtomIndex, const TranslatedAtomIndex&, const ChemicalBondType) noexcept;
 
 					void eraseCovalentBond(const OriginalAtomIndex, const OriginalAtomIndex) noexcept;
 					void eraseCovalentBond(const OriginalAtomIndex, const TranslatedAtomIndex&) noexcept;
@@ -128,6 +144,11 @@ namespace MathematicalCrystalChemistry
 					void clearIonicBonds() noexcept;
 					void clearIonicRepulsions() noexcept;
 
+					bool isParallelConstrainable() const noexcept;
+
+					template <typename F>
+					void executeParallelTasks(const std::size_t numTasks, const F& task) const;
+
 				// Protected methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -138,6 +159,16 @@ namespace MathematicalCrystalChemistry
 					bool isTraceableIonicExclusionDistance(const OriginalAtomIndex, const OriginalAtomIndex, const LatticePoint& latticePoint) const noexcept;
 					bool isTraceableIonicRepulsionDistance(const OriginalAtomIndex, const OriginalAtomIndex, const LatticePoint& latticePoint) const noexcept;
 
+					void traceInteratomicDistances(const OriginalAtomIndex originalIndex, const NumericalMatrix& inverseBasisVectors, std::vector<ConstrainerIndices<TranslatedAtomIndex>>& tracingIndexPairs) const;
+					void traceSelfInteratomicDistances(const OriginalAtomIndex originalIndex, const NumericalMatrix& inverseBasisVectors, std::vector<ConstrainerIndices<TranslatedAtomIndex>>& tracingIndexPairs) const;
+					bool isConstrainableTracingIndexPair(const ConstrainerIndices<TranslatedAtomIndex>&) const noexcept;
+					bool isTraceableIndexPair(const ConstrainerIndices<TranslatedAtomIndex>&) const noexcept;
+
+					std::vector<LatticePoint> transformCartesianCoordinates(const TransformationMatrix&);
+					void transformChemicalBonds(const OriginalAtomIndex, const TransformationMatrix& inverseTransformationMatrix, const std::vector<LatticePoint>& wrappingLatticePoints);
+					void transformIndexPairs(std::vector<ConstrainerIndices<TranslatedAtomIndex>>&, const TransformationMatrix& inverseTransformationMatrix, const std::vector<LatticePoint>& wrappingLatticePoints) const;
+					TranslatedAtomIndex getTransformedAtomIndex(const OriginalAtomIndex, const TranslatedAtomIndex&, const TransformationMatrix& inverseTransformationMatrix, const std::vector<LatticePoint>& wrappingLatticePoints) const noexcept;
+
 					std::vector<LatticePoint> enumerateNeighborLatticePoints(const OriginalAtomIndex originalIndex, const OriginalAtomIndex translatedIndex, const NumericalMatrix& inverseBasisVectors, const double neighborZoneRadius) const;
 
 				// Private methods
@@ -148,6 +179,7 @@ namespace MathematicalCrystalChemistry
 					double _exclusiveRadiusRatio;
 					double _interatomicDistanceTracerCutoffRatio;
 					double _interatomicDistanceConstrainerCutoffRatio;
+					std::size_t _parallelConstrainingAtomThreshold;
 
 					std::vector<ConstrainerIndices<TranslatedAtomIndex>> _constrainingIndexPairs;
 					std::vector<ConstrainerIndices<TranslatedAtomIndex>> _tracingIndexPairs;
@@ -191,6 +223,16 @@ inline const std::vector<MathematicalCrystalChemistry::CrystalModel::Components:
 	return _constrainingIndexPairs;
 }
 
+inline const std::vector<MathematicalCrystalChemistry::CrystalModel::Components::ConstrainerIndices<MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::TranslatedAtomIndex>>& MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::tracingIndexPairs() const noexcept
+{
+	return _tracingIndexPairs;
+}
+
+inline std::size_t MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::parallelConstrainingAtomThreshold() const noexcept
+{
+	return _parallelConstrainingAtomThreshold;
+}
+
 inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::setFeasibleErrorRate(const double val)
 {
 	if (val < 0.0)
@@ -227,6 +269,14 @@ inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::Cr
 		_interatomicDistanceConstrainerCutoffRatio = val;
 }
 
+inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::setParallelConstrainingAtomThreshold(const std::size_t val)
+{
+	if (val == 0)
+		throw System::ExceptionServices::ArgumentOutOfRangeException{ typeid(*this), "setParallelConstrainingAtomThreshold", "Argument value is zero." };
+
+	_parallelConstrainingAtomThreshold = val;
+}
+
 // Property
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -267,16 +317,7 @@ inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::Cr
 
 inline bool MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::isIonicAttractive(const OriginalAtomIndex originalAtomIndex, const OriginalAtomIndex translatedOriginalAtomIndex) const noexcept
 {
-	const ConstrainingAtom& originalAtom = atoms()[originalAtomIndex];
-	const ConstrainingAtom& translatedAtom = atoms()[translatedOriginalAtomIndex];
-
-
-	if (originalAtom.ionicAtomicNumber().formalCharge().isAnion() && translatedAtom.ionicAtomicNumber().formalCharge().isCation())
-		return true;
-	else if (originalAtom.ionicAtomicNumber().formalCharge().isCation() && translatedAtom.ionicAtomicNumber().formalCharge().isAnion())
-		return true;
-	else
-		return false;
+	return MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::isIonicAttractive(atoms()[originalAtomIndex].speciesIndex(), atoms()[translatedOriginalAtomIndex].speciesIndex());
 }
 
 inline bool MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::isIonicAttractive(const OriginalAtomIndex originalAtomIndex, const TranslatedAtomIndex& translatedAtomIndex) const noexcept
@@ -286,16 +327,7 @@ inline bool MathematicalCrystalChemistry::CrystalModel::Components::Internal::Cr
 
 inline bool MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::isIonicRepulsive(const OriginalAtomIndex originalAtomIndex, const OriginalAtomIndex translatedOriginalAtomIndex) const noexcept
 {
-	const ConstrainingAtom& originalAtom = atoms()[originalAtomIndex];
-	const ConstrainingAtom& translatedAtom = atoms()[translatedOriginalAtomIndex];
-
-
-	if (originalAtom.ionicAtomicNumber().formalCharge().isAnion() && translatedAtom.ionicAtomicNumber().formalCharge().isAnion())
-		return true;
-	else if (originalAtom.ionicAtomicNumber().formalCharge().isCation() && translatedAtom.ionicAtomicNumber().formalCharge().isCation())
-		return true;
-	else
-		return false;
+	return MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::isIonicRepulsive(atoms()[originalAtomIndex].speciesIndex(), atoms()[translatedOriginalAtomIndex].speciesIndex());
 }
 
 inline bool MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::isIonicRepulsive(const OriginalAtomIndex originalAtomIndex, const TranslatedAtomIndex& translatedAtomIndex) const noexcept
@@ -372,44 +404,17 @@ inline bool MathematicalCrystalChemistry::CrystalModel::Components::Internal::Cr
 
 inline bool MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::isInnateChemicalBondable(const OriginalAtomIndex originalAtomIndex, const OriginalAtomIndex translatedOriginalAtomIndex) const noexcept
 {
-	if (atoms()[originalAtomIndex].coordinationConstraints().isInfeasibleAtomicNumber(atoms()[translatedOriginalAtomIndex].ionicAtomicNumber().atomicNumber()))
-		return false;
-
-	else
-	{
-		if (atoms()[translatedOriginalAtomIndex].coordinationConstraints().isInfeasibleAtomicNumber(atoms()[originalAtomIndex].ionicAtomicNumber().atomicNumber()))
-			return false;
-		else
-			return true;
-	}
+	return MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::isInnateChemicalBondable(atoms()[originalAtomIndex].speciesIndex(), atoms()[translatedOriginalAtomIndex].speciesIndex());
 }
 
 inline bool MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::isInnateCovalentBondable(const OriginalAtomIndex originalAtomIndex, const OriginalAtomIndex translatedOriginalAtomIndex) const noexcept
 {
-	if (0 < atoms()[originalAtomIndex].coordinationConstraints().maxConstrainedCovalentCoordinationNumber())
-	{
-		if (0 < atoms()[translatedOriginalAtomIndex].coordinationConstraints().maxConstrainedCovalentCoordinationNumber())
-			return true;
-		else
-			return false;
-	}
-
-	else
-		return false;
+	return MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::isInnateCovalentBondable(atoms()[originalAtomIndex].speciesIndex(), atoms()[translatedOriginalAtomIndex].speciesIndex());
 }
 
 inline bool MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::isInnateIonicBondable(const OriginalAtomIndex originalAtomIndex, const OriginalAtomIndex translatedOriginalAtomIndex) const noexcept
 {
-	if (0 < atoms()[originalAtomIndex].coordinationConstraints().maxConstrainedIonicCoordinationNumber())
-	{
-		if (0 < atoms()[translatedOriginalAtomIndex].coordinationConstraints().maxConstrainedIonicCoordinationNumber())
-			return true;
-		else
-			return false;
-	}
-
-	else
-		return false;
+	return MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::isInnateIonicBondable(atoms()[originalAtomIndex].speciesIndex(), atoms()[translatedOriginalAtomIndex].speciesIndex());
 }
 
 inline bool MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::isConstrainableCovalentBondingDistance(const OriginalAtomIndex originalAtomIndex, const OriginalAtomIndex translatedOriginalAtomIndex) const noexcept
@@ -827,8 +832,8 @@ inline bool MathematicalCrystalChemistry::CrystalModel::Components::Internal::Cr
 
 inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::createCovalentBond(const OriginalAtomIndex originalAtomIndex, const OriginalAtomIndex translatedOriginalAtomIndex) noexcept
 {
-	atoms()[originalAtomIndex].createCovalentBondWith(translatedOriginalAtomIndex);
-	atoms()[translatedOriginalAtomIndex].createCovalentBondWith(originalAtomIndex);
+	atoms()[originalAtomIndex].createCovalentBondWith(translatedOriginalAtomIndex, atoms()[translatedOriginalAtomIndex].ionicAtomicNumber().atomicNumber());
+	atoms()[translatedOriginalAtomIndex].createCovalentBondWith(originalAtomIndex, atoms()[originalAtomIndex].ionicAtomicNumber().atomicNumber());
 }
 
 inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::createCovalentBond(const OriginalAtomIndex originalAtomIndex, const TranslatedAtomIndex& translatedAtomIndex) noexcept
@@ -836,14 +841,14 @@ inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::Cr
 	TranslatedAtomIndex reverseIndex{ originalAtomIndex, translatedAtomIndex.latticePoint() };
 	reverseIndex.reverseLatticePoint();
 
-	atoms()[originalAtomIndex].createCovalentBondWith(translatedAtomIndex);
-	atoms()[translatedAtomIndex.originalIndex()].createCovalentBondWith(reverseIndex);
+	atoms()[originalAtomIndex].createCovalentBondWith(translatedAtomIndex, atoms()[translatedAtomIndex.originalIndex()].ionicAtomicNumber().atomicNumber());
+	atoms()[translatedAtomIndex.originalIndex()].createCovalentBondWith(reverseIndex, atoms()[originalAtomIndex].ionicAtomicNumber().atomicNumber());
 }
 
 inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::createIonicBond(const OriginalAtomIndex originalAtomIndex, const OriginalAtomIndex translatedOriginalAtomIndex) noexcept
 {
-	atoms()[originalAtomIndex].createIonicBondWith(translatedOriginalAtomIndex);
-	atoms()[translatedOriginalAtomIndex].createIonicBondWith(originalAtomIndex);
+	atoms()[originalAtomIndex].createIonicBondWith(translatedOriginalAtomIndex, atoms()[translatedOriginalAtomIndex].ionicAtomicNumber().atomicNumber());
+	atoms()[translatedOriginalAtomIndex].createIonicBondWith(originalAtomIndex, atoms()[originalAtomIndex].ionicAtomicNumber().atomicNumber());
 }
 
 inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::createIonicBond(const OriginalAtomIndex originalAtomIndex, const TranslatedAtomIndex& translatedAtomIndex) noexcept
@@ -851,8 +856,8 @@ inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::Cr
 	TranslatedAtomIndex reverseIndex{ originalAtomIndex, translatedAtomIndex.latticePoint() };
 	reverseIndex.reverseLatticePoint();
 
-	atoms()[originalAtomIndex].createIonicBondWith(translatedAtomIndex);
-	atoms()[translatedAtomIndex.originalIndex()].createIonicBondWith(reverseIndex);
+	atoms()[originalAtomIndex].createIonicBondWith(translatedAtomIndex, atoms()[translatedAtomIndex.originalIndex()].ionicAtomicNumber().atomicNumber());
+	atoms()[translatedAtomIndex.originalIndex()].createIonicBondWith(reverseIndex, atoms()[originalAtomIndex].ionicAtomicNumber().atomicNumber());
 }
 
 inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::createIonicRepulsion(const OriginalAtomIndex originalAtomIndex, const OriginalAtomIndex translatedOriginalAtomIndex) noexcept
@@ -870,10 +875,34 @@ inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::Cr
 	atoms()[translatedAtomIndex.originalIndex()].createIonicRepulsionWith(reverseIndex);
 }
 
+inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::createChemicalBond(const OriginalAtomIndex originalAtomIndex, const OriginalAtomIndex translatedOriginalAtomIndex, const ChemicalBondType chemicalBondType) noexcept
+{
+	if (chemicalBondType == ChemicalBondType::covalentBond)
+		createCovalentBond(originalAtomIndex, translatedOriginalAtomIndex);
+
+	else if (chemicalBondType == ChemicalBondType::ionicBond)
+		createIonicBond(originalAtomIndex, translatedOriginalAtomIndex);
+
+	else if (chemicalBondType == ChemicalBondType::ionicRepulsion)
+		createIonicRepulsion(originalAtomIndex, translatedOriginalAtomIndex);
+}
+
+inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::createChemicalBond(const OriginalAtomIndex originalAtomIndex, const TranslatedAtomIndex& translatedAtomIndex, const ChemicalBondType chemicalBondType) noexcept
+{
+	if (chemicalBondType == ChemicalBondType::covalentBond)
+		createCovalentBond(originalAtomIndex, translatedAtomIndex);
+
+	else if (chemicalBondType == ChemicalBondType::ionicBond)
+		createIonicBond(originalAtomIndex, translatedAtomIndex);
+
+	else if (chemicalBondType == ChemicalBondType::ionicRepulsion)
+		createIonicRepulsion(originalAtomIndex, translatedAtomIndex);
+}
+
 inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::eraseCovalentBond(const OriginalAtomIndex originalAtomIndex, const OriginalAtomIndex translatedOriginalAtomIndex) noexcept
 {
-	atoms()[originalAtomIndex].eraseCovalentBond(translatedOriginalAtomIndex);
-	atoms()[translatedOriginalAtomIndex].eraseCovalentBond(originalAtomIndex);
+	atoms()[originalAtomIndex].eraseCovalentBond(translatedOriginalAtomIndex, atoms()[translatedOriginalAtomIndex].ionicAtomicNumber().atomicNumber());
+	atoms()[translatedOriginalAtomIndex].eraseCovalentBond(originalAtomIndex, atoms()[originalAtomIndex].ionicAtomicNumber().atomicNumber());
 }
 
 inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::eraseCovalentBond(const OriginalAtomIndex originalAtomIndex, const TranslatedAtomIndex& translatedIndex) noexcept
@@ -881,14 +910,14 @@ inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::Cr
 	TranslatedAtomIndex reverseIndex{ originalAtomIndex, translatedIndex.latticePoint() };
 	reverseIndex.reverseLatticePoint();
 
-	atoms()[originalAtomIndex].eraseCovalentBond(translatedIndex);
-	atoms()[translatedIndex.originalIndex()].eraseCovalentBond(reverseIndex);
+	atoms()[originalAtomIndex].eraseCovalentBond(translatedIndex, atoms()[translatedIndex.originalIndex()].ionicAtomicNumber().atomicNumber());
+	atoms()[translatedIndex.originalIndex()].eraseCovalentBond(reverseIndex, atoms()[originalAtomIndex].ionicAtomicNumber().atomicNumber());
 }
 
 inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::eraseIonicBond(const OriginalAtomIndex originalAtomIndex, const OriginalAtomIndex translatedOriginalAtomIndex) noexcept
 {
-	atoms()[originalAtomIndex].eraseIonicBond(translatedOriginalAtomIndex);
-	atoms()[translatedOriginalAtomIndex].eraseIonicBond(originalAtomIndex);
+	atoms()[originalAtomIndex].eraseIonicBond(translatedOriginalAtomIndex, atoms()[translatedOriginalAtomIndex].ionicAtomicNumber().atomicNumber());
+	atoms()[translatedOriginalAtomIndex].eraseIonicBond(originalAtomIndex, atoms()[originalAtomIndex].ionicAtomicNumber().atomicNumber());
 }
 
 inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::eraseIonicBond(const OriginalAtomIndex originalAtomIndex, const TranslatedAtomIndex& translatedIndex) noexcept
@@ -896,8 +925,8 @@ inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::Cr
 	TranslatedAtomIndex reverseIndex{ originalAtomIndex, translatedIndex.latticePoint() };
 	reverseIndex.reverseLatticePoint();
 
-	atoms()[originalAtomIndex].eraseIonicBond(translatedIndex);
-	atoms()[translatedIndex.originalIndex()].eraseIonicBond(reverseIndex);
+	atoms()[originalAtomIndex].eraseIonicBond(translatedIndex, atoms()[translatedIndex.originalIndex()].ionicAtomicNumber().atomicNumber());
+	atoms()[translatedIndex.originalIndex()].eraseIonicBond(reverseIndex, atoms()[originalAtomIndex].ionicAtomicNumber().atomicNumber());
 }
 
 inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::eraseIonicRepulsion(const OriginalAtomIndex originalAtomIndex, const OriginalAtomIndex translatedOriginalAtomIndex) noexcept
@@ -933,6 +962,17 @@ inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::Cr
 		atom.clearIonicRepulsions();
 }
 
+inline bool MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::isParallelConstrainable() const noexcept
+{
+	return ((_parallelConstrainingAtomThreshold <= atoms().size()) && (1 < System::Parallel::ThreadingPolicy::maxThreading()));
+}
+
+template <typename F>
+inline void MathematicalCrystalChemistry::CrystalModel::Components::Internal::CrystallineConstraintManager::executeParallelTasks(const std::size_t numTasks, const F& task) const
+{
+	System::Parallel::ParallelTaskPool::getInstance().execute(numTasks, task);
+}
+
 // Protected methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -85,6 +85,12 @@ namespace ChemToolkit
 			virtual void updateSymmetryInformation(const double spaceGroupPrecision);
 			void clearSymmetryInformation() noexcept;
 
+			template <typename S>
+			static void conventionalizeStructures(std::vector<S>&, const double spaceGroupPrecision);
+
+			bool hasTrivialSymmetry() const;
+			bool hasTrivialSymmetry(const double spaceGroupPrecision) const;
+
 
 			virtual void normalizeFractionalCoordinates();
 			CrystallographicInformation toCrystallographicInformation() const;
@@ -360,6 +366,35 @@ inline void ChemToolkit::Crystallography::CrystallographicStructure<A>::updateSy
 	_hasSymmetryInformation = true;
 }
 
+template <typename A>
+template <typename S>
+inline void ChemToolkit::Crystallography::CrystallographicStructure<A>::conventionalizeStructures(std::vector<S>& structures, const double spaceGroupPrecision)
+{
+	std::vector<UnitCell> unitCells;
+	std::vector<std::vector<Atom>> atomicArrangements;
+	std::vector<SpaceGroupNumber> spaceGroupNumbers(structures.size());
+	{
+		for (CrystallographicStructure& structure : structures)
+		{
+			unitCells.push_back(structure._unitCell);
+			atomicArrangements.push_back(std::move(structure._atoms));
+		}
+	}
+
+	ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher spaceGroupTypeSearcher{ spaceGroupPrecision };
+	spaceGroupTypeSearcher.conventionalize(unitCells, atomicArrangements, spaceGroupNumbers);
+
+
+	for (size_type index = 0; index < structures.size(); ++index)
+	{
+		CrystallographicStructure& structure = structures[index];
+		structure._unitCell = unitCells[index];
+		structure._atoms = std::move(atomicArrangements[index]);
+		structure._spaceGroupNumber = spaceGroupNumbers[index];
+		structure._hasSymmetryInformation = true;
+	}
+}
+
 template <typename A>
 inline void ChemToolkit::Crystallography::CrystallographicStructure<A>::clearSymmetryInformation() noexcept
 {
@@ -371,6 +406,20 @@ inline void ChemToolkit::Crystallography::CrystallographicStructure<A>::clearSym
 	_spaceGroupNumber = 1;
 }
 
+template <typename A>
+inline bool ChemToolkit::Crystallography::CrystallographicStructure<A>::hasTrivialSymmetry() const
+{
+	ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher spaceGroupTypeSearcher;
+	return spaceGroupTypeSearcher.hasTrivialSymmetry(_unitCell, _atoms);
+}
+
+template <typename A>
+inline bool ChemToolkit::Crystallography::CrystallographicStructure<A>::hasTrivialSymmetry(const double spaceGroupPrecision) const
+{
+	ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher spaceGroupTypeSearcher{ spaceGroupPrecision };
+	return spaceGroupTypeSearcher.hasTrivialSymmetry(_unitCell, _atoms);
+}
+
 template <typename A>
 inline void ChemToolkit::Crystallography::CrystallographicStructure<A>::normalizeFractionalCoordinates()
 {
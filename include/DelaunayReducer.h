@@ -0,0 +1,224 @@
+#ifndef CHEMTOOLKIT_CRYSTALLOGRAPHY_DELAUNAYREDUCER_H
+#define CHEMTOOLKIT_CRYSTALLOGRAPHY_DELAUNAYREDUCER_H
+
+#include <array>
+
+#include "ArgumentOutOfRangeException.h"
+
+#include "NumericalVector.h"
+#include "NumericalMatrix.h"
+
+#include "AtomIndex.h"
+#include "UnitCell.h"
+
+
+namespace ChemToolkit
+{
+	namespace Crystallography
+	{
+		class DelaunayReducer
+		{
+			using size_type = unsigned short;
+			using NumericalVector = MathToolkit::LinearAlgebra::NumericalVector<double, 3>;
+			using NumericalMatrix = MathToolkit::LinearAlgebra::NumericalMatrix<double, 3, 3>;
+
+		public:
+			using TransformationMatrix = std::array<std::array<int, 3>, 3>;
+			using LatticePoint = TranslatedAtomIndex::LatticePoint;
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Constructors, destructor, and operators
+
+		public:
+			DelaunayReducer() noexcept;
+			explicit DelaunayReducer(const double precision);
+
+			virtual ~DelaunayReducer() = default;
+
+			DelaunayReducer(const DelaunayReducer&) = default;
+			DelaunayReducer(DelaunayReducer&&) noexcept = default;
+			DelaunayReducer& operator=(const DelaunayReducer&) = default;
+			DelaunayReducer& operator=(DelaunayReducer&&) noexcept = default;
+
+		// Constructors, destructor, and operators
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Property
+
+			double precision() const noexcept;
+			static double defaultPrecision() noexcept;
+
+			void setPrecision() noexcept;
+			void setPrecision(const double);
+
+		// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Methods
+
+			TransformationMatrix getTransformationMatrix(const UnitCell&) const;
+
+			static UnitCell getTransformedUnitCell(const UnitCell&, const TransformationMatrix&) noexcept;
+			static TransformationMatrix getInverseMatrix(const TransformationMatrix&) noexcept;
+			static LatticePoint getTransformedLatticePoint(const TransformationMatrix&, const LatticePoint&) noexcept;
+			static bool isIdentity(const TransformationMatrix&) noexcept;
+
+		// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Private methods
+
+		private:
+			bool reduceSuperBasis(std::array<NumericalVector, 4>&, std::array<std::array<int, 3>, 4>&) const noexcept;
+
+			static int getDeterminant(const TransformationMatrix&) noexcept;
+			static double getDeterminant(const NumericalVector&, const NumericalVector&, const NumericalVector&) noexcept;
+			static size_type maxReductionSteps() noexcept;
+
+		// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+		private:
+			double _precision;
+
+			static double s_defaultPrecision;
+		};
+	}
+}
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Property
+
+inline double ChemToolkit::Crystallography::DelaunayReducer::precision() const noexcept
+{
+	return _precision;
+}
+
+inline double ChemToolkit::Crystallography::DelaunayReducer::defaultPrecision() noexcept
+{
+	return s_defaultPrecision;
+}
+
+inline void ChemToolkit::Crystallography::DelaunayReducer::setPrecision() noexcept
+{
+	_precision = s_defaultPrecision;
+}
+
+inline void ChemToolkit::Crystallography::DelaunayReducer::setPrecision(const double val)
+{
+	if (0.0 < val)
+		_precision = val;
+	else
+		throw System::ExceptionServices::ArgumentOutOfRangeException{ typeid(*this), "setPrecision", "Input precision is not more than zero." };
+}
+
+// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Methods
+
+inline ChemToolkit::Crystallography::DelaunayReducer::LatticePoint ChemToolkit::Crystallography::DelaunayReducer::getTransformedLatticePoint(const TransformationMatrix& transformationMatrix, const LatticePoint& latticePoint) noexcept
+{
+	LatticePoint transformedLatticePoint{ 0,0,0 };
+	{
+		for (size_type row = 0; row < 3; ++row)
+		{
+			int value = 0;
+
+			for (size_type column = 0; column < 3; ++column)
+				value += transformationMatrix[row][column] * static_cast<int>(latticePoint[column]);
+
+			transformedLatticePoint[row] = static_cast<TranslatedAtomIndex::lattice_point_value_type>(value);
+		}
+	}
+
+	return transformedLatticePoint;
+}
+
+inline bool ChemToolkit::Crystallography::DelaunayReducer::isIdentity(const TransformationMatrix& transformationMatrix) noexcept
+{
+	for (size_type row = 0; row < 3; ++row)
+	{
+		for (size_type column = 0; column < 3; ++column)
+		{
+			if (transformationMatrix[row][column] != ((row == column) ? 1 : 0))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+inline int ChemToolkit::Crystallography::DelaunayReducer::getDeterminant(const TransformationMatrix& matrix) noexcept
+{
+	int determinant = 0;
+	{
+		determinant += matrix[0][0] * ((matrix[1][1] * matrix[2][2]) - (matrix[1][2] * matrix[2][1]));
+		determinant += matrix[0][1] * ((matrix[1][2] * matrix[2][0]) - (matrix[1][0] * matrix[2][2]));
+		determinant += matrix[0][2] * ((matrix[1][0] * matrix[2][1]) - (matrix[1][1] * matrix[2][0]));
+	}
+
+	return determinant;
+}
+
+inline double ChemToolkit::Crystallography::DelaunayReducer::getDeterminant(const NumericalVector& nva, const NumericalVector& nvb, const NumericalVector& nvc) noexcept
+{
+	double determinant = 0.0;
+	{
+		determinant += nva[0] * ((nvb[1] * nvc[2]) - (nvb[2] * nvc[1]));
+		determinant += nva[1] * ((nvb[2] * nvc[0]) - (nvb[0] * nvc[2]));
+		determinant += nva[2] * ((nvb[0] * nvc[1]) - (nvb[1] * nvc[0]));
+	}
+
+	return determinant;
+}
+
+inline ChemToolkit::Crystallography::DelaunayReducer::size_type ChemToolkit::Crystallography::DelaunayReducer::maxReductionSteps() noexcept
+{
+	return 100;
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+
+#endif // !CHEMTOOLKIT_CRYSTALLOGRAPHY_DELAUNAYREDUCER_H
@@ -0,0 +1,92 @@
+#ifndef SYSTEM_PARALLEL_DISTRIBUTEDWORKCOUNTER_H
+#define SYSTEM_PARALLEL_DISTRIBUTEDWORKCOUNTER_H
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include <mpi.h>
+
+
+namespace System
+{
+	namespace Parallel
+	{
+		class DistributedWorkCounter final
+		{
+		public:
+			using size_type = std::size_t;
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Constructors and destructor
+
+		public:
+			DistributedWorkCounter();
+			~DistributedWorkCounter();
+
+		// Constructors and destructor
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Public methods
+
+			bool isDistributed() const noexcept;
+			size_type fetchAndIncrement();
+
+		// Public methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Private methods
+
+		private:
+			void progressWindow();
+
+		// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+		private:
+			bool _isDistributed;
+
+			MPI_Win _window;
+			unsigned long long* _windowCounter;
+			std::mutex _windowMutex;
+
+			std::atomic<bool> _isProgressing;
+			std::thread _progressThread;
+
+			std::atomic<size_type> _localCounter;
+
+
+		private:
+			DistributedWorkCounter(const DistributedWorkCounter&) = delete;
+			DistributedWorkCounter(DistributedWorkCounter&&) noexcept = delete;
+			DistributedWorkCounter& operator=(const DistributedWorkCounter&) = delete;
+			DistributedWorkCounter& operator=(DistributedWorkCounter&&) noexcept = delete;
+		};
+	}
+}
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Public methods
+
+inline bool System::Parallel::DistributedWorkCounter::isDistributed() const noexcept
+{
+	return _isDistributed;
+}
+
+// Public methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+
+#endif // !SYSTEM_PARALLEL_DISTRIBUTEDWORKCOUNTER_H
@@ -0,0 +1,119 @@
+#ifndef MATHEMATICALCRYSTALCHEMISTRY_EXTRACTION_INTERNAL_ENUMERATECIFFILES_H
+#define MATHEMATICALCRYSTALCHEMISTRY_EXTRACTION_INTERNAL_ENUMERATECIFFILES_H
+
+#include <string>
+#include <filesystem>
+
+#include "BoundedConcurrentQueue.h"
+#include "DistributedWorkCounter.h"
+
+#include "CrystalExtractionTask.h"
+
+
+namespace MathematicalCrystalChemistry
+{
+	namespace Extraction
+	{
+		namespace Internal
+		{
+			class EnumerateCifFiles
+			{
+				using size_type = std::size_t;
+				using CifFileQueue = System::Parallel::BoundedConcurrentQueue<std::filesystem::path>;
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Constructors, destructor, and operators
+
+			public:
+				EnumerateCifFiles() noexcept;
+				virtual ~EnumerateCifFiles() = default;
+
+				EnumerateCifFiles(const EnumerateCifFiles&) = default;
+				EnumerateCifFiles(EnumerateCifFiles&&) noexcept = default;
+				EnumerateCifFiles& operator=(const EnumerateCifFiles&) = default;
+				EnumerateCifFiles& operator=(EnumerateCifFiles&&) noexcept = default;
+
+			// Constructors, destructor, and operators
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Property
+
+				void setCrystalExtractionTask(const CrystalExtractionTask&) noexcept;
+				void setWorkCounter(System::Parallel::DistributedWorkCounter&) noexcept;
+				void setCifFileQueue(CifFileQueue&) noexcept;
+
+				static size_type numFilesPerChunk() noexcept;
+
+			// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Methods
+
+				void operator()() const;
+
+			// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Private methods
+
+			private:
+				bool enumerateDirectory(const std::filesystem::path&, size_type& fileIndex, size_type& chunkIndex) const;
+
+				static bool isCifFileName(const std::string&);
+
+			// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+			private:
+				std::filesystem::path _inputCrystalsDirectoryPath;
+
+				System::Parallel::DistributedWorkCounter* _workCounter;
+				CifFileQueue* _cifFileQueue;
+
+
+				static size_type s_numFilesPerChunk;
+			};
+		}
+	}
+}
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Property
+
+inline void MathematicalCrystalChemistry::Extraction::Internal::EnumerateCifFiles::setCrystalExtractionTask(const CrystalExtractionTask& task) noexcept
+{
+	_inputCrystalsDirectoryPath = task.inputCrystalsDirectoryPath();
+}
+
+inline void MathematicalCrystalChemistry::Extraction::Internal::EnumerateCifFiles::setWorkCounter(System::Parallel::DistributedWorkCounter& workCounter) noexcept
+{
+	_workCounter = &workCounter;
+}
+
+inline void MathematicalCrystalChemistry::Extraction::Internal::EnumerateCifFiles::setCifFileQueue(CifFileQueue& cifFileQueue) noexcept
+{
+	_cifFileQueue = &cifFileQueue;
+}
+
+inline MathematicalCrystalChemistry::Extraction::Internal::EnumerateCifFiles::size_type MathematicalCrystalChemistry::Extraction::Internal::EnumerateCifFiles::numFilesPerChunk() noexcept
+{
+	return s_numFilesPerChunk;
+}
+
+// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+
+#endif // !MATHEMATICALCRYSTALCHEMISTRY_EXTRACTION_INTERNAL_ENUMERATECIFFILES_H
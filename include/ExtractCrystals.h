@@ -3,14 +3,24 @@
 
 #include <string>
 #include <filesystem>
-#include <queue>
 #include <mutex>
+#include <atomic>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ShardedMutexTable.h"
+#include "BoundedConcurrentQueue.h"
 
 #include "CrystalOptimalityAnalyzer.h"
 #include "IsotypicCrystalExtractor.h"
 #include "PromisingCrystalExtractor.h"
 
+#include "StructuralDescriptor.h"
+#include "StructuralDescriptorIndex.h"
+
 #include "CrystalExtractionTask.h"
+#include "ExtractionFilterPipeline.h"
 
 
 namespace MathematicalCrystalChemistry
@@ -23,18 +33,35 @@ namespace MathematicalCrystalChemistry
 			{
 				using size_type = std::size_t;
 				using GeometricalConstraintParameters = MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters;
+				using NearDuplicateDetectionParameters = MathematicalCrystalChemistry::Design::Diagnostics::NearDuplicateDetectionParameters;
+				using CrystalScreeningParameters = MathematicalCrystalChemistry::Analysis::CrystalScreeningParameters;
 
 				using AtomicNumber = ChemToolkit::Generic::AtomicNumber;
 				using SpaceGroupNumber = ChemToolkit::Crystallography::Symmetry::SpaceGroupNumber;
 				using ChemicalComposition = ChemToolkit::Generic::ChemicalComposition<AtomicNumber>;
+				using CrystallographicStructure = ChemToolkit::Crystallography::CrystallographicStructure<ChemToolkit::Crystallography::CrystallographicAtom>;
 
 				using OptimalAtom = MathematicalCrystalChemistry::CrystalModel::Components::OptimalAtom;
 				using OptimalCrystalStructure = MathematicalCrystalChemistry::CrystalModel::Components::OptimalCrystalStructure;
+				using StructuralHash = MathematicalCrystalChemistry::CrystalModel::Components::StructuralHash;
+				using StructuralDescriptor = MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptor;
+				using StructuralDescriptorIndex = MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptorIndex;
 
 				using CrystalOptimalityAnalyzer = MathematicalCrystalChemistry::Analysis::CrystalOptimalityAnalyzer;
 				using IsotypicCrystalExtractor = MathematicalCrystalChemistry::Analysis::IsotypicCrystalExtractor;
 				using PromisingCrystalExtractor = MathematicalCrystalChemistry::Analysis::PromisingCrystalExtractor;
 
+				using FilterStage = ExtractionFilterPipeline::FilterStage;
+
+				struct DescriptorIndex
+				{
+					StructuralDescriptorIndex descriptorIndex;
+					std::vector<std::filesystem::path> descriptorDirectories;
+					std::unordered_set<std::string> indexedDirectoryPaths;
+
+					std::mutex mutex;
+				};
+
 
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 			// Constructors, destructor, and operators
@@ -54,6 +81,7 @@ namespace MathematicalCrystalChemistry
 			// Property
 
 				void setCrystalExtractionTask(const CrystalExtractionTask&) noexcept;
+				void setCifFileQueue(System::Parallel::BoundedConcurrentQueue<std::filesystem::path>&) noexcept;
 
 			// Property
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -62,15 +90,25 @@ namespace MathematicalCrystalChemistry
 
 				void operator()() const;
 
+				static const System::Parallel::ShardedMutexTable& outputDirectoryLocks() noexcept;
+
+				static size_type countProcessedFiles() noexcept;
+				static size_type countNearDuplicates() noexcept;
+				static void setExtractionStatistics(const size_type numProcessedFiles, const size_type numNearDuplicates) noexcept;
+				static void initializeExtractionStatistics() noexcept;
+
 			// Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 			// Private methods
 
 			private:
-				std::queue<std::filesystem::path> getCifFilePaths() const;
-				void eraseFilePathsInitially(std::queue<std::filesystem::path>&) const;
-				void eraseFilePathsForParallel(std::queue<std::filesystem::path>&) const;
+				void extractCrystal(const std::filesystem::path& cifFilePath, ExtractionFilterPipeline&, const std::vector<FilterStage>& screeningStages, const std::vector<FilterStage>& analysisStages) const;
+
+				std::vector<FilterStage> getScreeningStages() const;
+				std::vector<FilterStage> getAnalysisStages() const;
+				bool isAcceptedByScreening(const FilterStage, const SpaceGroupNumber declaredSpaceGroupNumber, const CrystallographicStructure&) const;
+				bool isAcceptedByAnalysis(const FilterStage, const OptimalCrystalStructure&) const;
 
 				void outputOptimalCrystalStructure(std::filesystem::path inputCifFilePath, const OptimalCrystalStructure&) const;
 
@@ -80,10 +118,16 @@ namespace MathematicalCrystalChemistry
 			// Private utility
 
 				std::filesystem::path getSpaceGroupDirectoryPath(const SpaceGroupNumber, const ChemicalComposition&) const;
-				std::pair<bool, std::filesystem::path> getOutputDirectoryPath(const std::string& outputFingerprint, const std::filesystem::path& spaceGroupPath) const;
+				std::pair<bool, std::filesystem::path> getOutputDirectoryPath(const std::string& outputFingerprint, const StructuralHash& outputHash, const std::filesystem::path& spaceGroupPath) const;
+				std::pair<bool, std::filesystem::path> findNearDuplicateDirectoryPath(const StructuralDescriptor&, const std::filesystem::path& spaceGroupPath) const;
+				void registerStructuralDescriptor(const StructuralDescriptor&, const std::filesystem::path& spaceGroupPath, const std::filesystem::path& outputDirectoryPath) const;
+				DescriptorIndex& getDescriptorIndex(const std::filesystem::path& compositionPath) const;
 
+				void publishOutputDirectory(const OptimalCrystalStructure& conventionalOptimalStructure, const std::string& structureFingerprint, const StructuralHash& structuralHash, const StructuralDescriptor&, const std::filesystem::path& outputDirectoryPath) const;
 				void outputFeasibleCrystallographicData(const OptimalCrystalStructure& conventionalOptimalStructure, const std::filesystem::path& outputDirectoryPath) const;
 
+				static bool isStagingDirectoryPath(const std::filesystem::path&);
+
 			// Private utility
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 
@@ -95,15 +139,28 @@ namespace MathematicalCrystalChemistry
 				double _spaceGroupPrecision;
 				double _feasibleErrorRate;
 				GeometricalConstraintParameters _geometricalConstraintParameters;
+				NearDuplicateDetectionParameters _nearDuplicateDetectionParameters;
+				CrystalScreeningParameters _crystalScreeningParameters;
 
 				CrystalOptimalityAnalyzer _crystalOptimalityAnalyzer;
 				IsotypicCrystalExtractor _isotypicCrystalExtractor;
 				PromisingCrystalExtractor _promisingCrystalExtractor;
 
+				System::Parallel::BoundedConcurrentQueue<std::filesystem::path>* _cifFileQueue;
+
 
 				static std::string s_fingerprintFilename;
-				static std::mutex s_outputMutex;
+				static std::string s_structuralHashFilename;
+				static std::string s_descriptorFilename;
+				static std::string s_nearDuplicatesFilename;
+				static System::Parallel::ShardedMutexTable s_outputDirectoryLocks;
 				static double s_defaultFeasibleErrorRate;
+
+				static std::unordered_map<std::string, DescriptorIndex> s_descriptorIndices;
+				static std::mutex s_descriptorIndexMutex;
+				static std::atomic<size_type> s_numNearDuplicates;
+
+				static std::atomic<size_type> s_numProcessedFiles;
 			};
 		}
 	}
@@ -126,12 +183,19 @@ inline void MathematicalCrystalChemistry::Extraction::Internal::ExtractCrystals:
 	_spaceGroupPrecision = task.spaceGroupPrecision();
 	_feasibleErrorRate = task.crystalOptimalityAnalysisParameters().preciseStructuralOptimizationParameters().feasibleGeometricalConstraintErrorRate();
 	_geometricalConstraintParameters = task.geometricalConstraintParameters();
+	_nearDuplicateDetectionParameters = task.nearDuplicateDetectionParameters();
+	_crystalScreeningParameters = task.crystalScreeningParameters();
 
 	_crystalOptimalityAnalyzer.setOptimalityAnalysisParameters(task.crystalOptimalityAnalysisParameters());
 	_isotypicCrystalExtractor.setIsotypicCrystalExtractionParameters(task.isotypicCrystalExtractionParameters());
 	_promisingCrystalExtractor.setPromisingCrystalExtractionParameters(task.promisingCrystalExtractionParameters());
 }
 
+inline void MathematicalCrystalChemistry::Extraction::Internal::ExtractCrystals::setCifFileQueue(System::Parallel::BoundedConcurrentQueue<std::filesystem::path>& cifFileQueue) noexcept
+{
+	_cifFileQueue = &cifFileQueue;
+}
+
 // Property
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -0,0 +1,198 @@
+#ifndef MATHEMATICALCRYSTALCHEMISTRY_EXTRACTION_INTERNAL_EXTRACTIONFILTERPIPELINE_H
+#define MATHEMATICALCRYSTALCHEMISTRY_EXTRACTION_INTERNAL_EXTRACTIONFILTERPIPELINE_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace MathematicalCrystalChemistry
+{
+	namespace Extraction
+	{
+		namespace Internal
+		{
+			class ExtractionFilterPipeline
+			{
+			public:
+				using size_type = std::size_t;
+
+				enum class FilterStage
+				{
+					spaceGroupRange,
+					chemicalElements,
+					numAtoms,
+					isotypicCrystals,
+					crystalOptimality,
+					promisingCrystals
+				};
+
+				struct FilterStatistics
+				{
+					size_type numAccepted;
+					size_type numRejected;
+					std::int64_t elapsedNanoseconds;
+				};
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Constructors, destructor, and operators
+
+			public:
+				ExtractionFilterPipeline() noexcept;
+				explicit ExtractionFilterPipeline(const bool needCostOrdering) noexcept;
+
+				virtual ~ExtractionFilterPipeline() = default;
+
+				ExtractionFilterPipeline(const ExtractionFilterPipeline&) = default;
+				ExtractionFilterPipeline(ExtractionFilterPipeline&&) noexcept = default;
+				ExtractionFilterPipeline& operator=(const ExtractionFilterPipeline&) = default;
+				ExtractionFilterPipeline& operator=(ExtractionFilterPipeline&&) noexcept = default;
+
+			// Constructors, destructor, and operators
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Property
+
+				bool needCostOrdering() const noexcept;
+				const FilterStatistics& filterStatistics(const FilterStage) const noexcept;
+
+				static size_type minimumEvaluations() noexcept;
+
+			// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Methods
+
+				template <typename Predicate>
+				bool evaluate(const FilterStage, Predicate&&);
+
+				std::vector<FilterStage> getOrderedStages(std::vector<FilterStage>) const;
+				void recordEvaluation(const FilterStage, const bool isAccepted, const std::int64_t elapsedNanoseconds) noexcept;
+
+				static FilterStatistics getTotalStatistics(const FilterStage) noexcept;
+				static void setTotalStatistics(const FilterStage, const FilterStatistics&) noexcept;
+				static void initializeTotalStatistics() noexcept;
+				static size_type countFilterStages() noexcept;
+				static std::string toStatisticsReport();
+
+			// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Private methods
+
+			private:
+				double getCostPerRejection(const FilterStage) const noexcept;
+
+				static size_type toStageIndex(const FilterStage) noexcept;
+				static std::string toStageName(const FilterStage);
+
+			// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+			private:
+				static constexpr size_type s_numFilterStages = 6;
+
+				bool _needCostOrdering;
+				std::array<FilterStatistics, s_numFilterStages> _filterStatistics;
+
+
+				static size_type s_minimumEvaluations;
+
+				static std::array<std::atomic<size_type>, s_numFilterStages> s_numTotalAccepted;
+				static std::array<std::atomic<size_type>, s_numFilterStages> s_numTotalRejected;
+				static std::array<std::atomic<std::int64_t>, s_numFilterStages> s_totalElapsedNanoseconds;
+			};
+		}
+	}
+}
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Property
+
+inline bool MathematicalCrystalChemistry::Extraction::Internal::ExtractionFilterPipeline::needCostOrdering() const noexcept
+{
+	return _needCostOrdering;
+}
+
+inline const MathematicalCrystalChemistry::Extraction::Internal::ExtractionFilterPipeline::FilterStatistics& MathematicalCrystalChemistry::Extraction::Internal::ExtractionFilterPipeline::filterStatistics(const FilterStage stage) const noexcept
+{
+	return _filterStatistics[toStageIndex(stage)];
+}
+
+inline MathematicalCrystalChemistry::Extraction::Internal::ExtractionFilterPipeline::size_type MathematicalCrystalChemistry::Extraction::Internal::ExtractionFilterPipeline::minimumEvaluations() noexcept
+{
+	return s_minimumEvaluations;
+}
+
+// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Methods
+
+template <typename Predicate>
+inline bool MathematicalCrystalChemistry::Extraction::Internal::ExtractionFilterPipeline::evaluate(const FilterStage stage, Predicate&& predicate)
+{
+	const auto startTime = std::chrono::steady_clock::now();
+	const bool isAccepted = predicate();
+
+	recordEvaluation(stage, isAccepted, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count());
+	return isAccepted;
+}
+
+inline MathematicalCrystalChemistry::Extraction::Internal::ExtractionFilterPipeline::size_type MathematicalCrystalChemistry::Extraction::Internal::ExtractionFilterPipeline::countFilterStages() noexcept
+{
+	return s_numFilterStages;
+}
+
+// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+inline MathematicalCrystalChemistry::Extraction::Internal::ExtractionFilterPipeline::size_type MathematicalCrystalChemistry::Extraction::Internal::ExtractionFilterPipeline::toStageIndex(const FilterStage stage) noexcept
+{
+	return static_cast<size_type>(stage);
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+
+#endif // !MATHEMATICALCRYSTALCHEMISTRY_EXTRACTION_INTERNAL_EXTRACTIONFILTERPIPELINE_H
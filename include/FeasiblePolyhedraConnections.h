@@ -1,14 +1,18 @@
 #ifndef MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_CONSTRAINTS_FEASIBLEPOLYHEDRACONNECTIONS_H
 #define MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_CONSTRAINTS_FEASIBLEPOLYHEDRACONNECTIONS_H
 
+#include <memory>
 #include <unordered_map>
 #include <utility>
 
 #include "AtomicNumber.h"
 #include "ChemicalComposition.h"
+#include "FlatChemicalComposition.h"
 
 #include "IonicAtomicNumber.h"
 
+#include "CommonBridgingCompositionLattice.h"
+
 
 namespace MathematicalCrystalChemistry
 {
@@ -21,7 +25,7 @@ namespace MathematicalCrystalChemistry
 				using size_type = unsigned short;
 				using AtomicNumber = ChemToolkit::Generic::AtomicNumber;
 				using IonicAtomicNumber = ChemToolkit::Generic::IonicAtomicNumber;
-				using ChemicalComposition = ChemToolkit::Generic::ChemicalComposition<AtomicNumber>;
+				using ChemicalComposition = ChemToolkit::Generic::FlatChemicalComposition;
 
 
 				struct KeyHasher
@@ -34,6 +38,9 @@ namespace MathematicalCrystalChemistry
 					bool operator()(const std::pair<IonicAtomicNumber, IonicAtomicNumber>&, const std::pair<IonicAtomicNumber, IonicAtomicNumber>&) const noexcept;
 				};
 
+			public:
+				using LatticeDictionary = std::unordered_map<std::pair<IonicAtomicNumber, IonicAtomicNumber>, CommonBridgingCompositionLattice, KeyHasher, KeyEqual>;
+
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 			// Constructors, destructor, and operators
 
@@ -61,12 +68,13 @@ namespace MathematicalCrystalChemistry
 
 			private:
 				std::pair<IonicAtomicNumber, IonicAtomicNumber> getIonicAtomicNumberKey(const IonicAtomicNumber&, const IonicAtomicNumber&) const;
+				const CommonBridgingCompositionLattice* findCommonBridgingCompositionLattice(const IonicAtomicNumber&, const IonicAtomicNumber&) const;
 
 			// Private methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 
 			private:
-				std::unordered_map<std::pair<IonicAtomicNumber, IonicAtomicNumber>, std::vector<ChemicalComposition>, KeyHasher, KeyEqual> _dictionary;
+				std::shared_ptr<const LatticeDictionary> _latticeDictionary;
 			};
 
 
@@ -95,26 +103,12 @@ namespace MathematicalCrystalChemistry
 
 inline bool MathematicalCrystalChemistry::CrystalModel::Constraints::FeasiblePolyhedraConnections::isFeasibleCommonBridgingComposition(const IonicAtomicNumber& iana, const IonicAtomicNumber& ianb, const ChemicalComposition& commonBridgingComposition) const
 {
-	auto iter = _dictionary.find(getIonicAtomicNumberKey(iana, ianb));
+	const CommonBridgingCompositionLattice* commonBridgingCompositionLattice = findCommonBridgingCompositionLattice(iana, ianb);
 
-	if (iter == _dictionary.end())
+	if (commonBridgingCompositionLattice == nullptr)
 		return true;
 	else
-	{
-		if (iter->second.empty())
-			return true;
-
-		else
-		{
-			for (const auto& feasibleComposition : iter->second)
-			{
-				if (feasibleComposition == commonBridgingComposition)
-					return true;
-			}
-
-			return false;
-		}
-	}
+		return commonBridgingCompositionLattice->isFeasibleComposition(commonBridgingComposition);
 }
 
 // Methods
@@ -141,6 +135,22 @@ inline std::pair<MathematicalCrystalChemistry::CrystalModel::Constraints::Feasib
 		return std::make_pair(iana, ianb);
 }
 
+inline const MathematicalCrystalChemistry::CrystalModel::Constraints::CommonBridgingCompositionLattice* MathematicalCrystalChemistry::CrystalModel::Constraints::FeasiblePolyhedraConnections::findCommonBridgingCompositionLattice(const IonicAtomicNumber& iana, const IonicAtomicNumber& ianb) const
+{
+	if (_latticeDictionary)
+	{
+		auto iter = _latticeDictionary->find(getIonicAtomicNumberKey(iana, ianb));
+
+		if (iter == _latticeDictionary->end())
+			return nullptr;
+		else
+			return &(iter->second);
+	}
+
+	else
+		return nullptr;
+}
+
 // Private methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
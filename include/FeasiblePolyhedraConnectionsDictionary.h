@@ -1,6 +1,7 @@
 #ifndef MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_CONSTRAINTS_FEASIBLEPOLYHEDRACONNECTIONSDICTIONARY_H
 #define MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_CONSTRAINTS_FEASIBLEPOLYHEDRACONNECTIONSDICTIONARY_H
 
+#include <memory>
 #include <unordered_map>
 #include <utility>
 
@@ -14,6 +15,7 @@
 #include "ConstrainingAtomicSpecies.h"
 
 #include "CoordinationPolyhedraConnectionParameters.h"
+#include "FeasiblePolyhedraConnections.h"
 
 
 namespace MathematicalCrystalChemistry
@@ -47,6 +49,7 @@ namespace MathematicalCrystalChemistry
 				};
 
 				using FeasibleLinkingDictionary = std::unordered_map<std::pair<IonicAtomicNumber, IonicAtomicNumber>, std::vector<BasicChemicalComposition>, KeyHasher, KeyEqual>;
+				using FeasibleLatticeDictionary = FeasiblePolyhedraConnections::LatticeDictionary;
 
 
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -74,6 +77,7 @@ namespace MathematicalCrystalChemistry
 				static void initialize(const ConstrainingChemicalComposition& constrainingCrystalComposition);
 
 				static FeasibleLinkingDictionary& getDictionary() noexcept;
+				static const std::shared_ptr<const FeasibleLatticeDictionary>& getLatticeDictionary() noexcept;
 
 			// Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -92,6 +96,7 @@ namespace MathematicalCrystalChemistry
 				static CoordinationPolyhedraConnectionParameters s_coordinationPolyhedraConnectionParameters;
 
 				static FeasibleLinkingDictionary s_feasiblePolyhedraLinkingDictionary;
+				static std::shared_ptr<const FeasibleLatticeDictionary> s_feasiblePolyhedraLatticeDictionary;
 			};
 
 
@@ -123,6 +128,11 @@ inline std::unordered_map<std::pair<MathematicalCrystalChemistry::CrystalModel::
 	return s_feasiblePolyhedraLinkingDictionary;
 }
 
+inline const std::shared_ptr<const MathematicalCrystalChemistry::CrystalModel::Constraints::FeasiblePolyhedraConnectionsDictionary::FeasibleLatticeDictionary>& MathematicalCrystalChemistry::CrystalModel::Constraints::FeasiblePolyhedraConnectionsDictionary::getLatticeDictionary() noexcept
+{
+	return s_feasiblePolyhedraLatticeDictionary;
+}
+
 // Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -0,0 +1,420 @@
+#ifndef CHEMTOOLKIT_GENERIC_FLATCHEMICALCOMPOSITION_H
+#define CHEMTOOLKIT_GENERIC_FLATCHEMICALCOMPOSITION_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "AtomicNumber.h"
+#include "ChemicalComposition.h"
+
+
+namespace ChemToolkit
+{
+	namespace Generic
+	{
+		class FlatChemicalComposition
+		{
+		public:
+			using AtomicSpecies = AtomicNumber;
+			using size_type = AtomicNumber::size_type;
+
+			using value_type = std::pair<size_type, size_type>;
+			using const_iterator = const value_type*;
+
+
+			struct Hasher
+			{
+				std::size_t operator()(const FlatChemicalComposition&) const noexcept;
+			};
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Constructors, destructor, and operators
+
+		public:
+			FlatChemicalComposition() noexcept;
+			explicit FlatChemicalComposition(const ChemicalComposition<AtomicNumber>&);
+
+			~FlatChemicalComposition() = default;
+
+			FlatChemicalComposition(const FlatChemicalComposition&) = default;
+			FlatChemicalComposition(FlatChemicalComposition&&) noexcept = default;
+			FlatChemicalComposition& operator=(const FlatChemicalComposition&) = default;
+			FlatChemicalComposition& operator=(FlatChemicalComposition&&) noexcept = default;
+
+		// Constructors, destructor, and operators
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Property
+
+			const_iterator begin() const noexcept;
+			const_iterator end() const noexcept;
+
+		// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Methods
+
+			size_type count() const noexcept;
+			size_type count(const AtomicSpecies&) const noexcept;
+			size_type countAtomicSpecies() const noexcept;
+
+			bool contains(const AtomicSpecies&) const noexcept;
+			bool includes(const FlatChemicalComposition&) const noexcept;
+			bool isEmpty() const noexcept;
+			void clear() noexcept;
+
+			std::size_t getHashCode() const noexcept;
+
+			void add(const AtomicSpecies&, const size_type numAtoms = 1);
+			void remove(const AtomicSpecies&, const size_type numAtoms = 1) noexcept;
+			void erase(const AtomicSpecies&) noexcept;
+			void join(const FlatChemicalComposition&);
+
+			static std::size_t inlineCapacity() noexcept;
+
+		// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Utility
+
+			std::string toString() const;
+			ChemicalComposition<AtomicNumber> toChemicalComposition() const;
+
+		// Utility
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Private methods
+
+		private:
+			value_type* data() noexcept;
+			value_type* lowerBound(const size_type) noexcept;
+			const value_type* lowerBound(const size_type) const noexcept;
+
+		// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+		private:
+			std::array<value_type, 16> _entries;
+			std::vector<value_type> _heapEntries;
+			size_type _numAtomicSpecies;
+			size_type _numAtoms;
+		};
+
+		inline std::size_t FlatChemicalComposition::Hasher::operator()(const FlatChemicalComposition& fcc) const noexcept
+		{
+			return fcc.getHashCode();
+		}
+
+		inline bool operator<(const FlatChemicalComposition& fcca, const FlatChemicalComposition& fccb) noexcept
+		{
+			if (fcca.count() < fccb.count())
+				return true;
+			else if (fcca.count() > fccb.count())
+				return false;
+			else
+				return std::lexicographical_compare(fcca.begin(), fcca.end(), fccb.begin(), fccb.end());
+		}
+
+		inline bool operator>(const FlatChemicalComposition& fcca, const FlatChemicalComposition& fccb) noexcept
+		{
+			return (fccb < fcca);
+		}
+
+		inline bool operator==(const FlatChemicalComposition& fcca, const FlatChemicalComposition& fccb) noexcept
+		{
+			if (fcca.count() == fccb.count())
+				return std::equal(fcca.begin(), fcca.end(), fccb.begin(), fccb.end());
+			else
+				return false;
+		}
+
+		inline bool operator!=(const FlatChemicalComposition& fcca, const FlatChemicalComposition& fccb) noexcept
+		{
+			return !(fcca == fccb);
+		}
+	}
+}
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Constructors
+
+inline ChemToolkit::Generic::FlatChemicalComposition::FlatChemicalComposition() noexcept
+	: _entries{}
+	, _heapEntries{}
+	, _numAtomicSpecies{ 0 }
+	, _numAtoms{ 0 }
+{
+}
+
+inline ChemToolkit::Generic::FlatChemicalComposition::FlatChemicalComposition(const ChemicalComposition<AtomicNumber>& chemicalComposition)
+	: FlatChemicalComposition{}
+{
+	for (const auto& numAndCount : chemicalComposition)
+		add(numAndCount.first, numAndCount.second);
+}
+
+// Constructors
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Property
+
+inline ChemToolkit::Generic::FlatChemicalComposition::const_iterator ChemToolkit::Generic::FlatChemicalComposition::begin() const noexcept
+{
+	return (_heapEntries.empty() ? _entries.data() : _heapEntries.data());
+}
+
+inline ChemToolkit::Generic::FlatChemicalComposition::const_iterator ChemToolkit::Generic::FlatChemicalComposition::end() const noexcept
+{
+	return (begin() + _numAtomicSpecies);
+}
+
+// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Methods
+
+inline ChemToolkit::Generic::FlatChemicalComposition::size_type ChemToolkit::Generic::FlatChemicalComposition::count() const noexcept
+{
+	return _numAtoms;
+}
+
+inline ChemToolkit::Generic::FlatChemicalComposition::size_type ChemToolkit::Generic::FlatChemicalComposition::count(const AtomicSpecies& atomicNumber) const noexcept
+{
+	const value_type* iter = lowerBound(atomicNumber);
+
+	if ((iter == end()) || !(iter->first == static_cast<size_type>(atomicNumber)))
+		return 0;
+	else
+		return iter->second;
+}
+
+inline ChemToolkit::Generic::FlatChemicalComposition::size_type ChemToolkit::Generic::FlatChemicalComposition::countAtomicSpecies() const noexcept
+{
+	return _numAtomicSpecies;
+}
+
+inline bool ChemToolkit::Generic::FlatChemicalComposition::contains(const AtomicSpecies& atomicNumber) const noexcept
+{
+	return (0 < count(atomicNumber));
+}
+
+inline bool ChemToolkit::Generic::FlatChemicalComposition::includes(const FlatChemicalComposition& chemicalComposition) const noexcept
+{
+	for (const auto& numAndCount : chemicalComposition)
+	{
+		if (count(numAndCount.first) < numAndCount.second)
+			return false;
+	}
+
+	return true;
+}
+
+inline bool ChemToolkit::Generic::FlatChemicalComposition::isEmpty() const noexcept
+{
+	return (0 == _numAtomicSpecies);
+}
+
+inline void ChemToolkit::Generic::FlatChemicalComposition::clear() noexcept
+{
+	_heapEntries.clear();
+	_numAtomicSpecies = 0;
+	_numAtoms = 0;
+}
+
+inline std::size_t ChemToolkit::Generic::FlatChemicalComposition::getHashCode() const noexcept
+{
+	std::uint64_t hashCode = 14695981039346656037ULL;
+	{
+		for (const auto& numAndCount : *this)
+		{
+			hashCode ^= ((static_cast<std::uint64_t>(numAndCount.first) << 16) | static_cast<std::uint64_t>(numAndCount.second));
+			hashCode *= 1099511628211ULL;
+		}
+	}
+
+	return static_cast<std::size_t>(hashCode);
+}
+
+inline void ChemToolkit::Generic::FlatChemicalComposition::add(const AtomicSpecies& atomicNumber, const size_type numAtoms)
+{
+	value_type* iter = lowerBound(atomicNumber);
+
+	if (!(iter == (data() + _numAtomicSpecies)) && (iter->first == static_cast<size_type>(atomicNumber)))
+		iter->second += numAtoms;
+
+	else
+	{
+		const std::ptrdiff_t position = iter - data();
+
+		if (_heapEntries.empty() && (_numAtomicSpecies < inlineCapacity()))
+		{
+			std::move_backward(iter, _entries.data() + _numAtomicSpecies, _entries.data() + _numAtomicSpecies + 1);
+			*iter = std::make_pair(static_cast<size_type>(atomicNumber), numAtoms);
+		}
+
+		else
+		{
+			// Past the inline capacity the entries move to the heap, so an atom with many neighbouring species still fits.
+			if (_heapEntries.empty())
+				_heapEntries.assign(_entries.begin(), _entries.begin() + _numAtomicSpecies);
+
+			_heapEntries.insert(_heapEntries.begin() + position, std::make_pair(static_cast<size_type>(atomicNumber), numAtoms));
+		}
+
+		++_numAtomicSpecies;
+	}
+
+	_numAtoms += numAtoms;
+}
+
+inline void ChemToolkit::Generic::FlatChemicalComposition::remove(const AtomicSpecies& atomicNumber, const size_type numAtoms) noexcept
+{
+	value_type* iter = lowerBound(atomicNumber);
+
+	if (!(iter == (data() + _numAtomicSpecies)) && (iter->first == static_cast<size_type>(atomicNumber)))
+	{
+		if (numAtoms < iter->second)
+		{
+			iter->second -= numAtoms;
+			_numAtoms -= numAtoms;
+		}
+
+		else
+			erase(atomicNumber);
+	}
+}
+
+inline void ChemToolkit::Generic::FlatChemicalComposition::erase(const AtomicSpecies& atomicNumber) noexcept
+{
+	value_type* iter = lowerBound(atomicNumber);
+
+	if (!(iter == (data() + _numAtomicSpecies)) && (iter->first == static_cast<size_type>(atomicNumber)))
+	{
+		_numAtoms -= iter->second;
+
+		if (_heapEntries.empty())
+			std::move(iter + 1, _entries.data() + _numAtomicSpecies, iter);
+		else
+			_heapEntries.erase(_heapEntries.begin() + (iter - _heapEntries.data()));
+
+		--_numAtomicSpecies;
+	}
+}
+
+inline void ChemToolkit::Generic::FlatChemicalComposition::join(const FlatChemicalComposition& chemicalComposition)
+{
+	for (const auto& numAndCount : chemicalComposition)
+		add(numAndCount.first, numAndCount.second);
+}
+
+inline std::size_t ChemToolkit::Generic::FlatChemicalComposition::inlineCapacity() noexcept
+{
+	return 16;
+}
+
+// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Utility
+
+inline std::string ChemToolkit::Generic::FlatChemicalComposition::toString() const
+{
+	return toChemicalComposition().toString();
+}
+
+inline ChemToolkit::Generic::ChemicalComposition<ChemToolkit::Generic::AtomicNumber> ChemToolkit::Generic::FlatChemicalComposition::toChemicalComposition() const
+{
+	ChemicalComposition<AtomicNumber> chemicalComposition;
+	{
+		for (const auto& numAndCount : *this)
+			chemicalComposition.add(AtomicNumber{ numAndCount.first }, numAndCount.second);
+	}
+
+	return chemicalComposition;
+}
+
+// Utility
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+inline ChemToolkit::Generic::FlatChemicalComposition::value_type* ChemToolkit::Generic::FlatChemicalComposition::data() noexcept
+{
+	return (_heapEntries.empty() ? _entries.data() : _heapEntries.data());
+}
+
+inline ChemToolkit::Generic::FlatChemicalComposition::value_type* ChemToolkit::Generic::FlatChemicalComposition::lowerBound(const size_type atomicNumber) noexcept
+{
+	return std::lower_bound(data(), data() + _numAtomicSpecies, atomicNumber, [](const value_type& numAndCount, const size_type number) { return (numAndCount.first < number); });
+}
+
+inline const ChemToolkit::Generic::FlatChemicalComposition::value_type* ChemToolkit::Generic::FlatChemicalComposition::lowerBound(const size_type atomicNumber) const noexcept
+{
+	return std::lower_bound(begin(), end(), atomicNumber, [](const value_type& numAndCount, const size_type number) { return (numAndCount.first < number); });
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+
+#endif // !CHEMTOOLKIT_GENERIC_FLATCHEMICALCOMPOSITION_H
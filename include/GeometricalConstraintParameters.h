@@ -1,6 +1,8 @@
 #ifndef MATHEMATICALCRYSTALCHEMISTRY_DESIGN_OPTIMIZATION_GEOMETRICALCONSTRAINTPARAMETERS_H
 #define MATHEMATICALCRYSTALCHEMISTRY_DESIGN_OPTIMIZATION_GEOMETRICALCONSTRAINTPARAMETERS_H
 
+#include <string>
+
 #include "ArgumentOutOfRangeException.h"
 
 #include "StreamReader.h"
@@ -35,27 +37,41 @@ namespace MathematicalCrystalChemistry
 
 				size_type interatomicDistanceTracerTimeout() const noexcept;
 				size_type unitCellReductionTimeout() const noexcept;
+				double maxUnitCellSkewness() const noexcept;
+				double minimumUnitCellAngle() const noexcept;
 				double minimumExclusionDistanceRatio() const noexcept;
 				double interatomicDistanceTracerCutoffRatio() const noexcept;
 				double interatomicDistanceConstrainerCutoffRatio() const noexcept;
+				size_type parallelConstrainingAtomThreshold() const noexcept;
+				bool needReductionValidation() const noexcept;
 
 				static size_type defaultInteratomicDistanceTracerTimeout() noexcept;
 				static size_type defaultUnitCellReductionTimeout() noexcept;
+				static double defaultMaxUnitCellSkewness() noexcept;
+				static double defaultMinimumUnitCellAngle() noexcept;
 				static double defaultMinimumExclusionDistanceRatio() noexcept;
 				static double defaultInteratomicDistanceTracerCutoffRatio() noexcept;
 				static double defaultInteratomicDistanceConstrainerCutoffRatio() noexcept;
+				static size_type defaultParallelConstrainingAtomThreshold() noexcept;
 
 
 				void setInteratomicDistanceTracerTimeout() noexcept;
 				void setInteratomicDistanceTracerTimeout(const size_type);
 				void setUnitCellReductionTimeout() noexcept;
 				void setUnitCellReductionTimeout(const size_type);
+				void setMaxUnitCellSkewness() noexcept;
+				void setMaxUnitCellSkewness(const double);
+				void setMinimumUnitCellAngle() noexcept;
+				void setMinimumUnitCellAngle(const double);
 				void setMinimumExclusionDistanceRatio() noexcept;
 				void setMinimumExclusionDistanceRatio(const double);
 				void setInteratomicDistanceTracerCutoffRatio() noexcept;
 				void setInteratomicDistanceTracerCutoffRatio(const double);
 				void setInteratomicDistanceConstrainerCutoffRatio() noexcept;
 				void setInteratomicDistanceConstrainerCutoffRatio(const double);
+				void setParallelConstrainingAtomThreshold() noexcept;
+				void setParallelConstrainingAtomThreshold(const size_type);
+				void setReductionValidationNecessity(const bool) noexcept;
 
 			// Property
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -72,6 +88,7 @@ namespace MathematicalCrystalChemistry
 
 			private:
 				void validateInitializedValues();
+				bool toNecessity(const std::string&) const;
 
 			// Private methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -79,15 +96,22 @@ namespace MathematicalCrystalChemistry
 			private:
 				size_type _interatomicDistanceTracerTimeout;
 				size_type _unitCellReductionTimeout;
+				double _maxUnitCellSkewness;
+				double _minimumUnitCellAngle;
 				double _minimumExclusionDistanceRatio;
 				double _interatomicDistanceTracerCutoffRatio;
 				double _interatomicDistanceConstrainerCutoffRatio;
+				size_type _parallelConstrainingAtomThreshold;
+				bool _needReductionValidation;
 
 				static size_type s_defaultInteratomicDistanceTracerTimeout;
 				static size_type s_defaultUnitCellReductionTimeout;
+				static double s_defaultMaxUnitCellSkewness;
+				static double s_defaultMinimumUnitCellAngle;
 				static double s_defaultMinimumExclusionDistanceRatio;
 				static double s_defaultInteratomicDistanceTracerCutoffRatio;
 				static double s_defaultInteratomicDistanceConstrainerCutoffRatio;
+				static size_type s_defaultParallelConstrainingAtomThreshold;
 			};
 		}
 	}
@@ -112,6 +136,16 @@ inline MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraint
 	return _unitCellReductionTimeout;
 }
 
+inline double MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::maxUnitCellSkewness() const noexcept
+{
+	return _maxUnitCellSkewness;
+}
+
+inline double MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::minimumUnitCellAngle() const noexcept
+{
+	return _minimumUnitCellAngle;
+}
+
 inline double MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::minimumExclusionDistanceRatio() const noexcept
 {
 	return _minimumExclusionDistanceRatio;
@@ -127,6 +161,16 @@ inline double MathematicalCrystalChemistry::Design::Optimization::GeometricalCon
 	return _interatomicDistanceConstrainerCutoffRatio;
 }
 
+inline MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::size_type MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::parallelConstrainingAtomThreshold() const noexcept
+{
+	return _parallelConstrainingAtomThreshold;
+}
+
+inline bool MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::needReductionValidation() const noexcept
+{
+	return _needReductionValidation;
+}
+
 inline MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::size_type MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultInteratomicDistanceTracerTimeout() noexcept
 {
 	return s_defaultInteratomicDistanceTracerTimeout;
@@ -137,6 +181,16 @@ inline MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraint
 	return s_defaultUnitCellReductionTimeout;
 }
 
+inline double MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultMaxUnitCellSkewness() noexcept
+{
+	return s_defaultMaxUnitCellSkewness;
+}
+
+inline double MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultMinimumUnitCellAngle() noexcept
+{
+	return s_defaultMinimumUnitCellAngle;
+}
+
 inline double MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultMinimumExclusionDistanceRatio() noexcept
 {
 	return s_defaultMinimumExclusionDistanceRatio;
@@ -152,6 +206,11 @@ inline double MathematicalCrystalChemistry::Design::Optimization::GeometricalCon
 	return s_defaultInteratomicDistanceConstrainerCutoffRatio;
 }
 
+inline MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::size_type MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultParallelConstrainingAtomThreshold() noexcept
+{
+	return s_defaultParallelConstrainingAtomThreshold;
+}
+
 inline void MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::setInteratomicDistanceTracerTimeout() noexcept
 {
 	_interatomicDistanceTracerTimeout = s_defaultInteratomicDistanceTracerTimeout;
@@ -178,6 +237,32 @@ inline void MathematicalCrystalChemistry::Design::Optimization::GeometricalConst
 		throw System::ExceptionServices::ArgumentOutOfRangeException{ typeid(*this), "setUnitCellReductionTimeout", "Input value is zero." };
 }
 
+inline void MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::setMaxUnitCellSkewness() noexcept
+{
+	_maxUnitCellSkewness = s_defaultMaxUnitCellSkewness;
+}
+
+inline void MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::setMaxUnitCellSkewness(const double val)
+{
+	if (1.0 < val)
+		_maxUnitCellSkewness = val;
+	else
+		throw System::ExceptionServices::ArgumentOutOfRangeException{ typeid(*this), "setMaxUnitCellSkewness", "Input value is not more than one." };
+}
+
+inline void MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::setMinimumUnitCellAngle() noexcept
+{
+	_minimumUnitCellAngle = s_defaultMinimumUnitCellAngle;
+}
+
+inline void MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::setMinimumUnitCellAngle(const double val)
+{
+	if ((0.0 < val) && (val < 90.0))
+		_minimumUnitCellAngle = val;
+	else
+		throw System::ExceptionServices::ArgumentOutOfRangeException{ typeid(*this), "setMinimumUnitCellAngle", "Input value is out of range." };
+}
+
 inline void MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::setMinimumExclusionDistanceRatio() noexcept
 {
 	_minimumExclusionDistanceRatio = s_defaultMinimumExclusionDistanceRatio;
@@ -217,6 +302,24 @@ inline void MathematicalCrystalChemistry::Design::Optimization::GeometricalConst
 		throw System::ExceptionServices::ArgumentOutOfRangeException{ typeid(*this), "setInteratomicDistanceConstrainerCutoffRatio", "Input value is not more than zero." };
 }
 
+inline void MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::setParallelConstrainingAtomThreshold() noexcept
+{
+	_parallelConstrainingAtomThreshold = s_defaultParallelConstrainingAtomThreshold;
+}
+
+inline void MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::setParallelConstrainingAtomThreshold(const size_type val)
+{
+	if (0 < val)
+		_parallelConstrainingAtomThreshold = val;
+	else
+		throw System::ExceptionServices::ArgumentOutOfRangeException{ typeid(*this), "setParallelConstrainingAtomThreshold", "Input value is zero." };
+}
+
+inline void MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::setReductionValidationNecessity(const bool necessity) noexcept
+{
+	_needReductionValidation = necessity;
+}
+
 // Property
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
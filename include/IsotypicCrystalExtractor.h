@@ -1,9 +1,18 @@
 #ifndef MATHEMATICALCRYSTALCHEMISTRY_ANALYSIS_ISOTYPICCRYSTALEXTRACTOR_H
 #define MATHEMATICALCRYSTALCHEMISTRY_ANALYSIS_ISOTYPICCRYSTALEXTRACTOR_H
 
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 #include "ArgumentOutOfRangeException.h"
 
 #include "OptimalCrystalStructure.h"
+#include "StructuralHash.h"
 
 #include "IsotypicCrystalExtractionParameters.h"
 
@@ -16,6 +25,24 @@ namespace MathematicalCrystalChemistry
 		{
 			using OptimalAtom = MathematicalCrystalChemistry::CrystalModel::Components::OptimalAtom;
 			using OptimalCrystalStructure = MathematicalCrystalChemistry::CrystalModel::Components::OptimalCrystalStructure;
+			using StructuralHash = MathematicalCrystalChemistry::CrystalModel::Components::StructuralHash;
+
+
+			struct FingerprintIndexEntry
+			{
+				std::pair<std::uint64_t, std::uint64_t> fingerprintHash;
+				std::int64_t lastWriteTime;
+				std::filesystem::path cifFilePath;
+			};
+
+			using FingerprintIndex = std::vector<FingerprintIndexEntry>;
+
+			struct FingerprintIndexState
+			{
+				std::shared_ptr<const FingerprintIndex> fingerprintIndex;
+				std::chrono::steady_clock::time_point refreshTime;
+			};
+
 
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 		// Constructors, destructor, and operators
@@ -48,6 +75,8 @@ namespace MathematicalCrystalChemistry
 			bool isSame(const OptimalCrystalStructure&, const OptimalCrystalStructure&) const;
 			bool isRegisteredCrystal(const OptimalCrystalStructure&) const;
 
+			void updateFingerprintIndex() const;
+
 		// Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -55,12 +84,28 @@ namespace MathematicalCrystalChemistry
 
 		private:
 			std::string readFingerprint(const std::filesystem::path&) const;
+			std::vector<std::string> readFingerprints(const std::vector<std::filesystem::path>&) const;
+
+			std::shared_ptr<const FingerprintIndex> getFingerprintIndex() const;
+			FingerprintIndex readFingerprintIndex(const std::filesystem::path&) const;
+			void writeFingerprintIndex(const std::filesystem::path&, const FingerprintIndex&) const;
+
+			static std::pair<std::uint64_t, std::uint64_t> toFingerprintHash(const std::string&) noexcept;
+			static std::int64_t getLastWriteTime(const std::filesystem::path&);
+			static std::filesystem::path toFingerprintFilePath(const std::filesystem::path& cifFilePath);
 
 		// Private methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 
 		private:
 			IsotypicCrystalExtractionParameters _crystalIdentificationParameters;
+
+			static std::string s_fingerprintIndexFilename;
+			static std::uint64_t s_fingerprintIndexSignature;
+			static std::chrono::seconds s_fingerprintIndexRefreshInterval;
+			static std::map<std::string, FingerprintIndexState> s_fingerprintIndices;
+			static std::mutex s_fingerprintIndexMutex;
+			static std::mutex s_fingerprintIndexUpdateMutex;
 		};
 	}
 }
@@ -109,8 +154,11 @@ inline bool MathematicalCrystalChemistry::Analysis::IsotypicCrystalExtractor::is
 		latterConventionalStructure.conventionalizeStructure(_crystalIdentificationParameters.spaceGroupPrecision());
 	}
 
-	if (formerConventionalStructure.toStructuralFingerprint() == latterConventionalStructure.toStructuralFingerprint())
-		return true;
+	const auto formerUniqueAtoms = formerConventionalStructure.getUniqueOptimalAtoms();
+	const auto latterUniqueAtoms = latterConventionalStructure.getUniqueOptimalAtoms();
+
+	if (formerConventionalStructure.toStructuralHash(formerUniqueAtoms) == latterConventionalStructure.toStructuralHash(latterUniqueAtoms))
+		return (formerConventionalStructure.toStructuralFingerprint(formerUniqueAtoms) == latterConventionalStructure.toStructuralFingerprint(latterUniqueAtoms));
 	else
 		return false;
 }
@@ -123,6 +171,46 @@ inline bool MathematicalCrystalChemistry::Analysis::IsotypicCrystalExtractor::is
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+inline std::pair<std::uint64_t, std::uint64_t> MathematicalCrystalChemistry::Analysis::IsotypicCrystalExtractor::toFingerprintHash(const std::string& structureFingerprint) noexcept
+{
+	StructuralHash fingerprintHash;
+	fingerprintHash.add(structureFingerprint);
+
+	return std::make_pair(fingerprintHash.high(), fingerprintHash.low());
+}
+
+inline std::int64_t MathematicalCrystalChemistry::Analysis::IsotypicCrystalExtractor::getLastWriteTime(const std::filesystem::path& filePath)
+{
+	return static_cast<std::int64_t>(std::filesystem::last_write_time(filePath).time_since_epoch().count());
+}
+
+inline std::filesystem::path MathematicalCrystalChemistry::Analysis::IsotypicCrystalExtractor::toFingerprintFilePath(const std::filesystem::path& cifFilePath)
+{
+	std::filesystem::path fingerprintFilePath = cifFilePath.parent_path();
+	{
+		fingerprintFilePath /= cifFilePath.stem().string();
+		fingerprintFilePath += "_fingerprint.txt";
+	}
+
+	return fingerprintFilePath;
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
 
 
 #endif // !MATHEMATICALCRYSTALCHEMISTRY_ANALYSIS_ISOTYPICCRYSTALEXTRACTOR_H
@@ -1,6 +1,9 @@
 #ifndef MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_COMPONENTS_INTERNAL_LINKEDPOLYHEDRARETRIEVER_H
 #define MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_COMPONENTS_INTERNAL_LINKEDPOLYHEDRARETRIEVER_H
 
+#include <vector>
+#include <unordered_map>
+
 #include "IonicAtomicNumber.h"
 #include "FeasiblePolyhedraConnections.h"
 
@@ -17,9 +20,15 @@ namespace MathematicalCrystalChemistry
 			{
 				class LinkedPolyhedraRetriever :public CoordinationPolyhedraRetriever
 				{
-					using LinkingList = std::vector<std::pair<ConstrainerIndices<TranslatedAtomIndex>, std::vector<TranslatedAtomIndex>>>;
 					using LinkingDictionary = std::unordered_map<ConstrainerIndices<TranslatedAtomIndex>, std::vector<TranslatedAtomIndex>, ConstrainerIndices<TranslatedAtomIndex>::Hasher>;
 
+					struct PolyhedraLinkingRecord
+					{
+						std::vector<OriginalAtomIndex> chemicalBondedOriginalAtomIndices;
+						std::vector<TranslatedAtomIndex> chemicalBondedTranslatedAtomIndices;
+						std::vector<ConstrainerIndices<TranslatedAtomIndex>> linkingIndices;
+					};
+
 				protected:
 					using IonicAtomicNumber = ChemToolkit::Generic::IonicAtomicNumber;
 					using FeasiblePolyhedraConnections = MathematicalCrystalChemistry::CrystalModel::Constraints::FeasiblePolyhedraConnections;
@@ -54,7 +63,7 @@ namespace MathematicalCrystalChemistry
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 				// Public methods
 
-					LinkingList getCoordinationPolyhedraLinkings() const;
+					const LinkingDictionary& getCoordinationPolyhedraLinkings() const;
 
 				// Public methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -70,6 +79,10 @@ namespace MathematicalCrystalChemistry
 				// Private methods
 
 				private:
+					void updatePolyhedraLinkings() const;
+					void erasePolyhedraLinkings(const OriginalAtomIndex) const;
+					void insertPolyhedraLinkings(const OriginalAtomIndex, const LinkingDictionary&) const;
+
 					void addPolyhedraLinkings(const OriginalAtomIndex, const std::vector<OriginalAtomIndex>&, LinkingDictionary&) const;
 					void addPolyhedraLinkings(const OriginalAtomIndex, const std::vector<TranslatedAtomIndex>&, LinkingDictionary&) const;
 					void addPolyhedraLinkings(const OriginalAtomIndex, const std::vector<OriginalAtomIndex>&, const std::vector<TranslatedAtomIndex>&, LinkingDictionary&) const;
@@ -88,6 +101,9 @@ namespace MathematicalCrystalChemistry
 
 				private:
 					FeasiblePolyhedraConnections _feasiblePolyhedraConnections;
+
+					mutable LinkingDictionary m_linkingDictionary;
+					mutable std::vector<PolyhedraLinkingRecord> m_polyhedraLinkingRecords;
 				};
 			}
 		}
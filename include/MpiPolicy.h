@@ -31,12 +31,14 @@ namespace System
 		public:
 			static size_type mpiRank() noexcept;
 			static size_type mpiProcessing() noexcept;
+			static bool isMpiThreadSerialized() noexcept;
 
 			static bool isMpiDirectoryName(const std::string& directoryName);
 			static std::string getMpiDirectoryName() noexcept;
 
 			static void setMpiRank(const size_type mpiRank) noexcept;
 			static void setMpiProcessing(const size_type mpiProcessing);
+			static void setMpiThreadSerialized(const bool isSerialized) noexcept;
 
 		// Public methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -44,6 +46,7 @@ namespace System
 		private:
 			static size_type s_mpiRank;
 			static size_type s_mpiProcessing;
+			static bool s_isMpiThreadSerialized;
 
 
 		private:
@@ -74,6 +77,11 @@ inline System::Parallel::MpiPolicy::size_type System::Parallel::MpiPolicy::mpiPr
 	return s_mpiProcessing;
 }
 
+inline bool System::Parallel::MpiPolicy::isMpiThreadSerialized() noexcept
+{
+	return s_isMpiThreadSerialized;
+}
+
 inline std::string System::Parallel::MpiPolicy::getMpiDirectoryName() noexcept
 {
 	std::string directoryName;
@@ -98,6 +106,11 @@ inline void System::Parallel::MpiPolicy::setMpiProcessing(const size_type value)
 		throw System::ExceptionServices::ArgumentOutOfRangeException{ "System::Parallel::MpiPolicy::setMpiProcessing", "The number of mpi processing is not more than zero." };
 }
 
+inline void System::Parallel::MpiPolicy::setMpiThreadSerialized(const bool isSerialized) noexcept
+{
+	s_isMpiThreadSerialized = isSerialized;
+}
+
 // Public methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -0,0 +1,170 @@
+#ifndef MATHEMATICALCRYSTALCHEMISTRY_DESIGN_DIAGNOSTICS_NEARDUPLICATEDETECTIONPARAMETERS_H
+#define MATHEMATICALCRYSTALCHEMISTRY_DESIGN_DIAGNOSTICS_NEARDUPLICATEDETECTIONPARAMETERS_H
+
+#include <string>
+
+#include "ArgumentOutOfRangeException.h"
+#include "StreamReader.h"
+
+
+namespace MathematicalCrystalChemistry
+{
+	namespace Design
+	{
+		namespace Diagnostics
+		{
+			class NearDuplicateDetectionParameters
+			{
+				using size_type = std::size_t;
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Constructors, destructor, and operators
+
+			public:
+				NearDuplicateDetectionParameters() noexcept;
+				virtual ~NearDuplicateDetectionParameters() = default;
+
+				NearDuplicateDetectionParameters(const NearDuplicateDetectionParameters&) = default;
+				NearDuplicateDetectionParameters(NearDuplicateDetectionParameters&&) noexcept = default;
+				NearDuplicateDetectionParameters& operator=(const NearDuplicateDetectionParameters&) = default;
+				NearDuplicateDetectionParameters& operator=(NearDuplicateDetectionParameters&&) noexcept = default;
+
+			// Constructors, destructor, and operators
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Property
+
+				bool needDetection() const noexcept;
+				double similarityThreshold() const noexcept;
+				double radialCutoff() const noexcept;
+				size_type numRadialBins() const noexcept;
+
+				static double defaultSimilarityThreshold() noexcept;
+				static double defaultRadialCutoff() noexcept;
+				static size_type defaultNumRadialBins() noexcept;
+
+
+				void setDetectionNecessity(const bool) noexcept;
+				void setSimilarityThreshold(const double);
+				void setRadialCutoff(const double);
+				void setNumRadialBins(const size_type);
+
+			// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Methods
+
+				void initialize() noexcept;
+				void initialize(const System::IO::StreamReader&);
+
+			// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Private methods
+
+			private:
+				bool toNecessity(const std::string&) const;
+
+				void validateInitializedValues() const;
+
+			// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+			private:
+				bool _needDetection;
+				double _similarityThreshold;
+				double _radialCutoff;
+				size_type _numRadialBins;
+
+				static double s_defaultSimilarityThreshold;
+				static double s_defaultRadialCutoff;
+				static size_type s_defaultNumRadialBins;
+			};
+		}
+	}
+}
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Property
+
+inline bool MathematicalCrystalChemistry::Design::Diagnostics::NearDuplicateDetectionParameters::needDetection() const noexcept
+{
+	return _needDetection;
+}
+
+inline double MathematicalCrystalChemistry::Design::Diagnostics::NearDuplicateDetectionParameters::similarityThreshold() const noexcept
+{
+	return _similarityThreshold;
+}
+
+inline double MathematicalCrystalChemistry::Design::Diagnostics::NearDuplicateDetectionParameters::radialCutoff() const noexcept
+{
+	return _radialCutoff;
+}
+
+inline MathematicalCrystalChemistry::Design::Diagnostics::NearDuplicateDetectionParameters::size_type MathematicalCrystalChemistry::Design::Diagnostics::NearDuplicateDetectionParameters::numRadialBins() const noexcept
+{
+	return _numRadialBins;
+}
+
+inline double MathematicalCrystalChemistry::Design::Diagnostics::NearDuplicateDetectionParameters::defaultSimilarityThreshold() noexcept
+{
+	return s_defaultSimilarityThreshold;
+}
+
+inline double MathematicalCrystalChemistry::Design::Diagnostics::NearDuplicateDetectionParameters::defaultRadialCutoff() noexcept
+{
+	return s_defaultRadialCutoff;
+}
+
+inline MathematicalCrystalChemistry::Design::Diagnostics::NearDuplicateDetectionParameters::size_type MathematicalCrystalChemistry::Design::Diagnostics::NearDuplicateDetectionParameters::defaultNumRadialBins() noexcept
+{
+	return s_defaultNumRadialBins;
+}
+
+inline void MathematicalCrystalChemistry::Design::Diagnostics::NearDuplicateDetectionParameters::setDetectionNecessity(const bool necessity) noexcept
+{
+	_needDetection = necessity;
+}
+
+inline void MathematicalCrystalChemistry::Design::Diagnostics::NearDuplicateDetectionParameters::setSimilarityThreshold(const double val)
+{
+	if ((0.0 < val) && (val <= 1.0))
+		_similarityThreshold = val;
+	else
+		throw System::ExceptionServices::ArgumentOutOfRangeException{ typeid(*this), "setSimilarityThreshold", "Argument value is not in the range of (0, 1]." };
+}
+
+inline void MathematicalCrystalChemistry::Design::Diagnostics::NearDuplicateDetectionParameters::setRadialCutoff(const double val)
+{
+	if (0.0 < val)
+		_radialCutoff = val;
+	else
+		throw System::ExceptionServices::ArgumentOutOfRangeException{ typeid(*this), "setRadialCutoff", "Argument value not more than zero." };
+}
+
+inline void MathematicalCrystalChemistry::Design::Diagnostics::NearDuplicateDetectionParameters::setNumRadialBins(const size_type numBins)
+{
+	if (0 < numBins)
+		_numRadialBins = numBins;
+	else
+		throw System::ExceptionServices::ArgumentOutOfRangeException{ typeid(*this), "setNumRadialBins", "Argument value is zero." };
+}
+
+// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+
+#endif // !MATHEMATICALCRYSTALCHEMISTRY_DESIGN_DIAGNOSTICS_NEARDUPLICATEDETECTIONPARAMETERS_H
@@ -1,6 +1,7 @@
 #ifndef MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_COMPONENTS_OBJECTIVECRYSTALSTRUCTURE_H
 #define MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_COMPONENTS_OBJECTIVECRYSTALSTRUCTURE_H
 
+#include <memory>
 #include <vector>
 
 #include "IonicAtomicNumber.h"
@@ -26,6 +27,7 @@ namespace MathematicalCrystalChemistry
 
 				using UnitCell = ChemToolkit::Crystallography::UnitCell;
 				using CoordinationConstraints = MathematicalCrystalChemistry::CrystalModel::Constraints::CoordinationConstraints;
+				using CoordinationConstraintsHandle = std::shared_ptr<const CoordinationConstraints>;
 
 				using OriginalConstrainerIndices = ConstrainerIndices<OriginalAtomIndex>;
 				using TranslatedConstrainerIndices = ConstrainerIndices<TranslatedAtomIndex>;
@@ -35,8 +37,8 @@ namespace MathematicalCrystalChemistry
 
 			public:
 				ObjectiveCrystalStructure() noexcept;
-				ObjectiveCrystalStructure(const UnitCell&, const std::vector<SphericalAtom>&, const std::vector<IonicAtomicNumber>&, const std::vector<CoordinationConstraints>&) noexcept;
-				ObjectiveCrystalStructure(const UnitCell&, std::vector<SphericalAtom>&&, std::vector<IonicAtomicNumber>&&, std::vector<CoordinationConstraints>&&) noexcept;
+				ObjectiveCrystalStructure(const UnitCell&, const std::vector<SphericalAtom>&, const std::vector<IonicAtomicNumber>&, const std::vector<CoordinationConstraintsHandle>&) noexcept;
+				ObjectiveCrystalStructure(const UnitCell&, std::vector<SphericalAtom>&&, std::vector<IonicAtomicNumber>&&, std::vector<CoordinationConstraintsHandle>&&) noexcept;
 
 				explicit ObjectiveCrystalStructure(const ConstrainingCrystalStructure&);
 
@@ -53,7 +55,7 @@ namespace MathematicalCrystalChemistry
 			// Property
 
 				const std::vector<IonicAtomicNumber>& correspondingIonicAtomicNumbers() const noexcept;
-				const std::vector<CoordinationConstraints>& correspondingCoordinationConstraints() const noexcept;
+				const std::vector<CoordinationConstraintsHandle>& correspondingCoordinationConstraints() const noexcept;
 
 				const std::vector<OriginalConstrainerIndices>& covalentBondedIndices() const noexcept;
 				const std::vector<OriginalConstrainerIndices>& covalentExcludedIndices() const noexcept;
@@ -108,6 +110,8 @@ namespace MathematicalCrystalChemistry
 			// Private methods
 
 			private:
+				void importInteratomicDistanceConstraints(const ConstrainingCrystalStructure&);
+
 				bool isFeasibleDistance(const OriginalAtomIndex, const OriginalAtomIndex, const double minimumDistance, const double maximumDistance, const double feasibleErrorRate) const noexcept;
 				bool isFeasibleDistance(const OriginalAtomIndex, const TranslatedAtomIndex&, const double minimumDistance, const double maximumDistance, const double feasibleErrorRate) const noexcept;
 				bool isFeasibleDistance(const OriginalAtomIndex, const OriginalAtomIndex, const double minimumDistance, const double feasibleErrorRate) const noexcept;
@@ -118,7 +122,7 @@ namespace MathematicalCrystalChemistry
 
 			private:
 				std::vector<IonicAtomicNumber> _correspondingIonicAtomicNumbers;
-				std::vector<CoordinationConstraints> _correspondingCoordinationConstraints;
+				std::vector<CoordinationConstraintsHandle> _correspondingCoordinationConstraints;
 
 				std::vector<OriginalConstrainerIndices> _covalentBondedIndices;
 				std::vector<OriginalConstrainerIndices> _covalentExcludedIndices;
@@ -150,7 +154,7 @@ inline const std::vector<MathematicalCrystalChemistry::CrystalModel::Components:
 	return _correspondingIonicAtomicNumbers;
 }
 
-inline const std::vector<MathematicalCrystalChemistry::CrystalModel::Components::ObjectiveCrystalStructure::CoordinationConstraints>& MathematicalCrystalChemistry::CrystalModel::Components::ObjectiveCrystalStructure::correspondingCoordinationConstraints() const noexcept
+inline const std::vector<MathematicalCrystalChemistry::CrystalModel::Components::ObjectiveCrystalStructure::CoordinationConstraintsHandle>& MathematicalCrystalChemistry::CrystalModel::Components::ObjectiveCrystalStructure::correspondingCoordinationConstraints() const noexcept
 {
 	return _correspondingCoordinationConstraints;
 }
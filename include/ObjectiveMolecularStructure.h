@@ -1,6 +1,7 @@
 #ifndef MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_COMPONENTS_OBJECTIVEMOLECULARSTRUCTURE_H
 #define MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_COMPONENTS_OBJECTIVEMOLECULARSTRUCTURE_H
 
+#include <memory>
 #include <vector>
 
 #include "AtomicNumber.h"
@@ -25,6 +26,7 @@ namespace MathematicalCrystalChemistry
 				using IonicAtomicNumber = ChemToolkit::Generic::IonicAtomicNumber;
 				using UnitCell = ChemToolkit::Crystallography::UnitCell;
 				using CoordinationConstraints = MathematicalCrystalChemistry::CrystalModel::Constraints::CoordinationConstraints;
+				using CoordinationConstraintsHandle = std::shared_ptr<const CoordinationConstraints>;
 
 				using OriginalConstrainerIndices = ConstrainerIndices<OriginalAtomIndex>;
 				using TranslatedConstrainerIndices = ConstrainerIndices<TranslatedAtomIndex>;
@@ -34,8 +36,8 @@ namespace MathematicalCrystalChemistry
 
 			public:
 				ObjectiveMolecularStructure() noexcept;
-				ObjectiveMolecularStructure(const UnitCell&, const std::vector<SphericalAtom>&, const std::vector<IonicAtomicNumber>&, const std::vector<CoordinationConstraints>&) noexcept;
-				ObjectiveMolecularStructure(const UnitCell&, std::vector<SphericalAtom>&&, std::vector<IonicAtomicNumber>&&, std::vector<CoordinationConstraints>&&) noexcept;
+				ObjectiveMolecularStructure(const UnitCell&, const std::vector<SphericalAtom>&, const std::vector<IonicAtomicNumber>&, const std::vector<CoordinationConstraintsHandle>&) noexcept;
+				ObjectiveMolecularStructure(const UnitCell&, std::vector<SphericalAtom>&&, std::vector<IonicAtomicNumber>&&, std::vector<CoordinationConstraintsHandle>&&) noexcept;
 
 				explicit ObjectiveMolecularStructure(const ConstrainingMolecularStructure&);
 
@@ -52,7 +54,7 @@ namespace MathematicalCrystalChemistry
 			// Property
 
 				const std::vector<IonicAtomicNumber>& correspondingIonicAtomicNumbers() const noexcept;
-				const std::vector<CoordinationConstraints>& correspondingCoordinationConstraints() const noexcept;
+				const std::vector<CoordinationConstraintsHandle>& correspondingCoordinationConstraints() const noexcept;
 
 				const std::vector<OriginalConstrainerIndices>& covalentBondedIndices() const noexcept;
 				const std::vector<OriginalConstrainerIndices>& covalentExcludedIndices() const noexcept;
@@ -97,7 +99,7 @@ namespace MathematicalCrystalChemistry
 
 			private:
 				std::vector<IonicAtomicNumber> _correspondingIonicAtomicNumbers;
-				std::vector<CoordinationConstraints> _correspondingCoordinationConstraints;
+				std::vector<CoordinationConstraintsHandle> _correspondingCoordinationConstraints;
 
 				std::vector<OriginalConstrainerIndices> _covalentBondedIndices;
 				std::vector<OriginalConstrainerIndices> _covalentExcludedIndices;
@@ -123,7 +125,7 @@ inline const std::vector<MathematicalCrystalChemistry::CrystalModel::Components:
 	return _correspondingIonicAtomicNumbers;
 }
 
-inline const std::vector<MathematicalCrystalChemistry::CrystalModel::Components::ObjectiveMolecularStructure::CoordinationConstraints>& MathematicalCrystalChemistry::CrystalModel::Components::ObjectiveMolecularStructure::correspondingCoordinationConstraints() const noexcept
+inline const std::vector<MathematicalCrystalChemistry::CrystalModel::Components::ObjectiveMolecularStructure::CoordinationConstraintsHandle>& MathematicalCrystalChemistry::CrystalModel::Components::ObjectiveMolecularStructure::correspondingCoordinationConstraints() const noexcept
 {
 	return _correspondingCoordinationConstraints;
 }
@@ -12,6 +12,7 @@
 
 #include "CoordinationConstraints.h"
 #include "IonicAtomicNumber.h"
+#include "StructuralHash.h"
 
 
 namespace MathematicalCrystalChemistry
@@ -61,6 +62,11 @@ namespace MathematicalCrystalChemistry
 				void addEdgeSharings(const std::pair<IonicAtomicNumber, std::array<IonicAtomicNumber, 2>>&) noexcept;
 				void addFaceSharings(const std::pair<IonicAtomicNumber, std::vector<IonicAtomicNumber>>&) noexcept;
 
+				void setCoordinations(std::vector<IonicAtomicNumber>&&) noexcept;
+				void setVertexSharings(std::vector<std::pair<IonicAtomicNumber, IonicAtomicNumber>>&&) noexcept;
+				void setEdgeSharings(std::vector<std::pair<IonicAtomicNumber, std::array<IonicAtomicNumber, 2>>>&&) noexcept;
+				void setFaceSharings(std::vector<std::pair<IonicAtomicNumber, std::vector<IonicAtomicNumber>>>&&) noexcept;
+
 				void clearCoordinations() noexcept;
 				void clearVertexSharings() noexcept;
 				void clearEdgeSharings() noexcept;
@@ -80,6 +86,9 @@ namespace MathematicalCrystalChemistry
 				std::string getFingerprint() const;
 				std::string getDetailedFingerprint() const;
 
+				StructuralHash getFingerprintHash() const;
+				StructuralHash getDetailedFingerprintHash() const;
+
 			// Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -91,6 +100,8 @@ namespace MathematicalCrystalChemistry
 				void writeEdgeSharings(System::IO::StreamWriter&) const;
 				void writeFaceSharings(System::IO::StreamWriter&) const;
 
+				static void addIonicAtomicNumber(StructuralHash&, const IonicAtomicNumber&) noexcept;
+
 			// Private methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 
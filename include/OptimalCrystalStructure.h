@@ -13,6 +13,8 @@
 #include "IonicAtomicNumber.h"
 
 #include "OptimalAtom.h"
+#include "StructuralDescriptor.h"
+#include "StructuralHash.h"
 
 
 namespace MathematicalCrystalChemistry
@@ -59,7 +61,18 @@ namespace MathematicalCrystalChemistry
 
 				std::string toAbridgedStructuralFingerprint() const;
 				std::string toStructuralFingerprint() const;
+				std::string toStructuralFingerprint(const std::vector<std::pair<OptimalAtom, size_type>>& uniqueOptimalAtoms) const;
 				std::string toDetailedStructuralFingerprint() const;
+				std::string toDetailedStructuralFingerprint(const std::vector<std::pair<OptimalAtom, size_type>>& uniqueOptimalAtoms) const;
+
+				StructuralHash toStructuralHash() const;
+				StructuralHash toStructuralHash(const std::vector<std::pair<OptimalAtom, size_type>>& uniqueOptimalAtoms) const;
+				StructuralHash toDetailedStructuralHash() const;
+				StructuralHash toDetailedStructuralHash(const std::vector<std::pair<OptimalAtom, size_type>>& uniqueOptimalAtoms) const;
+
+				std::vector<std::pair<OptimalAtom, size_type>> getUniqueOptimalAtoms() const;
+
+				StructuralDescriptor toStructuralDescriptor(const double radialCutoff, const size_type numRadialBins) const;
 
 			// Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -67,7 +80,7 @@ namespace MathematicalCrystalChemistry
 			// Private methods
 
 			private:
-				std::vector<std::pair<OptimalAtom, size_type>> getUniqueOptimalAtoms() const;
+				std::vector<OptimalAtom> buildAtomicArrangement(const ConstrainingCrystalStructure&) const;
 
 			// Private methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
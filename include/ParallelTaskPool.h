@@ -0,0 +1,142 @@
+#ifndef SYSTEM_PARALLEL_PARALLELTASKPOOL_H
+#define SYSTEM_PARALLEL_PARALLELTASKPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace System
+{
+	namespace Parallel
+	{
+		class ParallelTaskPool final
+		{
+		public:
+			using size_type = std::size_t;
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Constructors and destructor
+
+		private:
+			explicit ParallelTaskPool(const size_type numWorkers);
+
+		public:
+			~ParallelTaskPool();
+
+		// Constructors and destructor
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Public methods
+
+			static ParallelTaskPool& getInstance();
+			static bool isWorkerThread() noexcept;
+
+			size_type countWorkers() const noexcept;
+
+			// The calling thread works on its own job too, and calls from inside a worker thread run serially.
+			template <typename F>
+			void execute(const size_type numTasks, const F& task);
+
+		// Public methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Private methods
+
+		private:
+			struct Job final
+			{
+				std::function<void(size_type)> task;
+				size_type numTasks{ 0 };
+
+				std::atomic<size_type> nextTaskIndex{ 0 };
+				size_type numCompletedTasks{ 0 };
+				std::exception_ptr exception;
+
+				std::mutex jobMutex;
+				std::condition_variable completionCondition;
+			};
+
+			void executeJob(const std::shared_ptr<Job>& job);
+			void work();
+
+			static void processJob(Job& job) noexcept;
+
+		// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+		private:
+			std::vector<std::thread> _workers;
+
+			std::deque<std::shared_ptr<Job>> m_jobs;
+			std::mutex m_jobsMutex;
+			std::condition_variable m_jobsCondition;
+			bool m_isStopping;
+
+			static thread_local bool s_isWorkerThread;
+
+
+		private:
+			ParallelTaskPool(const ParallelTaskPool&) = delete;
+			ParallelTaskPool(ParallelTaskPool&&) noexcept = delete;
+			ParallelTaskPool& operator=(const ParallelTaskPool&) = delete;
+			ParallelTaskPool& operator=(ParallelTaskPool&&) noexcept = delete;
+		};
+	}
+}
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Public methods
+
+inline bool System::Parallel::ParallelTaskPool::isWorkerThread() noexcept
+{
+	return s_isWorkerThread;
+}
+
+inline System::Parallel::ParallelTaskPool::size_type System::Parallel::ParallelTaskPool::countWorkers() const noexcept
+{
+	return _workers.size();
+}
+
+template <typename F>
+inline void System::Parallel::ParallelTaskPool::execute(const size_type numTasks, const F& task)
+{
+	if ((numTasks < 2) || _workers.empty() || isWorkerThread())
+	{
+		for (size_type taskIndex = 0; taskIndex < numTasks; ++taskIndex)
+			task(taskIndex);
+
+		return;
+	}
+
+
+	auto job = std::make_shared<Job>();
+	job->task = [&task](const size_type taskIndex) { task(taskIndex); };
+	job->numTasks = numTasks;
+
+	executeJob(job);
+}
+
+// Public methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+
+#endif // !SYSTEM_PARALLEL_PARALLELTASKPOOL_H
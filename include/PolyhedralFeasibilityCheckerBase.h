@@ -5,6 +5,7 @@
 
 #include "AtomicNumber.h"
 #include "ChemicalComposition.h"
+#include "FlatChemicalComposition.h"
 
 #include "IonicAtomicNumber.h"
 
@@ -32,6 +33,7 @@ namespace MathematicalCrystalChemistry
 					using AtomicNumber = ChemToolkit::Generic::AtomicNumber;
 					using IonicAtomicNumber = ChemToolkit::Generic::IonicAtomicNumber;
 					using BasicChemicalComposition = ChemToolkit::Generic::ChemicalComposition<AtomicNumber>;
+					using FlatChemicalComposition = ChemToolkit::Generic::FlatChemicalComposition;
 					using ChemicalComposition = ChemToolkit::Generic::ChemicalComposition<IonicAtomicNumber>;
 
 					using ConstrainingAtomicSpecies = MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingAtomicSpecies;
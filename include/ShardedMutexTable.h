@@ -0,0 +1,111 @@
+#ifndef SYSTEM_PARALLEL_SHARDEDMUTEXTABLE_H
+#define SYSTEM_PARALLEL_SHARDEDMUTEXTABLE_H
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+
+namespace System
+{
+	namespace Parallel
+	{
+		class ShardedMutexTable final
+		{
+		public:
+			using size_type = std::size_t;
+
+		private:
+			struct Shard
+			{
+				std::shared_mutex shardMutex;
+				std::unordered_map<std::string, std::mutex> keyAndMutex;
+			};
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Constructors and destructor
+
+		public:
+			ShardedMutexTable() noexcept;
+			~ShardedMutexTable() = default;
+
+		// Constructors and destructor
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Public methods
+
+			std::unique_lock<std::mutex> lock(const std::string& key);
+
+			size_type countKeys() const;
+			size_type countAcquisitions() const noexcept;
+			size_type countContentions() const noexcept;
+			double contentionSeconds() const noexcept;
+
+			void resetStatistics() noexcept;
+
+		// Public methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+		// Private methods
+
+		private:
+			std::mutex& getMutex(const std::string& key);
+
+		// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+		private:
+			mutable std::array<Shard, 64> m_shards;
+
+			std::atomic<size_type> _numAcquisitions;
+			std::atomic<size_type> _numContentions;
+			std::atomic<long long> _contentionNanoseconds;
+
+
+		private:
+			ShardedMutexTable(const ShardedMutexTable&) = delete;
+			ShardedMutexTable(ShardedMutexTable&&) noexcept = delete;
+			ShardedMutexTable& operator=(const ShardedMutexTable&) = delete;
+			ShardedMutexTable& operator=(ShardedMutexTable&&) noexcept = delete;
+		};
+	}
+}
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Public methods
+
+inline System::Parallel::ShardedMutexTable::size_type System::Parallel::ShardedMutexTable::countAcquisitions() const noexcept
+{
+	return _numAcquisitions.load();
+}
+
+inline System::Parallel::ShardedMutexTable::size_type System::Parallel::ShardedMutexTable::countContentions() const noexcept
+{
+	return _numContentions.load();
+}
+
+inline double System::Parallel::ShardedMutexTable::contentionSeconds() const noexcept
+{
+	return (0.000000001 * static_cast<double>(_contentionNanoseconds.load()));
+}
+
+// Public methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+
+#endif // !SYSTEM_PARALLEL_SHARDEDMUTEXTABLE_H
@@ -1,13 +1,17 @@
 #ifndef CHEMTOOLKIT_CRYSTALLOGRAPHY_SYMMETRY_SPACEGROUPTYPESEARCHER_H
 #define CHEMTOOLKIT_CRYSTALLOGRAPHY_SYMMETRY_SPACEGROUPTYPESEARCHER_H
 
+#include <array>
 #include <cmath>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <utility>
 
 #include "ArgumentOutOfRangeException.h"
+#include "ParallelTaskPool.h"
 
 #include "NumericalVector.h"
 #include "NumericalMatrix.h"
@@ -19,7 +23,9 @@
 #include "WyckoffSymbol.h"
 
 #include "UnitCell.h"
+#include "DelaunayReducer.h"
 #include "CrystallographicInformation.h"
+#include "SymmetryDatasetCache.h"
 
 
 namespace ChemToolkit
@@ -35,10 +41,13 @@ namespace ChemToolkit
 				using NumericalVector = MathToolkit::LinearAlgebra::NumericalVector<double, 3>;
 				using NumericalMatrix = MathToolkit::LinearAlgebra::NumericalMatrix<double, 3, 3>;
 				using SymmetryOperation = ChemToolkit::Crystallography::Symmetry::CrystallographicSymmetryOperation;
+				using SymmetryDataset = ChemToolkit::Crystallography::Symmetry::SymmetryDatasetCache::SymmetryDataset;
+				using IntegerMatrix = ChemToolkit::Crystallography::DelaunayReducer::TransformationMatrix;
 
 				struct SpglibInputVariables
 				{
 					int numAtoms{ 0 };
+					int capacity{ 0 };
 					double lattice[3][3];
 					std::unique_ptr<int[]> types;
 					std::unique_ptr<double[][3]> positions;
@@ -82,6 +91,14 @@ namespace ChemToolkit
 				double precision() const noexcept;
 				static double defaultPrecision() noexcept;
 
+				static std::size_t countToleranceSearches() noexcept;
+				static std::size_t countToleranceTrials() noexcept;
+				static std::size_t countLadderTrials() noexcept;
+				static double getMeanToleranceTrials() noexcept;
+				static double getMeanLadderTrials() noexcept;
+				static void setToleranceStatistics(const std::size_t numToleranceSearches, const std::size_t numToleranceTrials, const std::size_t numLadderTrials) noexcept;
+				static void initializeToleranceStatistics() noexcept;
+
 				void setPrecision() noexcept;
 				void setPrecision(const double);
 
@@ -99,15 +116,26 @@ namespace ChemToolkit
 				template <typename A>
 				void conventionalize(UnitCell&, std::vector<A>&, SpaceGroupNumber&) const;
 
+				template <typename A>
+				void conventionalize(std::vector<UnitCell>&, std::vector<std::vector<A>>&, std::vector<SpaceGroupNumber>&) const;
+
 				template <typename A>
 				void updateSymmetryInformation(const UnitCell&, std::vector<A>&, SpaceGroupNumber&) const;
 
+				template <typename A>
+				void updateSymmetryInformation(const std::vector<UnitCell>&, std::vector<std::vector<A>>&, std::vector<SpaceGroupNumber>&) const;
+
+				template <typename A>
+				bool hasTrivialSymmetry(const UnitCell&, const std::vector<A>&) const;
+
 				template <typename A>
 				CrystallographicInformation getCrystallographicInformation(const UnitCell&, const std::vector<A>&, const SpaceGroupNumber) const;
 
 				template <typename A>
 				CrystallographicInformation getCrystallographicInformation(const UnitCell&, const std::vector<A>&) const;
 
+				static std::vector<size_type> getUniqueAtomIndices(const UnitCell&, const std::vector<AtomicNumber>&, const std::vector<NumericalVector>& fractionalCoordinates);
+
 			// Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -119,11 +147,31 @@ namespace ChemToolkit
 				SpglibOutputVariables getConventionalOutputVariables(const SpglibInputVariables&) const;
 				SpglibOutputVariables getSymmetrizedInputVariables(const SpglibInputVariables&) const;
 				std::vector<SymmetryOperation> getSymmetryOperations(const SpglibInputVariables&, const SpaceGroupNumber&) const;
+				bool isTrivialSymmetry(const SpglibInputVariables&) const;
+				bool isSymmetryOperation(const SpglibInputVariables&, const IntegerMatrix& rotation, const NumericalVector& translation, const NumericalVector& axisTolerances) const;
+
+				std::shared_ptr<const SymmetryDataset> getSymmetryDataset(const SpglibInputVariables&) const;
+				std::shared_ptr<const SymmetryDataset> trySymmetryDataset(const SpglibInputVariables&, const size_type toleranceLevel) const;
 
+				static size_type maxToleranceLevel() noexcept;
+				static size_type minLearnedToleranceLevel() noexcept;
+				static double toleranceScale() noexcept;
+				static double screeningToleranceScale() noexcept;
+				static std::vector<IntegerMatrix> getUnimodularMatrices();
+				static SpglibInputVariables& getThreadWorkspace();
+
+
+				template <typename A>
+				void conventionalize(UnitCell&, std::vector<A>&, SpaceGroupNumber&, SpglibInputVariables& workspace) const;
+
+				template <typename A>
+				void updateSymmetryInformation(const UnitCell&, std::vector<A>&, SpaceGroupNumber&, SpglibInputVariables& workspace) const;
 
 				template <typename A>
 				SpglibInputVariables toSpglibInputVariables(const UnitCell&, const std::vector<A>&) const;
 
+				template <typename A>
+				void assignSpglibInputVariables(const UnitCell&, const std::vector<A>&, SpglibInputVariables&) const;
 			// Private methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -135,6 +183,8 @@ namespace ChemToolkit
 
 				SpglibInputVariables toSpglibInputVariables(const SpglibOutputVariables&) const;
 				void removeEquivalentAtoms(SpglibOutputVariables&, const UnitCell& prevUnitCell) const;
+				static bool isSameFractionalCoordinate(const UnitCell&, const NumericalVector&, const NumericalVector&, const double distanceRange);
+				static std::string toCompositionKey(const SpglibInputVariables&);
 
 			// Private utility
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -143,6 +193,13 @@ namespace ChemToolkit
 				double _precision;
 
 				static double s_defaultPrecision;
+				static std::vector<IntegerMatrix> s_unimodularMatrices;
+
+				static std::size_t s_numToleranceSearches;
+				static std::size_t s_numToleranceTrials;
+				static std::size_t s_numLadderTrials;
+				static std::map<std::string, size_type> s_learnedToleranceLevels;
+				static std::mutex s_toleranceMutex;
 			};
 		}
 	}
@@ -167,6 +224,58 @@ inline double ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::de
 	return s_defaultPrecision;
 }
 
+inline std::size_t ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::countToleranceSearches() noexcept
+{
+	std::lock_guard<std::mutex> guard{ s_toleranceMutex };
+	return s_numToleranceSearches;
+}
+
+inline std::size_t ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::countToleranceTrials() noexcept
+{
+	std::lock_guard<std::mutex> guard{ s_toleranceMutex };
+	return s_numToleranceTrials;
+}
+
+inline std::size_t ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::countLadderTrials() noexcept
+{
+	std::lock_guard<std::mutex> guard{ s_toleranceMutex };
+	return s_numLadderTrials;
+}
+
+inline double ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::getMeanToleranceTrials() noexcept
+{
+	std::lock_guard<std::mutex> guard{ s_toleranceMutex };
+
+	if (s_numToleranceSearches == 0)
+		return 0.0;
+	else
+		return (static_cast<double>(s_numToleranceTrials) / static_cast<double>(s_numToleranceSearches));
+}
+
+inline double ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::getMeanLadderTrials() noexcept
+{
+	std::lock_guard<std::mutex> guard{ s_toleranceMutex };
+
+	if (s_numToleranceSearches == 0)
+		return 0.0;
+	else
+		return (static_cast<double>(s_numLadderTrials) / static_cast<double>(s_numToleranceSearches));
+}
+
+inline void ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::setToleranceStatistics(const std::size_t numToleranceSearches, const std::size_t numToleranceTrials, const std::size_t numLadderTrials) noexcept
+{
+	std::lock_guard<std::mutex> guard{ s_toleranceMutex };
+
+	s_numToleranceSearches = numToleranceSearches;
+	s_numToleranceTrials = numToleranceTrials;
+	s_numLadderTrials = numLadderTrials;
+}
+
+inline void ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::initializeToleranceStatistics() noexcept
+{
+	setToleranceStatistics(0, 0, 0);
+}
+
 inline void ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::setPrecision() noexcept
 {
 	_precision = s_defaultPrecision;
@@ -251,43 +360,40 @@ inline void ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::toPr
 template <typename A>
 inline void ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::conventionalize(UnitCell& unitCell, std::vector<A>& atoms, SpaceGroupNumber& spaceGroupNumber) const
 {
-	SpglibOutputVariables variables = getConventionalOutputVariables(toSpglibInputVariables(unitCell, atoms));
-
-	using Atom = A;
-	std::vector<Atom> oldAtoms = std::move(atoms);
-	atoms.clear();
-	{
-		for (size_type index = 0; index < static_cast<size_type>(variables.numAtoms); ++index)
-		{
-			Atom atom = oldAtoms.at(variables.mappingToInputIndices.at(index));
-			atom.cartesianCoordinate() = (variables.unitCell.basisVectors() * variables.fractionalCoordinates.at(index));
-			atom.setSiteLabel(variables.siteLabels.at(index));
-			atom.setSiteSymmetrySymbol(variables.siteSymmetrySymbols.at(index));
-			atom.setWyckoffSymbol(variables.wyckoffSymbols.at(index));
-
-			atoms.push_back(std::move(atom));
-		}
-	}
-
+	conventionalize(unitCell, atoms, spaceGroupNumber, getThreadWorkspace());
+}
 
-	unitCell = variables.unitCell;
-	spaceGroupNumber = variables.spaceGroupNumber;
+template <typename A>
+inline void ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::conventionalize(std::vector<UnitCell>& unitCells, std::vector<std::vector<A>>& atomicArrangements, std::vector<SpaceGroupNumber>& spaceGroupNumbers) const
+{
+	if ((unitCells.size() == atomicArrangements.size()) && (unitCells.size() == spaceGroupNumbers.size()))
+		System::Parallel::ParallelTaskPool::getInstance().execute(unitCells.size(), [&](const std::size_t index) { conventionalize(unitCells[index], atomicArrangements[index], spaceGroupNumbers[index], getThreadWorkspace()); });
+	else
+		throw System::ExceptionServices::ArgumentOutOfRangeException{ typeid(*this), "conventionalize", "The numbers of unit cells, atomic arrangements, and space group numbers are different." };
 }
 
 template <typename A>
 inline void ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::updateSymmetryInformation(const UnitCell& unitCell, std::vector<A>& atoms, SpaceGroupNumber& spaceGroupNumber) const
 {
-	SpglibOutputVariables variables = getSymmetrizedInputVariables(toSpglibInputVariables(unitCell, atoms));
+	updateSymmetryInformation(unitCell, atoms, spaceGroupNumber, getThreadWorkspace());
+}
 
+template <typename A>
+inline void ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::updateSymmetryInformation(const std::vector<UnitCell>& unitCells, std::vector<std::vector<A>>& atomicArrangements, std::vector<SpaceGroupNumber>& spaceGroupNumbers) const
+{
+	if ((unitCells.size() == atomicArrangements.size()) && (unitCells.size() == spaceGroupNumbers.size()))
+		System::Parallel::ParallelTaskPool::getInstance().execute(unitCells.size(), [&](const std::size_t index) { updateSymmetryInformation(unitCells[index], atomicArrangements[index], spaceGroupNumbers[index], getThreadWorkspace()); });
+	else
+		throw System::ExceptionServices::ArgumentOutOfRangeException{ typeid(*this), "updateSymmetryInformation", "The numbers of unit cells, atomic arrangements, and space group numbers are different." };
+}
 
-	spaceGroupNumber = variables.spaceGroupNumber;
+template <typename A>
+inline bool ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::hasTrivialSymmetry(const UnitCell& unitCell, const std::vector<A>& atoms) const
+{
+	ChemToolkit::Crystallography::DelaunayReducer delaunayReducer{ _precision };
+	const UnitCell reducedUnitCell = ChemToolkit::Crystallography::DelaunayReducer::getTransformedUnitCell(unitCell, delaunayReducer.getTransformationMatrix(unitCell));
 
-	for (size_type index = 0; index < atoms.size(); ++index)
-	{
-		atoms[index].setSiteLabel(variables.siteLabels.at(index));
-		atoms[index].setSiteSymmetrySymbol(variables.siteSymmetrySymbols.at(index));
-		atoms[index].setWyckoffSymbol(variables.wyckoffSymbols.at(index));
-	}
+	return isTrivialSymmetry(toSpglibInputVariables(reducedUnitCell, atoms));
 }
 
 template <typename A>
@@ -437,46 +543,116 @@ inline ChemToolkit::Crystallography::CrystallographicInformation ChemToolkit::Cr
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // Private methods
 
+inline ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::size_type ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::maxToleranceLevel() noexcept
+{
+	return 20;
+}
+
+inline ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::size_type ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::minLearnedToleranceLevel() noexcept
+{
+	return 3;
+}
+
+inline double ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::toleranceScale() noexcept
+{
+	return 0.8;
+}
+
+inline double ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::screeningToleranceScale() noexcept
+{
+	return 2.0;
+}
+
 template <typename A>
-inline ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::SpglibInputVariables ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::toSpglibInputVariables(const UnitCell& cell, const std::vector<A>& atoms) const
+inline void ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::conventionalize(UnitCell& unitCell, std::vector<A>& atoms, SpaceGroupNumber& spaceGroupNumber, SpglibInputVariables& workspace) const
 {
-	SpglibInputVariables spglibInputVariables;
+	assignSpglibInputVariables(unitCell, atoms, workspace);
+	SpglibOutputVariables variables = getConventionalOutputVariables(workspace);
+
+	using Atom = A;
+	std::vector<Atom> oldAtoms = std::move(atoms);
+	atoms.clear();
 	{
-		spglibInputVariables.numAtoms = static_cast<int>(atoms.size());
-
-		spglibInputVariables.lattice[0][0] = cell.basisVectors()(0, 0);
-		spglibInputVariables.lattice[0][1] = cell.basisVectors()(0, 1);
-		spglibInputVariables.lattice[0][2] = cell.basisVectors()(0, 2);
-		spglibInputVariables.lattice[1][0] = cell.basisVectors()(1, 0);
-		spglibInputVariables.lattice[1][1] = cell.basisVectors()(1, 1);
-		spglibInputVariables.lattice[1][2] = cell.basisVectors()(1, 2);
-		spglibInputVariables.lattice[2][0] = cell.basisVectors()(2, 0);
-		spglibInputVariables.lattice[2][1] = cell.basisVectors()(2, 1);
-		spglibInputVariables.lattice[2][2] = cell.basisVectors()(2, 2);
-
-		spglibInputVariables.types = std::unique_ptr<int[]>{ new int[4 * spglibInputVariables.numAtoms] };
+		for (size_type index = 0; index < static_cast<size_type>(variables.numAtoms); ++index)
 		{
-			for (int index = 0; index < spglibInputVariables.numAtoms; ++index)
-				spglibInputVariables.types[index] = static_cast<int>(atoms.at(index).ionicAtomicNumber().atomicNumber());
+			Atom atom = oldAtoms.at(variables.mappingToInputIndices.at(index));
+			atom.cartesianCoordinate() = (variables.unitCell.basisVectors() * variables.fractionalCoordinates.at(index));
+			atom.setSiteLabel(variables.siteLabels.at(index));
+			atom.setSiteSymmetrySymbol(variables.siteSymmetrySymbols.at(index));
+			atom.setWyckoffSymbol(variables.wyckoffSymbols.at(index));
+
+			atoms.push_back(std::move(atom));
 		}
+	}
 
-		spglibInputVariables.positions = std::unique_ptr<double[][3]>{ new double[4 * spglibInputVariables.numAtoms][3] };
-		{
-			NumericalMatrix inverseBasisVectors = cell.getInverseBasisVectors();
 
-			for (int index = 0; index < spglibInputVariables.numAtoms; ++index)
-			{
-				NumericalVector fractionalCoordinate = inverseBasisVectors * atoms.at(index).cartesianCoordinate();
-				spglibInputVariables.positions[index][0] = fractionalCoordinate[0];
-				spglibInputVariables.positions[index][1] = fractionalCoordinate[1];
-				spglibInputVariables.positions[index][2] = fractionalCoordinate[2];
-			}
-		}
+	unitCell = variables.unitCell;
+	spaceGroupNumber = variables.spaceGroupNumber;
+}
+
+template <typename A>
+inline void ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::updateSymmetryInformation(const UnitCell& unitCell, std::vector<A>& atoms, SpaceGroupNumber& spaceGroupNumber, SpglibInputVariables& workspace) const
+{
+	assignSpglibInputVariables(unitCell, atoms, workspace);
+	SpglibOutputVariables variables = getSymmetrizedInputVariables(workspace);
+
+
+	spaceGroupNumber = variables.spaceGroupNumber;
+
+	for (size_type index = 0; index < atoms.size(); ++index)
+	{
+		atoms[index].setSiteLabel(variables.siteLabels.at(index));
+		atoms[index].setSiteSymmetrySymbol(variables.siteSymmetrySymbols.at(index));
+		atoms[index].setWyckoffSymbol(variables.wyckoffSymbols.at(index));
 	}
+}
+
+template <typename A>
+inline ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::SpglibInputVariables ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::toSpglibInputVariables(const UnitCell& cell, const std::vector<A>& atoms) const
+{
+	SpglibInputVariables spglibInputVariables;
+	assignSpglibInputVariables(cell, atoms, spglibInputVariables);
 
 	return spglibInputVariables;
 }
 
+template <typename A>
+inline void ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::assignSpglibInputVariables(const UnitCell& cell, const std::vector<A>& atoms, SpglibInputVariables& spglibInputVariables) const
+{
+	spglibInputVariables.numAtoms = static_cast<int>(atoms.size());
+
+	spglibInputVariables.lattice[0][0] = cell.basisVectors()(0, 0);
+	spglibInputVariables.lattice[0][1] = cell.basisVectors()(0, 1);
+	spglibInputVariables.lattice[0][2] = cell.basisVectors()(0, 2);
+	spglibInputVariables.lattice[1][0] = cell.basisVectors()(1, 0);
+	spglibInputVariables.lattice[1][1] = cell.basisVectors()(1, 1);
+	spglibInputVariables.lattice[1][2] = cell.basisVectors()(1, 2);
+	spglibInputVariables.lattice[2][0] = cell.basisVectors()(2, 0);
+	spglibInputVariables.lattice[2][1] = cell.basisVectors()(2, 1);
+	spglibInputVariables.lattice[2][2] = cell.basisVectors()(2, 2);
+
+	if (spglibInputVariables.capacity < (4 * spglibInputVariables.numAtoms))
+	{
+		spglibInputVariables.capacity = 4 * spglibInputVariables.numAtoms;
+		spglibInputVariables.types = std::unique_ptr<int[]>{ new int[spglibInputVariables.capacity] };
+		spglibInputVariables.positions = std::unique_ptr<double[][3]>{ new double[spglibInputVariables.capacity][3] };
+	}
+
+	for (int index = 0; index < spglibInputVariables.numAtoms; ++index)
+		spglibInputVariables.types[index] = static_cast<int>(atoms.at(index).ionicAtomicNumber().atomicNumber());
+
+	NumericalMatrix inverseBasisVectors = cell.getInverseBasisVectors();
+	{
+		for (int index = 0; index < spglibInputVariables.numAtoms; ++index)
+		{
+			NumericalVector fractionalCoordinate = inverseBasisVectors * atoms.at(index).cartesianCoordinate();
+			spglibInputVariables.positions[index][0] = fractionalCoordinate[0];
+			spglibInputVariables.positions[index][1] = fractionalCoordinate[1];
+			spglibInputVariables.positions[index][2] = fractionalCoordinate[2];
+		}
+	}
+}
+
 // Private methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -0,0 +1,142 @@
+#ifndef MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_COMPONENTS_STRUCTURALDESCRIPTOR_H
+#define MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_COMPONENTS_STRUCTURALDESCRIPTOR_H
+
+#include <string>
+#include <vector>
+
+#include "AtomicNumber.h"
+
+
+namespace MathematicalCrystalChemistry
+{
+	namespace CrystalModel
+	{
+		namespace Components
+		{
+			class StructuralDescriptor
+			{
+				using size_type = std::size_t;
+				using AtomicNumber = ChemToolkit::Generic::AtomicNumber;
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Constructors, destructor, and operators
+
+			public:
+				StructuralDescriptor() noexcept;
+				StructuralDescriptor(const std::vector<AtomicNumber>& atomicNumbers, std::vector<double>&& values);
+				explicit StructuralDescriptor(const std::string& descriptorTexts);
+
+				~StructuralDescriptor() = default;
+
+				StructuralDescriptor(const StructuralDescriptor&) = default;
+				StructuralDescriptor(StructuralDescriptor&&) noexcept = default;
+				StructuralDescriptor& operator=(const StructuralDescriptor&) = default;
+				StructuralDescriptor& operator=(StructuralDescriptor&&) noexcept = default;
+
+			// Constructors, destructor, and operators
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Property
+
+				const std::vector<AtomicNumber>& atomicNumbers() const noexcept;
+				const std::vector<double>& values() const noexcept;
+
+			// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Methods
+
+				size_type dimension() const noexcept;
+				bool isEmpty() const noexcept;
+
+				bool isComparable(const StructuralDescriptor&) const noexcept;
+				double getSimilarity(const StructuralDescriptor&) const noexcept;
+
+			// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Utility
+
+				std::string toString() const;
+
+			// Utility
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Private methods
+
+			private:
+				static double getNorm(const std::vector<double>&) noexcept;
+
+			// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+			private:
+				std::vector<AtomicNumber> _atomicNumbers;
+				std::vector<double> _values;
+				double _norm;
+			};
+		}
+	}
+}
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Property
+
+inline const std::vector<ChemToolkit::Generic::AtomicNumber>& MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptor::atomicNumbers() const noexcept
+{
+	return _atomicNumbers;
+}
+
+inline const std::vector<double>& MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptor::values() const noexcept
+{
+	return _values;
+}
+
+// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Methods
+
+inline MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptor::size_type MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptor::dimension() const noexcept
+{
+	return _values.size();
+}
+
+inline bool MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptor::isEmpty() const noexcept
+{
+	return _values.empty();
+}
+
+inline bool MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptor::isComparable(const StructuralDescriptor& structuralDescriptor) const noexcept
+{
+	return ((_atomicNumbers == structuralDescriptor._atomicNumbers) && (_values.size() == structuralDescriptor._values.size()));
+}
+
+// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+
+#endif // !MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_COMPONENTS_STRUCTURALDESCRIPTOR_H
@@ -0,0 +1,161 @@
+#ifndef MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_COMPONENTS_STRUCTURALDESCRIPTORINDEX_H
+#define MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_COMPONENTS_STRUCTURALDESCRIPTORINDEX_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "StructuralDescriptor.h"
+
+
+namespace MathematicalCrystalChemistry
+{
+	namespace CrystalModel
+	{
+		namespace Components
+		{
+			class StructuralDescriptorIndex
+			{
+				using size_type = std::size_t;
+
+				using Hyperplanes = std::vector<std::vector<double>>;
+				using HashTable = std::unordered_map<std::uint64_t, std::vector<size_type>>;
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Constructors, destructor, and operators
+
+			public:
+				StructuralDescriptorIndex() noexcept;
+				StructuralDescriptorIndex(const size_type numHashTables, const size_type numHashBits);
+
+				virtual ~StructuralDescriptorIndex() = default;
+
+				StructuralDescriptorIndex(const StructuralDescriptorIndex&) = default;
+				StructuralDescriptorIndex(StructuralDescriptorIndex&&) noexcept = default;
+				StructuralDescriptorIndex& operator=(const StructuralDescriptorIndex&) = default;
+				StructuralDescriptorIndex& operator=(StructuralDescriptorIndex&&) noexcept = default;
+
+			// Constructors, destructor, and operators
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Property
+
+				const std::vector<StructuralDescriptor>& descriptors() const noexcept;
+
+				size_type numHashTables() const noexcept;
+				size_type numHashBits() const noexcept;
+
+				static size_type defaultNumHashTables() noexcept;
+				static size_type defaultNumHashBits() noexcept;
+
+			// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Methods
+
+				size_type count() const noexcept;
+				bool isEmpty() const noexcept;
+				void clear() noexcept;
+
+				size_type insert(const StructuralDescriptor&);
+				std::pair<bool, size_type> findMostSimilar(const StructuralDescriptor&, const double similarityThreshold) const;
+
+			// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Private methods
+
+			private:
+				const Hyperplanes& getHyperplanes(const size_type dimension);
+				std::uint64_t toBucketKey(const StructuralDescriptor&, const Hyperplanes&, const size_type tableIndex) const noexcept;
+
+			// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+			private:
+				size_type _numHashTables;
+				size_type _numHashBits;
+
+				std::vector<StructuralDescriptor> _descriptors;
+				std::unordered_map<size_type, Hyperplanes> _dimensionAndHyperplanes;
+				std::vector<HashTable> _hashTables;
+
+				static size_type s_defaultNumHashTables;
+				static size_type s_defaultNumHashBits;
+			};
+		}
+	}
+}
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Property
+
+inline const std::vector<MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptor>& MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptorIndex::descriptors() const noexcept
+{
+	return _descriptors;
+}
+
+inline MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptorIndex::size_type MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptorIndex::numHashTables() const noexcept
+{
+	return _numHashTables;
+}
+
+inline MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptorIndex::size_type MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptorIndex::numHashBits() const noexcept
+{
+	return _numHashBits;
+}
+
+inline MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptorIndex::size_type MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptorIndex::defaultNumHashTables() noexcept
+{
+	return s_defaultNumHashTables;
+}
+
+inline MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptorIndex::size_type MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptorIndex::defaultNumHashBits() noexcept
+{
+	return s_defaultNumHashBits;
+}
+
+// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Methods
+
+inline MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptorIndex::size_type MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptorIndex::count() const noexcept
+{
+	return _descriptors.size();
+}
+
+inline bool MathematicalCrystalChemistry::CrystalModel::Components::StructuralDescriptorIndex::isEmpty() const noexcept
+{
+	return _descriptors.empty();
+}
+
+// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+
+#endif // !MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_COMPONENTS_STRUCTURALDESCRIPTORINDEX_H
@@ -0,0 +1,256 @@
+#ifndef MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_COMPONENTS_STRUCTURALHASH_H
+#define MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_COMPONENTS_STRUCTURALHASH_H
+
+#include <cstdint>
+#include <string>
+
+
+namespace MathematicalCrystalChemistry
+{
+	namespace CrystalModel
+	{
+		namespace Components
+		{
+			class StructuralHash
+			{
+			public:
+				struct Hasher
+				{
+					std::size_t operator()(const StructuralHash&) const noexcept;
+				};
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Constructors, destructor, and operators
+
+			public:
+				StructuralHash() noexcept;
+
+				~StructuralHash() = default;
+
+				StructuralHash(const StructuralHash&) = default;
+				StructuralHash(StructuralHash&&) noexcept = default;
+				StructuralHash& operator=(const StructuralHash&) = default;
+				StructuralHash& operator=(StructuralHash&&) noexcept = default;
+
+			// Constructors, destructor, and operators
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Property
+
+				std::uint64_t high() const noexcept;
+				std::uint64_t low() const noexcept;
+
+			// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Methods
+
+				void add(const std::uint64_t) noexcept;
+				void add(const std::string&) noexcept;
+				void add(const StructuralHash&) noexcept;
+
+			// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Utility
+
+				std::string toString() const;
+
+			// Utility
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Private methods
+
+			private:
+				static std::uint64_t mix(std::uint64_t) noexcept;
+
+			// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+			private:
+				std::uint64_t _high;
+				std::uint64_t _low;
+			};
+
+			inline std::size_t StructuralHash::Hasher::operator()(const StructuralHash& structuralHash) const noexcept
+			{
+				return static_cast<std::size_t>(structuralHash.low());
+			}
+
+			inline bool operator<(const StructuralHash& sha, const StructuralHash& shb) noexcept
+			{
+				if (sha.high() < shb.high())
+					return true;
+				else if (shb.high() < sha.high())
+					return false;
+				else
+					return (sha.low() < shb.low());
+			}
+
+			inline bool operator==(const StructuralHash& sha, const StructuralHash& shb) noexcept
+			{
+				return ((sha.high() == shb.high()) && (sha.low() == shb.low()));
+			}
+
+			inline bool operator!=(const StructuralHash& sha, const StructuralHash& shb) noexcept
+			{
+				return !(sha == shb);
+			}
+		}
+	}
+}
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Constructors
+
+inline MathematicalCrystalChemistry::CrystalModel::Components::StructuralHash::StructuralHash() noexcept
+	: _high{ 0x6A09E667F3BCC908ULL }
+	, _low{ 0xBB67AE8584CAA73BULL }
+{
+}
+
+// Constructors
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Property
+
+inline std::uint64_t MathematicalCrystalChemistry::CrystalModel::Components::StructuralHash::high() const noexcept
+{
+	return _high;
+}
+
+inline std::uint64_t MathematicalCrystalChemistry::CrystalModel::Components::StructuralHash::low() const noexcept
+{
+	return _low;
+}
+
+// Property
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Methods
+
+inline void MathematicalCrystalChemistry::CrystalModel::Components::StructuralHash::add(const std::uint64_t value) noexcept
+{
+	_high = mix(_high ^ value);
+	_low = mix((_low + value) * 0x9E3779B97F4A7C15ULL);
+}
+
+inline void MathematicalCrystalChemistry::CrystalModel::Components::StructuralHash::add(const std::string& texts) noexcept
+{
+	add(static_cast<std::uint64_t>(texts.size()));
+
+	for (std::size_t position = 0; position < texts.size(); position += 8)
+	{
+		std::uint64_t value = 0;
+
+		for (std::size_t shift = 0; ((shift < 8) && ((position + shift) < texts.size())); ++shift)
+			value |= (static_cast<std::uint64_t>(static_cast<unsigned char>(texts[position + shift])) << (8 * shift));
+
+		add(value);
+	}
+}
+
+inline void MathematicalCrystalChemistry::CrystalModel::Components::StructuralHash::add(const StructuralHash& structuralHash) noexcept
+{
+	add(structuralHash.high());
+	add(structuralHash.low());
+}
+
+// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Utility
+
+inline std::string MathematicalCrystalChemistry::CrystalModel::Components::StructuralHash::toString() const
+{
+	constexpr char hexadecimalDigits[] = "0123456789abcdef";
+
+	std::string hashTexts;
+	{
+		for (int shift = 60; 0 <= shift; shift -= 4)
+			hashTexts += hexadecimalDigits[(_high >> shift) & 0xF];
+
+		for (int shift = 60; 0 <= shift; shift -= 4)
+			hashTexts += hexadecimalDigits[(_low >> shift) & 0xF];
+	}
+
+	return hashTexts;
+}
+
+// Utility
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+inline std::uint64_t MathematicalCrystalChemistry::CrystalModel::Components::StructuralHash::mix(std::uint64_t value) noexcept
+{
+	value ^= (value >> 30);
+	value *= 0xBF58476D1CE4E5B9ULL;
+	value ^= (value >> 27);
+	value *= 0x94D049BB133111EBULL;
+	value ^= (value >> 31);
+
+	return value;
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+
+#endif // !MATHEMATICALCRYSTALCHEMISTRY_CRYSTALMODEL_COMPONENTS_STRUCTURALHASH_H
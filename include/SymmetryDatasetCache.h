@@ -0,0 +1,149 @@
+#ifndef CHEMTOOLKIT_CRYSTALLOGRAPHY_SYMMETRY_SYMMETRYDATASETCACHE_H
+#define CHEMTOOLKIT_CRYSTALLOGRAPHY_SYMMETRY_SYMMETRYDATASETCACHE_H
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "NumericalVector.h"
+#include "NumericalMatrix.h"
+
+#include "SpaceGroupNumber.h"
+#include "SiteSymmetrySymbol.h"
+#include "WyckoffSymbol.h"
+
+namespace ChemToolkit
+{
+	namespace Crystallography
+	{
+		namespace Symmetry
+		{
+			class SymmetryDatasetCache
+			{
+			public:
+				using size_type = std::size_t;
+
+			private:
+				using NumericalVector = MathToolkit::LinearAlgebra::NumericalVector<double, 3>;
+				using NumericalMatrix = MathToolkit::LinearAlgebra::NumericalMatrix<double, 3, 3>;
+
+			public:
+				struct SymmetryDataset
+				{
+					SpaceGroupNumber spaceGroupNumber;
+
+					std::vector<int> mappingToPrimitive;
+					std::vector<int> crystallographicOrbits;
+					std::vector<WyckoffSymbol> wyckoffSymbols;
+					std::vector<SiteSymmetrySymbol> siteSymmetrySymbols;
+
+					NumericalMatrix standardizedLattice;
+					std::vector<int> standardizedTypes;
+					std::vector<NumericalVector> standardizedPositions;
+					std::vector<int> standardizedMappingToPrimitive;
+
+					std::vector<NumericalMatrix> rotations;
+					std::vector<NumericalVector> translations;
+				};
+
+			private:
+				struct SymmetryDatasetKey
+				{
+					std::vector<std::int64_t> quantizedInputs;
+					std::size_t hashCode{ 0 };
+
+					bool operator==(const SymmetryDatasetKey&) const noexcept;
+				};
+
+				struct SymmetryDatasetKeyHasher
+				{
+					std::size_t operator()(const SymmetryDatasetKey&) const noexcept;
+				};
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Constructors, destructor, and operators
+
+			private:
+				SymmetryDatasetCache() noexcept = delete;
+
+			public:
+				virtual ~SymmetryDatasetCache() = default;
+
+				SymmetryDatasetCache(const SymmetryDatasetCache&) = default;
+				SymmetryDatasetCache(SymmetryDatasetCache&&) noexcept = default;
+				SymmetryDatasetCache& operator=(const SymmetryDatasetCache&) = default;
+				SymmetryDatasetCache& operator=(SymmetryDatasetCache&&) noexcept = default;
+
+			// Constructors, destructor, and operators
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Methods
+
+				static void initialize() noexcept;
+
+				static size_type capacity() noexcept;
+				static void setCapacity(const size_type) noexcept;
+
+				static size_type countHits() noexcept;
+				static size_type countMisses() noexcept;
+				static void initializeStatistics() noexcept;
+
+				static std::shared_ptr<const SymmetryDataset> getSymmetryDataset(const double lattice[3][3], const double positions[][3], const int types[], const int numAtoms, const double precision);
+
+			// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+			// Private methods
+
+			private:
+				static SymmetryDatasetKey toSymmetryDatasetKey(const double lattice[3][3], const double positions[][3], const int types[], const int numAtoms, const double precision);
+				static std::shared_ptr<const SymmetryDataset> computeSymmetryDataset(const double lattice[3][3], const double positions[][3], const int types[], const int numAtoms, const double precision);
+
+			// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+			private:
+				static std::unordered_map<SymmetryDatasetKey, std::shared_ptr<const SymmetryDataset>, SymmetryDatasetKeyHasher> s_symmetryDatasets;
+				static std::deque<SymmetryDatasetKey> s_insertionOrder;
+				static size_type s_capacity;
+				static size_type s_numHits;
+				static size_type s_numMisses;
+				static std::mutex s_mutex;
+			};
+		}
+	}
+}
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Methods
+
+inline bool ChemToolkit::Crystallography::Symmetry::SymmetryDatasetCache::SymmetryDatasetKey::operator==(const SymmetryDatasetKey& key) const noexcept
+{
+	return ((hashCode == key.hashCode) && (quantizedInputs == key.quantizedInputs));
+}
+
+inline std::size_t ChemToolkit::Crystallography::Symmetry::SymmetryDatasetCache::SymmetryDatasetKeyHasher::operator()(const SymmetryDatasetKey& key) const noexcept
+{
+	return key.hashCode;
+}
+
+// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+
+
+#endif // !CHEMTOOLKIT_CRYSTALLOGRAPHY_SYMMETRY_SYMMETRYDATASETCACHE_H
@@ -2,6 +2,7 @@
 #define CHEMTOOLKIT_CRYSTALLOGRAPHY_UNITCELL_H
 
 #include <cmath>
+#include <limits>
 
 #include "ArgumentOutOfRangeException.h"
 
@@ -78,6 +79,7 @@ namespace ChemToolkit
 
 			bool hasPositiveVolume() const noexcept;
 			double getCellVolume() const noexcept;
+			double getOrthogonalityDefect() const noexcept;
 			LatticeParameters getLatticeParameters() const;
 
 			void clear() noexcept;
@@ -215,6 +217,16 @@ inline double ChemToolkit::Crystallography::UnitCell::getCellVolume() const noex
 	return primitiveCellVolume;
 }
 
+inline double ChemToolkit::Crystallography::UnitCell::getOrthogonalityDefect() const noexcept
+{
+	double cellVolume = std::abs(getCellVolume());
+
+	if (0.0 < cellVolume)
+		return ((_basisVectors.columnVector(0).norm() * _basisVectors.columnVector(1).norm() * _basisVectors.columnVector(2).norm()) / cellVolume);
+	else
+		return std::numeric_limits<double>::max();
+}
+
 inline void ChemToolkit::Crystallography::UnitCell::clear() noexcept
 {
 	_basisVectors = 0.0;
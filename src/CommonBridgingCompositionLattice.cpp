@@ -0,0 +1,237 @@
+#include "CommonBridgingCompositionLattice.h"
+
+#include <algorithm>
+
+using namespace MathematicalCrystalChemistry::CrystalModel::Constraints;
+
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Constructors
+
+CommonBridgingCompositionLattice::CommonBridgingCompositionLattice() noexcept
+	: _feasibleCompositions{}
+	, _latticeAtomicNumbers{}
+	, _latticeMaxCounts{}
+	, _latticeStrides{}
+	, _closestLowerIndices{}
+{
+}
+
+CommonBridgingCompositionLattice::CommonBridgingCompositionLattice(const std::vector<ChemicalComposition>& feasibleCompositions)
+	: _feasibleCompositions{ feasibleCompositions }
+	, _latticeAtomicNumbers{}
+	, _latticeMaxCounts{}
+	, _latticeStrides{}
+	, _closestLowerIndices{}
+{
+	std::sort(_feasibleCompositions.begin(), _feasibleCompositions.end());
+	buildClosestLowerIndices();
+}
+
+CommonBridgingCompositionLattice::CommonBridgingCompositionLattice(const std::vector<BasicChemicalComposition>& feasibleCompositions)
+	: _feasibleCompositions{}
+	, _latticeAtomicNumbers{}
+	, _latticeMaxCounts{}
+	, _latticeStrides{}
+	, _closestLowerIndices{}
+{
+	for (const auto& feasibleComposition : feasibleCompositions)
+		_feasibleCompositions.push_back(ChemicalComposition{ feasibleComposition });
+
+	std::sort(_feasibleCompositions.begin(), _feasibleCompositions.end());
+	buildClosestLowerIndices();
+}
+
+// Constructors
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Methods
+
+bool CommonBridgingCompositionLattice::isFeasibleComposition(const ChemicalComposition& composition) const
+{
+	if (_feasibleCompositions.empty())
+		return true;
+
+	else
+	{
+		if (_closestLowerIndices.empty())
+			return std::binary_search(_feasibleCompositions.begin(), _feasibleCompositions.end(), composition);
+
+		else
+		{
+			const int closestLowerIndex = _closestLowerIndices[toLatticeIndex(composition)];
+
+			if (closestLowerIndex < 0)
+				return false;
+			else
+				return (_feasibleCompositions[closestLowerIndex] == composition);
+		}
+	}
+}
+
+CommonBridgingCompositionLattice::ChemicalComposition CommonBridgingCompositionLattice::getClosestLowerFeasibleComposition(const ChemicalComposition& composition) const
+{
+	if (_closestLowerIndices.empty())
+		return scanClosestLowerFeasibleComposition(composition);
+
+	else
+	{
+		const int closestLowerIndex = _closestLowerIndices[toLatticeIndex(composition)];
+
+		if (closestLowerIndex < 0)
+			return ChemicalComposition{};
+		else
+			return _feasibleCompositions[closestLowerIndex];
+	}
+}
+
+// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+void CommonBridgingCompositionLattice::buildClosestLowerIndices()
+{
+	for (const auto& feasibleComposition : _feasibleCompositions)
+	{
+		for (const auto& numAndCount : feasibleComposition)
+			_latticeAtomicNumbers.push_back(numAndCount.first);
+	}
+
+	std::sort(_latticeAtomicNumbers.begin(), _latticeAtomicNumbers.end());
+	_latticeAtomicNumbers.erase(std::unique(_latticeAtomicNumbers.begin(), _latticeAtomicNumbers.end()), _latticeAtomicNumbers.end());
+
+
+	_latticeMaxCounts.assign(_latticeAtomicNumbers.size(), 0);
+	{
+		for (const auto& feasibleComposition : _feasibleCompositions)
+		{
+			for (std::size_t position = 0; position < _latticeAtomicNumbers.size(); ++position)
+				_latticeMaxCounts[position] = std::max<size_type>(_latticeMaxCounts[position], static_cast<size_type>(feasibleComposition.count(AtomicNumber{ _latticeAtomicNumbers[position] })));
+		}
+	}
+
+	std::size_t latticeSize = 1;
+	{
+		for (const auto& maxCount : _latticeMaxCounts)
+		{
+			_latticeStrides.push_back(latticeSize);
+			latticeSize *= (static_cast<std::size_t>(maxCount) + 1);
+
+			if (maxLatticeSize() < latticeSize)
+			{
+				_latticeAtomicNumbers.clear();
+				_latticeMaxCounts.clear();
+				_latticeStrides.clear();
+
+				return;
+			}
+		}
+	}
+
+
+	_closestLowerIndices.assign(latticeSize, -1);
+	{
+		for (int index = 0; index < static_cast<int>(_feasibleCompositions.size()); ++index)
+			_closestLowerIndices[toLatticeIndex(_feasibleCompositions[index])] = index;
+	}
+
+	for (std::size_t latticeIndex = 0; latticeIndex < latticeSize; ++latticeIndex)
+	{
+		for (std::size_t position = 0; position < _latticeStrides.size(); ++position)
+		{
+			if (0 < ((latticeIndex / _latticeStrides[position]) % (static_cast<std::size_t>(_latticeMaxCounts[position]) + 1)))
+				_closestLowerIndices[latticeIndex] = std::max(_closestLowerIndices[latticeIndex], _closestLowerIndices[latticeIndex - _latticeStrides[position]]);
+		}
+	}
+}
+
+std::size_t CommonBridgingCompositionLattice::toLatticeIndex(const ChemicalComposition& composition) const
+{
+	std::size_t latticeIndex = 0;
+
+	for (const auto& numAndCount : composition)
+	{
+		auto iter = std::lower_bound(_latticeAtomicNumbers.begin(), _latticeAtomicNumbers.end(), numAndCount.first);
+
+		if (!(iter == _latticeAtomicNumbers.end()) && (*iter == numAndCount.first))
+		{
+			const std::size_t position = static_cast<std::size_t>(iter - _latticeAtomicNumbers.begin());
+			latticeIndex += std::min<std::size_t>(numAndCount.second, _latticeMaxCounts[position]) * _latticeStrides[position];
+		}
+	}
+
+	return latticeIndex;
+}
+
+CommonBridgingCompositionLattice::ChemicalComposition CommonBridgingCompositionLattice::scanClosestLowerFeasibleComposition(const ChemicalComposition& composition) const
+{
+	ChemicalComposition closestComposition;
+	{
+		for (const auto& feasibleComposition : _feasibleCompositions)
+		{
+			if (composition < feasibleComposition)
+				break;
+
+			else if (feasibleComposition == composition)
+				return composition;
+
+			else
+			{
+				bool isLowerFeasibleComposition = true;
+				{
+					for (const auto& numAndCount : feasibleComposition)
+					{
+						if (composition.count(AtomicNumber{ numAndCount.first }) < numAndCount.second)
+						{
+							isLowerFeasibleComposition = false;
+							break;
+						}
+					}
+				}
+
+				if (isLowerFeasibleComposition)
+					closestComposition = feasibleComposition;
+			}
+		}
+	}
+
+	return closestComposition;
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
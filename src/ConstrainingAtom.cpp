@@ -1,5 +1,7 @@
 #include "ConstrainingAtom.h"
 
+#include "ConstrainingSpeciesDictionary.h"
+
 #include "OptimalAtom.h"
 #include "SphericalAtom.h"
 
@@ -17,8 +19,9 @@ using namespace MathematicalCrystalChemistry::CrystalModel::Components;
 
 ConstrainingAtom::ConstrainingAtom() noexcept
 	: _ionicAtomicNumber{}
+	, _speciesIndex{ MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::invalidSpeciesIndex() }
 	, _cartesianCoordinate{ 0.0,0.0,0.0 }
-	, _coordinationConstraints{}
+	, _coordinationConstraints{ ConstrainingAtomicSpecies::emptyCoordinationConstraints() }
 	, _covalentRadius{}
 	, _ionicRadius{}
 	, _ionicRepulsionRadius{}
@@ -28,13 +31,17 @@ ConstrainingAtom::ConstrainingAtom() noexcept
 	, _covalentBondedTranslatedAtomIndices{}
 	, _ionicBondedTranslatedAtomIndices{}
 	, _ionicRepulsedTranslatedAtomIndices{}
+	, _coordinationComposition{}
+	, _covalentCoordinationComposition{}
+	, _ionicCoordinationComposition{}
 {
 }
 
-ConstrainingAtom::ConstrainingAtom(const ConstrainingAtomicSpecies& species) noexcept
+ConstrainingAtom::ConstrainingAtom(const ConstrainingAtomicSpecies& species)
 	: _ionicAtomicNumber{ species.ionicAtomicNumber() }
+	, _speciesIndex{ MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::getSpeciesIndex(species.ionicAtomicNumber()) }
 	, _cartesianCoordinate{ 0.0,0.0,0.0 }
-	, _coordinationConstraints{ species.coordinationConstraints() }
+	, _coordinationConstraints{ species.coordinationConstraintsHandle() }
 	, _covalentRadius{ species.covalentRadius() }
 	, _ionicRadius{ species.ionicRadius() }
 	, _ionicRepulsionRadius{ species.ionicRepulsionRadius() }
@@ -44,13 +51,17 @@ ConstrainingAtom::ConstrainingAtom(const ConstrainingAtomicSpecies& species) noe
 	, _covalentBondedTranslatedAtomIndices{}
 	, _ionicBondedTranslatedAtomIndices{}
 	, _ionicRepulsedTranslatedAtomIndices{}
+	, _coordinationComposition{}
+	, _covalentCoordinationComposition{}
+	, _ionicCoordinationComposition{}
 {
 }
 
-ConstrainingAtom::ConstrainingAtom(const ConstrainingAtomicSpecies& species, const NumericalVector& coordinate) noexcept
+ConstrainingAtom::ConstrainingAtom(const ConstrainingAtomicSpecies& species, const NumericalVector& coordinate)
 	: _ionicAtomicNumber{ species.ionicAtomicNumber() }
+	, _speciesIndex{ MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::getSpeciesIndex(species.ionicAtomicNumber()) }
 	, _cartesianCoordinate{ coordinate }
-	, _coordinationConstraints{ species.coordinationConstraints() }
+	, _coordinationConstraints{ species.coordinationConstraintsHandle() }
 	, _covalentRadius{ species.covalentRadius() }
 	, _ionicRadius{ species.ionicRadius() }
 	, _ionicRepulsionRadius{ species.ionicRepulsionRadius() }
@@ -60,43 +71,25 @@ ConstrainingAtom::ConstrainingAtom(const ConstrainingAtomicSpecies& species, con
 	, _covalentBondedTranslatedAtomIndices{}
 	, _ionicBondedTranslatedAtomIndices{}
 	, _ionicRepulsedTranslatedAtomIndices{}
+	, _coordinationComposition{}
+	, _covalentCoordinationComposition{}
+	, _ionicCoordinationComposition{}
 {
 }
 
 ConstrainingAtom::ConstrainingAtom(const IonicAtomicNumber& ian)
-	: _ionicAtomicNumber{ ian }
-	, _cartesianCoordinate{ 0.0,0.0,0.0 }
-	, _coordinationConstraints{ ian.atomicNumber(), ian.formalCharge() }
-	, _covalentRadius{ ian.atomicNumber(), ian.formalCharge() }
-	, _ionicRadius{ ian.atomicNumber(), ian.formalCharge() }
-	, _ionicRepulsionRadius{ ian.atomicNumber(), ian.formalCharge() }
-	, _covalentBondedOriginalAtomIndices{}
-	, _ionicBondedOriginalAtomIndices{}
-	, _ionicRepulsedOriginalAtomIndices{}
-	, _covalentBondedTranslatedAtomIndices{}
-	, _ionicBondedTranslatedAtomIndices{}
-	, _ionicRepulsedTranslatedAtomIndices{}
+	: ConstrainingAtom{ MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::getConstrainingAtomicSpecies(ian) }
 {
 }
 
 ConstrainingAtom::ConstrainingAtom(const IonicAtomicNumber& ian, const NumericalVector& coordinate)
-	: _ionicAtomicNumber{ ian }
-	, _cartesianCoordinate{ coordinate }
-	, _coordinationConstraints{ ian.atomicNumber(), ian.formalCharge() }
-	, _covalentRadius{ ian.atomicNumber(), ian.formalCharge() }
-	, _ionicRadius{ ian.atomicNumber(), ian.formalCharge() }
-	, _ionicRepulsionRadius{ ian.atomicNumber(), ian.formalCharge() }
-	, _covalentBondedOriginalAtomIndices{}
-	, _ionicBondedOriginalAtomIndices{}
-	, _ionicRepulsedOriginalAtomIndices{}
-	, _covalentBondedTranslatedAtomIndices{}
-	, _ionicBondedTranslatedAtomIndices{}
-	, _ionicRepulsedTranslatedAtomIndices{}
+	: ConstrainingAtom{ MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::getConstrainingAtomicSpecies(ian), coordinate }
 {
 }
 
-ConstrainingAtom::ConstrainingAtom(const IonicAtomicNumber& ian, const CoordinationConstraints& coordinations, const SphericalAtom& sphericalAtom) noexcept
+ConstrainingAtom::ConstrainingAtom(const IonicAtomicNumber& ian, const CoordinationConstraintsHandle& coordinations, const SphericalAtom& sphericalAtom)
 	: _ionicAtomicNumber{ ian }
+	, _speciesIndex{ MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::getSpeciesIndex(ian) }
 	, _cartesianCoordinate{ sphericalAtom.cartesianCoordinate() }
 	, _coordinationConstraints{ coordinations }
 	, _covalentRadius{ sphericalAtom.covalentRadius() }
@@ -108,22 +101,14 @@ ConstrainingAtom::ConstrainingAtom(const IonicAtomicNumber& ian, const Coordinat
 	, _covalentBondedTranslatedAtomIndices{}
 	, _ionicBondedTranslatedAtomIndices{}
 	, _ionicRepulsedTranslatedAtomIndices{}
+	, _coordinationComposition{}
+	, _covalentCoordinationComposition{}
+	, _ionicCoordinationComposition{}
 {
 }
 
 ConstrainingAtom::ConstrainingAtom(const OptimalAtom& optimalAtom)
-	: _ionicAtomicNumber{ optimalAtom.ionicAtomicNumber() }
-	, _cartesianCoordinate{ optimalAtom.cartesianCoordinate() }
-	, _coordinationConstraints{ optimalAtom.ionicAtomicNumber().atomicNumber(), optimalAtom.ionicAtomicNumber().formalCharge() }
-	, _covalentRadius{ optimalAtom.ionicAtomicNumber().atomicNumber(), optimalAtom.ionicAtomicNumber().formalCharge() }
-	, _ionicRadius{ optimalAtom.ionicAtomicNumber().atomicNumber(), optimalAtom.ionicAtomicNumber().formalCharge() }
-	, _ionicRepulsionRadius{ optimalAtom.ionicAtomicNumber().atomicNumber(), optimalAtom.ionicAtomicNumber().formalCharge() }
-	, _covalentBondedOriginalAtomIndices{}
-	, _ionicBondedOriginalAtomIndices{}
-	, _ionicRepulsedOriginalAtomIndices{}
-	, _covalentBondedTranslatedAtomIndices{}
-	, _ionicBondedTranslatedAtomIndices{}
-	, _ionicRepulsedTranslatedAtomIndices{}
+	: ConstrainingAtom{ MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::getConstrainingAtomicSpecies(optimalAtom.ionicAtomicNumber()), optimalAtom.cartesianCoordinate() }
 {
 }
 
@@ -14,7 +14,7 @@ using namespace MathematicalCrystalChemistry::CrystalModel::Components;
 
 ConstrainingAtomicSpecies::ConstrainingAtomicSpecies() noexcept
 	: _ionicAtomicNumber{}
-	, _coordinationConstraints{}
+	, _coordinationConstraints{ emptyCoordinationConstraints() }
 	, _covalentRadius{}
 	, _ionicRadius{}
 	, _ionicRepulsionRadius{}
@@ -23,13 +23,19 @@ ConstrainingAtomicSpecies::ConstrainingAtomicSpecies() noexcept
 
 ConstrainingAtomicSpecies::ConstrainingAtomicSpecies(const IonicAtomicNumber& number)
 	: _ionicAtomicNumber{ number }
-	, _coordinationConstraints{ number.atomicNumber(), number.formalCharge() }
+	, _coordinationConstraints{ std::make_shared<const CoordinationConstraints>(number.atomicNumber(), number.formalCharge()) }
 	, _covalentRadius{ number.atomicNumber(), number.formalCharge() }
 	, _ionicRadius{ number.atomicNumber(), number.formalCharge() }
 	, _ionicRepulsionRadius{ number.atomicNumber(), number.formalCharge() }
 {
 }
 
+const ConstrainingAtomicSpecies::CoordinationConstraintsHandle& ConstrainingAtomicSpecies::emptyCoordinationConstraints() noexcept
+{
+	static const CoordinationConstraintsHandle emptyConstraints{ std::make_shared<const CoordinationConstraints>() };
+	return emptyConstraints;
+}
+
 // Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -1,9 +1,14 @@
 #include "ConstrainingCrystalStructure.h"
 
 #include <algorithm>
+#include <cmath>
+#include <map>
 #include <random>
+#include <unordered_set>
 
-#include "SpaceGroupTypeSearcher.h"
+#include "InvalidOperationException.h"
+
+#include "DelaunayReducer.h"
 
 #include "ObjectiveCrystalStructure.h"
 #include "OptimalCrystalStructure.h"
@@ -27,6 +32,7 @@ double ConstrainingCrystalStructure::s_defaultMinimumFeasiblePackingFraction{ 0.
 ConstrainingCrystalStructure::ConstrainingCrystalStructure() noexcept
 	: LinkedPolyhedraRetriever{}
 	, _minimumFeasiblePackingFraction{ s_defaultMinimumFeasiblePackingFraction }
+	, _needReductionValidation{ false }
 	, m_randomEngine{}
 {
 	std::random_device seedGen;
@@ -36,6 +42,7 @@ ConstrainingCrystalStructure::ConstrainingCrystalStructure() noexcept
 ConstrainingCrystalStructure::ConstrainingCrystalStructure(const ChemToolkit::Crystallography::UnitCell& cell, const std::vector<ConstrainingAtom>& atoms) noexcept
 	: LinkedPolyhedraRetriever{ cell, atoms }
 	, _minimumFeasiblePackingFraction{ s_defaultMinimumFeasiblePackingFraction }
+	, _needReductionValidation{ false }
 	, m_randomEngine{}
 {
 	std::random_device seedGen;
@@ -45,6 +52,7 @@ ConstrainingCrystalStructure::ConstrainingCrystalStructure(const ChemToolkit::Cr
 ConstrainingCrystalStructure::ConstrainingCrystalStructure(const ChemToolkit::Crystallography::UnitCell& cell, std::vector<ConstrainingAtom>&& atoms) noexcept
 	: LinkedPolyhedraRetriever{ cell, std::move(atoms) }
 	, _minimumFeasiblePackingFraction{ s_defaultMinimumFeasiblePackingFraction }
+	, _needReductionValidation{ false }
 	, m_randomEngine{}
 {
 	std::random_device seedGen;
@@ -54,6 +62,7 @@ ConstrainingCrystalStructure::ConstrainingCrystalStructure(const ChemToolkit::Cr
 ConstrainingCrystalStructure::ConstrainingCrystalStructure(const ObjectiveCrystalStructure& structure)
 	: LinkedPolyhedraRetriever{ structure.unitCell() }
 	, _minimumFeasiblePackingFraction{ s_defaultMinimumFeasiblePackingFraction }
+	, _needReductionValidation{ false }
 	, m_randomEngine{}
 {
 	std::random_device seedGen;
@@ -97,6 +106,7 @@ ConstrainingCrystalStructure::ConstrainingCrystalStructure(const ObjectiveCrysta
 ConstrainingCrystalStructure::ConstrainingCrystalStructure(const OptimalCrystalStructure& structure)
 	: LinkedPolyhedraRetriever{ structure.unitCell() }
 	, _minimumFeasiblePackingFraction{ s_defaultMinimumFeasiblePackingFraction }
+	, _needReductionValidation{ false }
 	, m_randomEngine{}
 {
 	std::random_device seedGen;
@@ -311,10 +321,24 @@ void ConstrainingCrystalStructure::reduceStructure()
 		{
 			if ((_minimumFeasiblePackingFraction * cellVolume) < getAtomicSphereVolume())
 			{
-				ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher spaceGroupTypeSearcher{ 0.000001 };
-				spaceGroupTypeSearcher.applyDelaunayReduction(unitCell(), atoms());
+				ChemToolkit::Crystallography::DelaunayReducer delaunayReducer{ 0.000001 };
+				TransformationMatrix transformationMatrix = delaunayReducer.getTransformationMatrix(unitCell());
+
+				if (_needReductionValidation)
+				{
+					ConstrainingCrystalStructure remappedStructure{ *this };
+					remappedStructure.updateTracingIndexPairs();
+					remappedStructure.updateConstrainingIndexPairs();
+					remappedStructure.transformUnitCell(transformationMatrix);
+
+					std::vector<double> unreducedBondLengths = getChemicalBondLengths();
+					transformUnitCell(transformationMatrix);
 
-				CrystallineConstraintManager::clearInteratomicDistanceConstraints();
+					validateReducedConstraints(remappedStructure, unreducedBondLengths);
+				}
+
+				else
+					transformUnitCell(transformationMatrix);
 			}
 
 			else
@@ -328,7 +352,10 @@ void ConstrainingCrystalStructure::reduceStructure()
 
 void ConstrainingCrystalStructure::eraseInfeasibleIonicPolyhedraConnections()
 {
-	for (const auto& coordinationPolyhedraLinking : getCoordinationPolyhedraLinkings())
+	// Erasing bonds updates the linking dictionary on the next query, so the loop walks a copy taken before any bond is erased.
+	const auto coordinationPolyhedraLinkings = getCoordinationPolyhedraLinkings();
+
+	for (const auto& coordinationPolyhedraLinking : coordinationPolyhedraLinkings)
 	{
 		std::pair<IonicAtomicNumber, IonicAtomicNumber> ionicAtomicNumberKey = toIonicAtomicNumberPair(coordinationPolyhedraLinking.first);
 		ChemicalComposition commonBridgingAnions = toChemicalComposition(coordinationPolyhedraLinking.second);
@@ -343,7 +370,7 @@ void ConstrainingCrystalStructure::eraseInfeasibleIonicPolyhedraConnections()
 				{
 					for (const auto& translatedIndex : coordinationPolyhedraLinking.second)
 					{
-						if (atoms()[translatedIndex.originalIndex()].ionicAtomicNumber().atomicNumber() == numAndCount.first)
+						if (atoms()[translatedIndex.originalIndex()].ionicAtomicNumber().atomicNumber() == AtomicNumber{ numAndCount.first })
 							commonBridgingIndices.push_back(translatedIndex);
 					}
 
@@ -519,6 +546,150 @@ bool ConstrainingCrystalStructure::isFeasible() const
 	return true;
 }
 
+StructuralHash ConstrainingCrystalStructure::toTopologicalHash() const
+{
+	constexpr size_type numRefinements = 2;
+	constexpr std::uint64_t covalentBondLabel = 1;
+	constexpr std::uint64_t ionicBondLabel = 2;
+	constexpr double bondLengthClassWidth = 0.1;
+
+
+	std::vector<std::vector<std::pair<std::uint64_t, TranslatedAtomIndex>>> bondedNeighbors(atoms().size());
+	{
+		constexpr TranslatedAtomIndex::LatticePoint originalLatticePoint{ 0,0,0 };
+
+		for (size_type index = 0; index < atoms().size(); ++index)
+		{
+			for (const auto& bondedIndex : atoms()[index].getCovalentBondedOriginalAtomIndices())
+				bondedNeighbors[index].push_back(std::make_pair(covalentBondLabel, TranslatedAtomIndex{ bondedIndex, originalLatticePoint }));
+
+			for (const auto& bondedIndex : atoms()[index].getCovalentBondedTranslatedAtomIndices())
+				bondedNeighbors[index].push_back(std::make_pair(covalentBondLabel, bondedIndex));
+
+			for (const auto& bondedIndex : atoms()[index].getIonicBondedOriginalAtomIndices())
+				bondedNeighbors[index].push_back(std::make_pair(ionicBondLabel, TranslatedAtomIndex{ bondedIndex, originalLatticePoint }));
+
+			for (const auto& bondedIndex : atoms()[index].getIonicBondedTranslatedAtomIndices())
+				bondedNeighbors[index].push_back(std::make_pair(ionicBondLabel, bondedIndex));
+		}
+	}
+
+
+	// Bonds are labeled by type and by length class relative to the shortest bond of the atom, so that distorted and regular polyhedra differ.
+	std::vector<std::vector<std::pair<std::uint64_t, OriginalAtomIndex>>> labeledNeighbors(atoms().size());
+	{
+		const NumericalMatrix& basisVectors = unitCell().basisVectors();
+
+		for (size_type index = 0; index < atoms().size(); ++index)
+		{
+			std::vector<double> bondLengths;
+			{
+				for (const auto& labelAndIndex : bondedNeighbors[index])
+				{
+					const NumericalVector bondedCoordinate = atoms()[labelAndIndex.second.originalIndex()].cartesianCoordinate() + (basisVectors * labelAndIndex.second.getLatticePointVector());
+					bondLengths.push_back((bondedCoordinate - atoms()[index].cartesianCoordinate()).norm());
+				}
+			}
+
+			const double minBondLength = bondLengths.empty() ? 0.0 : *std::min_element(bondLengths.begin(), bondLengths.end());
+
+			for (size_type position = 0; position < bondedNeighbors[index].size(); ++position)
+			{
+				const std::uint64_t bondLengthClass = (0.0 < minBondLength) ? static_cast<std::uint64_t>(std::floor(((bondLengths[position] / minBondLength) - 1.0) / bondLengthClassWidth)) : 0;
+				labeledNeighbors[index].push_back(std::make_pair(((bondedNeighbors[index][position].first << 16) | bondLengthClass), bondedNeighbors[index][position].second.originalIndex()));
+			}
+		}
+	}
+
+
+	std::vector<StructuralHash> atomHashes(atoms().size());
+	{
+		for (size_type index = 0; index < atoms().size(); ++index)
+		{
+			const std::uint64_t atomicNumber = static_cast<std::uint64_t>(static_cast<unsigned short>(atoms()[index].ionicAtomicNumber().atomicNumber()));
+			const std::uint64_t formalCharge = static_cast<std::uint64_t>(static_cast<unsigned short>(static_cast<short>(atoms()[index].ionicAtomicNumber().formalCharge())));
+
+			atomHashes[index].add((atomicNumber << 16) | formalCharge);
+			atomHashes[index].add(static_cast<std::uint64_t>(atoms()[index].getCovalentCoordinationNumber()));
+			atomHashes[index].add(static_cast<std::uint64_t>(atoms()[index].getIonicCoordinationNumber()));
+
+
+			// Polyhedral sharing: the number of common bonded atoms with each second neighbor separates vertex, edge, and face sharing.
+			std::map<TranslatedAtomIndex, std::uint64_t> secondNeighborAndSharing;
+			{
+				const TranslatedAtomIndex centralIndex{ static_cast<OriginalAtomIndex>(index), TranslatedAtomIndex::LatticePoint{ 0,0,0 } };
+
+				for (const auto& labelAndIndex : bondedNeighbors[index])
+				{
+					for (const auto& secondLabelAndIndex : bondedNeighbors[labelAndIndex.second.originalIndex()])
+					{
+						const TranslatedAtomIndex secondNeighborIndex = secondLabelAndIndex.second.toTranslatedIndex(labelAndIndex.second.latticePoint());
+
+						if (!(secondNeighborIndex == centralIndex))
+							secondNeighborAndSharing[secondNeighborIndex] += 1;
+					}
+				}
+			}
+
+			std::vector<std::uint64_t> sharingCounts;
+			{
+				for (const auto& neighborAndSharing : secondNeighborAndSharing)
+					sharingCounts.push_back((static_cast<std::uint64_t>(static_cast<unsigned short>(atoms()[neighborAndSharing.first.originalIndex()].ionicAtomicNumber().atomicNumber())) << 16) | neighborAndSharing.second);
+			}
+
+			std::sort(sharingCounts.begin(), sharingCounts.end());
+
+			for (const auto& sharingCount : sharingCounts)
+				atomHashes[index].add(sharingCount);
+		}
+	}
+
+	for (size_type rep = 0; rep < numRefinements; ++rep)
+	{
+		std::vector<StructuralHash> refinedHashes(atoms().size());
+		{
+			for (size_type index = 0; index < atoms().size(); ++index)
+			{
+				std::vector<StructuralHash> neighborHashes;
+				{
+					for (const auto& labelAndIndex : labeledNeighbors[index])
+					{
+						StructuralHash neighborHash;
+						neighborHash.add(labelAndIndex.first);
+						neighborHash.add(atomHashes[labelAndIndex.second]);
+
+						neighborHashes.push_back(neighborHash);
+					}
+				}
+
+				std::sort(neighborHashes.begin(), neighborHashes.end());
+
+
+				refinedHashes[index].add(atomHashes[index]);
+				{
+					for (const auto& neighborHash : neighborHashes)
+						refinedHashes[index].add(neighborHash);
+				}
+			}
+		}
+
+		atomHashes = std::move(refinedHashes);
+	}
+
+	std::sort(atomHashes.begin(), atomHashes.end());
+
+
+	StructuralHash topologicalHash;
+	{
+		topologicalHash.add(static_cast<std::uint64_t>(atomHashes.size()));
+
+		for (const auto& atomHash : atomHashes)
+			topologicalHash.add(atomHash);
+	}
+
+	return topologicalHash;
+}
+
 // Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -537,75 +708,54 @@ bool ConstrainingCrystalStructure::isFeasible() const
 
 void ConstrainingCrystalStructure::createChemicalBonds()
 {
-	for (size_type originalIndex = 0; originalIndex < atoms().size(); ++originalIndex)
+	if (isParallelConstrainable())
 	{
-		for (size_type translatedOriginalIndex = (1 + originalIndex); translatedOriginalIndex < atoms().size(); ++translatedOriginalIndex)
+		std::vector<std::vector<ChemicalBondType>> chemicalBondTypes(atoms().size());
 		{
-			if (isInnateChemicalBondable(originalIndex, translatedOriginalIndex))
-			{
-				if (isIonicAttractive(originalIndex, translatedOriginalIndex))
+			executeParallelTasks(chemicalBondTypes.size(), [this, &chemicalBondTypes](const std::size_t taskIndex)
 				{
-					if (isInnateIonicBondable(originalIndex, translatedOriginalIndex) && isConstrainableIonicBondingDistance(originalIndex, translatedOriginalIndex))
-						createIonicBond(originalIndex, translatedOriginalIndex);
-				}
-
-				else if (isIonicRepulsive(originalIndex, translatedOriginalIndex))
-				{
-					if (isInnateCovalentBondable(originalIndex, translatedOriginalIndex) && isConstrainableCovalentBondingDistance(originalIndex, translatedOriginalIndex))
-						createCovalentBond(originalIndex, translatedOriginalIndex);
-					else
-						createIonicRepulsion(originalIndex, translatedOriginalIndex);
-				}
+					OriginalAtomIndex originalIndex = static_cast<OriginalAtomIndex>(taskIndex);
 
-				else
-				{
-					if (isInnateCovalentBondable(originalIndex, translatedOriginalIndex) && isConstrainableCovalentBondingDistance(originalIndex, translatedOriginalIndex))
-						createCovalentBond(originalIndex, translatedOriginalIndex);
-				}
-			}
+					for (size_type translatedOriginalIndex = (1 + originalIndex); translatedOriginalIndex < atoms().size(); ++translatedOriginalIndex)
+						chemicalBondTypes[taskIndex].push_back(classifyChemicalBond(originalIndex, translatedOriginalIndex));
+				});
+		}
 
-			else
-			{
-				if (isIonicRepulsive(originalIndex, translatedOriginalIndex))
-					createIonicRepulsion(originalIndex, translatedOriginalIndex);
-			}
+		for (size_type originalIndex = 0; originalIndex < atoms().size(); ++originalIndex)
+		{
+			for (size_type translatedOriginalIndex = (1 + originalIndex); translatedOriginalIndex < atoms().size(); ++translatedOriginalIndex)
+				createChemicalBond(originalIndex, translatedOriginalIndex, chemicalBondTypes[originalIndex][translatedOriginalIndex - originalIndex - 1]);
 		}
 	}
 
-
-	for (const auto& indices : constrainingIndexPairs())
+	else
 	{
-		NumericalVector translationVector = toTranslationVector(indices.translatedAtomIndex().latticePoint());
-
-
-		if (isInnateChemicalBondable(indices.originalAtomIndex(), indices.translatedAtomIndex().originalIndex()))
+		for (size_type originalIndex = 0; originalIndex < atoms().size(); ++originalIndex)
 		{
-			if (isIonicAttractive(indices.originalAtomIndex(), indices.translatedAtomIndex()))
-			{
-				if (isInnateIonicBondable(indices.originalAtomIndex(), indices.translatedAtomIndex().originalIndex()) && isConstrainableIonicBondingDistance(indices.originalAtomIndex(), indices.translatedAtomIndex().originalIndex(), translationVector))
-					createIonicBond(indices.originalAtomIndex(), indices.translatedAtomIndex());
-			}
-
-			else if (isIonicRepulsive(indices.originalAtomIndex(), indices.translatedAtomIndex()))
-			{
-				if (isInnateCovalentBondable(indices.originalAtomIndex(), indices.translatedAtomIndex().originalIndex()) && isConstrainableCovalentBondingDistance(indices.originalAtomIndex(), indices.translatedAtomIndex().originalIndex(), translationVector))
-					createCovalentBond(indices.originalAtomIndex(), indices.translatedAtomIndex());
-				else
-					createIonicRepulsion(indices.originalAtomIndex(), indices.translatedAtomIndex());
-			}
-
-			else
-			{
-				if (isInnateCovalentBondable(indices.originalAtomIndex(), indices.translatedAtomIndex().originalIndex()) && isConstrainableCovalentBondingDistance(indices.originalAtomIndex(), indices.translatedAtomIndex().originalIndex(), translationVector))
-					createCovalentBond(indices.originalAtomIndex(), indices.translatedAtomIndex());
-			}
+			for (size_type translatedOriginalIndex = (1 + originalIndex); translatedOriginalIndex < atoms().size(); ++translatedOriginalIndex)
+				createChemicalBond(originalIndex, translatedOriginalIndex, classifyChemicalBond(originalIndex, translatedOriginalIndex));
 		}
+	}
 
-		else
+
+	if (isParallelConstrainable())
+	{
+		std::vector<ChemicalBondType> chemicalBondTypes(constrainingIndexPairs().size(), ChemicalBondType::none);
 		{
-			if (isIonicRepulsive(indices.originalAtomIndex(), indices.translatedAtomIndex()))
-				createIonicRepulsion(indices.originalAtomIndex(), indices.translatedAtomIndex());
+			executeParallelTasks(chemicalBondTypes.size(), [this, &chemicalBondTypes](const std::size_t taskIndex)
+				{
+					chemicalBondTypes[taskIndex] = classifyChemicalBond(constrainingIndexPairs()[taskIndex].originalAtomIndex(), constrainingIndexPairs()[taskIndex].translatedAtomIndex());
+				});
 		}
+
+		for (std::size_t index = 0; index < constrainingIndexPairs().size(); ++index)
+			createChemicalBond(constrainingIndexPairs()[index].originalAtomIndex(), constrainingIndexPairs()[index].translatedAtomIndex(), chemicalBondTypes[index]);
+	}
+
+	else
+	{
+		for (const auto& indices : constrainingIndexPairs())
+			createChemicalBond(indices.originalAtomIndex(), indices.translatedAtomIndex(), classifyChemicalBond(indices.originalAtomIndex(), indices.translatedAtomIndex()));
 	}
 }
 
@@ -631,7 +781,7 @@ void ConstrainingCrystalStructure::optimizeCoordinationCompositions()
 
 				if (centralAtom.coordinationConstraints().hasLowerBoundCompositions())
 				{
-					ChemicalComposition closestLowerBoundComposition = centralAtom.coordinationConstraints().getClosestLowerBoundComposition(toCoordinationComposition(covalentOriginalAtomIndices, covalentTranslatedAtomIndices), toCoordinationComposition(ionicOriginalAtomIndices, ionicTranslatedAtomIndices));
+					ChemicalComposition closestLowerBoundComposition = centralAtom.coordinationConstraints().getClosestLowerBoundComposition(getCovalentCoordinationComposition(centralAtomIndex), getIonicCoordinationComposition(centralAtomIndex));
 
 
 					if (centralAtom.coordinationConstraints().getClosestFeasibleCovalentCoordinationNumber(centralAtom.getCovalentCoordinationNumber()) < centralAtom.getCovalentCoordinationNumber())
@@ -666,6 +816,79 @@ void ConstrainingCrystalStructure::optimizeCoordinationCompositions()
 	}
 }
 
+void ConstrainingCrystalStructure::validateReducedConstraints(const ConstrainingCrystalStructure& remappedStructure, const std::vector<double>& unreducedBondLengths) const
+{
+	ConstrainingCrystalStructure rebuiltStructure{ *this };
+	rebuiltStructure.updateTracingIndexPairs();
+	rebuiltStructure.updateConstrainingIndexPairs();
+
+
+	std::unordered_set<ConstrainerIndices<TranslatedAtomIndex>, ConstrainerIndices<TranslatedAtomIndex>::Hasher> remappedTracingIndexPairs{ remappedStructure.tracingIndexPairs().begin(), remappedStructure.tracingIndexPairs().end() };
+	std::unordered_set<ConstrainerIndices<TranslatedAtomIndex>, ConstrainerIndices<TranslatedAtomIndex>::Hasher> rebuiltTracingIndexPairs{ rebuiltStructure.tracingIndexPairs().begin(), rebuiltStructure.tracingIndexPairs().end() };
+
+	if (!(remappedTracingIndexPairs == rebuiltTracingIndexPairs))
+		throw System::ExceptionServices::InvalidOperationException{ typeid(*this), "validateReducedConstraints", "Remapped tracing index pairs differ from rebuilt ones." };
+
+
+	std::unordered_set<ConstrainerIndices<TranslatedAtomIndex>, ConstrainerIndices<TranslatedAtomIndex>::Hasher> remappedConstrainingIndexPairs{ remappedStructure.constrainingIndexPairs().begin(), remappedStructure.constrainingIndexPairs().end() };
+	std::unordered_set<ConstrainerIndices<TranslatedAtomIndex>, ConstrainerIndices<TranslatedAtomIndex>::Hasher> rebuiltConstrainingIndexPairs{ rebuiltStructure.constrainingIndexPairs().begin(), rebuiltStructure.constrainingIndexPairs().end() };
+
+	if (!(remappedConstrainingIndexPairs == rebuiltConstrainingIndexPairs))
+		throw System::ExceptionServices::InvalidOperationException{ typeid(*this), "validateReducedConstraints", "Remapped constraining index pairs differ from rebuilt ones." };
+
+
+	std::vector<double> reducedBondLengths = getChemicalBondLengths();
+	{
+		if (reducedBondLengths.size() != unreducedBondLengths.size())
+			throw System::ExceptionServices::InvalidOperationException{ typeid(*this), "validateReducedConstraints", "Number of chemical bonds is changed by the reduction." };
+
+		for (std::size_t index = 0; index < reducedBondLengths.size(); ++index)
+		{
+			if (0.000001 < std::abs(reducedBondLengths[index] - unreducedBondLengths[index]))
+				throw System::ExceptionServices::InvalidOperationException{ typeid(*this), "validateReducedConstraints", "Chemical bond lengths are changed by the reduction." };
+		}
+	}
+}
+
+std::vector<double> ConstrainingCrystalStructure::getChemicalBondLengths() const
+{
+	std::vector<double> bondLengths;
+	{
+		for (size_type originalIndex = 0; originalIndex < atoms().size(); ++originalIndex)
+		{
+			const ConstrainingAtom& atom = atoms()[originalIndex];
+
+			std::vector<TranslatedAtomIndex> chemicalBondedIndices;
+			{
+				for (const auto& bondedIndex : atom.getCovalentBondedOriginalAtomIndices())
+					chemicalBondedIndices.push_back(TranslatedAtomIndex{ bondedIndex });
+				for (const auto& bondedIndex : atom.getIonicBondedOriginalAtomIndices())
+					chemicalBondedIndices.push_back(TranslatedAtomIndex{ bondedIndex });
+				for (const auto& bondedIndex : atom.getIonicRepulsedOriginalAtomIndices())
+					chemicalBondedIndices.push_back(TranslatedAtomIndex{ bondedIndex });
+
+				for (const auto& bondedIndex : atom.getCovalentBondedTranslatedAtomIndices())
+					chemicalBondedIndices.push_back(bondedIndex);
+				for (const auto& bondedIndex : atom.getIonicBondedTranslatedAtomIndices())
+					chemicalBondedIndices.push_back(bondedIndex);
+				for (const auto& bondedIndex : atom.getIonicRepulsedTranslatedAtomIndices())
+					chemicalBondedIndices.push_back(bondedIndex);
+			}
+
+			for (const auto& bondedIndex : chemicalBondedIndices)
+			{
+				NumericalVector bondVector = atoms()[bondedIndex.originalIndex()].cartesianCoordinate() + toTranslationVector(bondedIndex.latticePoint());
+				bondVector -= atom.cartesianCoordinate();
+
+				bondLengths.push_back(bondVector.norm());
+			}
+		}
+	}
+
+	std::sort(bondLengths.begin(), bondLengths.end());
+	return bondLengths;
+}
+
 // Private methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -759,14 +982,11 @@ void ConstrainingCrystalStructure::makeClosestCoordinationNumber(const OriginalA
 
 void ConstrainingCrystalStructure::makeClosestCoordinationNumber(const OriginalAtomIndex centralAtomIndex, const size_type closestCoordinationNumber, const ChemicalComposition& closestLowerBoundComposition, std::vector<std::pair<double, OriginalAtomIndex>>& originalAtomIndices, std::vector<std::pair<double, TranslatedAtomIndex>>& translatedAtomIndices)
 {
-	const ConstrainingAtom& centralAtom = atoms()[centralAtomIndex];
+	ChemicalComposition coordinationComposition = toCoordinationComposition(originalAtomIndices, translatedAtomIndices);
 
 
 	while (closestCoordinationNumber < (originalAtomIndices.size() + translatedAtomIndices.size()))
 	{
-		ChemicalComposition coordinationComposition = toCoordinationComposition(originalAtomIndices, translatedAtomIndices);
-
-
 		if (translatedAtomIndices.back().first < originalAtomIndices.back().first)
 		{
 			AtomicNumber longestAtomicNumber = atoms()[originalAtomIndices.back().second].ionicAtomicNumber().atomicNumber();
@@ -775,6 +995,7 @@ void ConstrainingCrystalStructure::makeClosestCoordinationNumber(const OriginalA
 			{
 				eraseCovalentBond(centralAtomIndex, originalAtomIndices.back().second);
 				eraseIonicBond(centralAtomIndex, originalAtomIndices.back().second);
+				coordinationComposition.remove(longestAtomicNumber);
 				originalAtomIndices.pop_back();
 			}
 
@@ -790,6 +1011,7 @@ void ConstrainingCrystalStructure::makeClosestCoordinationNumber(const OriginalA
 			{
 				eraseCovalentBond(centralAtomIndex, translatedAtomIndices.back().second);
 				eraseIonicBond(centralAtomIndex, translatedAtomIndices.back().second);
+				coordinationComposition.remove(longestAtomicNumber);
 				translatedAtomIndices.pop_back();
 			}
 
@@ -799,6 +1021,76 @@ void ConstrainingCrystalStructure::makeClosestCoordinationNumber(const OriginalA
 	}
 }
 
+ConstrainingCrystalStructure::ChemicalBondType ConstrainingCrystalStructure::classifyChemicalBond(const OriginalAtomIndex originalIndex, const OriginalAtomIndex translatedOriginalIndex) const noexcept
+{
+	if (isInnateChemicalBondable(originalIndex, translatedOriginalIndex))
+	{
+		if (isIonicAttractive(originalIndex, translatedOriginalIndex))
+		{
+			if (isInnateIonicBondable(originalIndex, translatedOriginalIndex) && isConstrainableIonicBondingDistance(originalIndex, translatedOriginalIndex))
+				return ChemicalBondType::ionicBond;
+		}
+
+		else if (isIonicRepulsive(originalIndex, translatedOriginalIndex))
+		{
+			if (isInnateCovalentBondable(originalIndex, translatedOriginalIndex) && isConstrainableCovalentBondingDistance(originalIndex, translatedOriginalIndex))
+				return ChemicalBondType::covalentBond;
+			else
+				return ChemicalBondType::ionicRepulsion;
+		}
+
+		else
+		{
+			if (isInnateCovalentBondable(originalIndex, translatedOriginalIndex) && isConstrainableCovalentBondingDistance(originalIndex, translatedOriginalIndex))
+				return ChemicalBondType::covalentBond;
+		}
+	}
+
+	else
+	{
+		if (isIonicRepulsive(originalIndex, translatedOriginalIndex))
+			return ChemicalBondType::ionicRepulsion;
+	}
+
+	return ChemicalBondType::none;
+}
+
+ConstrainingCrystalStructure::ChemicalBondType ConstrainingCrystalStructure::classifyChemicalBond(const OriginalAtomIndex originalIndex, const TranslatedAtomIndex& translatedIndex) const noexcept
+{
+	NumericalVector translationVector = toTranslationVector(translatedIndex.latticePoint());
+
+	if (isInnateChemicalBondable(originalIndex, translatedIndex.originalIndex()))
+	{
+		if (isIonicAttractive(originalIndex, translatedIndex))
+		{
+			if (isInnateIonicBondable(originalIndex, translatedIndex.originalIndex()) && isConstrainableIonicBondingDistance(originalIndex, translatedIndex.originalIndex(), translationVector))
+				return ChemicalBondType::ionicBond;
+		}
+
+		else if (isIonicRepulsive(originalIndex, translatedIndex))
+		{
+			if (isInnateCovalentBondable(originalIndex, translatedIndex.originalIndex()) && isConstrainableCovalentBondingDistance(originalIndex, translatedIndex.originalIndex(), translationVector))
+				return ChemicalBondType::covalentBond;
+			else
+				return ChemicalBondType::ionicRepulsion;
+		}
+
+		else
+		{
+			if (isInnateCovalentBondable(originalIndex, translatedIndex.originalIndex()) && isConstrainableCovalentBondingDistance(originalIndex, translatedIndex.originalIndex(), translationVector))
+				return ChemicalBondType::covalentBond;
+		}
+	}
+
+	else
+	{
+		if (isIonicRepulsive(originalIndex, translatedIndex))
+			return ChemicalBondType::ionicRepulsion;
+	}
+
+	return ChemicalBondType::none;
+}
+
 // Private utility
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
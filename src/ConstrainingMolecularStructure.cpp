@@ -209,7 +209,10 @@ void ConstrainingMolecularStructure::distortStructureLargely()
 
 void ConstrainingMolecularStructure::eraseInfeasibleIonicPolyhedraConnections()
 {
-	for (const auto& ionicCoordinationPolyhedraLinking : getCoordinationPolyhedraLinkings())
+	// The linking dictionary is resynchronized after the bonds below are erased, so iterate a copy of it.
+	const auto ionicCoordinationPolyhedraLinkings = getCoordinationPolyhedraLinkings();
+
+	for (const auto& ionicCoordinationPolyhedraLinking : ionicCoordinationPolyhedraLinkings)
 	{
 		std::pair<IonicAtomicNumber, IonicAtomicNumber> ionicAtomicNumberKey = toIonicAtomicNumberPair(ionicCoordinationPolyhedraLinking.first);
 		ChemicalComposition commonBridgingAnions = toChemicalComposition(ionicCoordinationPolyhedraLinking.second);
@@ -224,7 +227,7 @@ void ConstrainingMolecularStructure::eraseInfeasibleIonicPolyhedraConnections()
 				{
 					for (const auto& translatedIndex : ionicCoordinationPolyhedraLinking.second)
 					{
-						if (atoms()[translatedIndex.originalIndex()].ionicAtomicNumber().atomicNumber() == numAndCount.first)
+						if (atoms()[translatedIndex.originalIndex()].ionicAtomicNumber().atomicNumber() == AtomicNumber{ numAndCount.first })
 							commonBridgingIndices.push_back(translatedIndex);
 					}
 
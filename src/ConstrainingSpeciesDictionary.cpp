@@ -0,0 +1,133 @@
+#include "ConstrainingSpeciesDictionary.h"
+
+#include "InvalidOperationException.h"
+
+using namespace MathematicalCrystalChemistry::CrystalModel::Constraints;
+
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Methods
+
+// Slots and pair tables are allocated for maxNumSpecies() up front, so interning a species never moves what other threads are reading.
+std::vector<ConstrainingSpeciesDictionary::ConstrainingAtomicSpecies> ConstrainingSpeciesDictionary::s_constrainingAtomicSpecies(ConstrainingSpeciesDictionary::maxNumSpecies());
+std::atomic<ConstrainingSpeciesDictionary::size_type> ConstrainingSpeciesDictionary::s_numSpecies{ 0 };
+std::mutex ConstrainingSpeciesDictionary::s_internMutex;
+
+std::vector<char> ConstrainingSpeciesDictionary::s_ionicAttractivities(static_cast<std::size_t>(ConstrainingSpeciesDictionary::maxNumSpecies()) * ConstrainingSpeciesDictionary::maxNumSpecies(), 0);
+std::vector<char> ConstrainingSpeciesDictionary::s_ionicRepulsivities(static_cast<std::size_t>(ConstrainingSpeciesDictionary::maxNumSpecies()) * ConstrainingSpeciesDictionary::maxNumSpecies(), 0);
+std::vector<char> ConstrainingSpeciesDictionary::s_innateChemicalBondabilities(static_cast<std::size_t>(ConstrainingSpeciesDictionary::maxNumSpecies()) * ConstrainingSpeciesDictionary::maxNumSpecies(), 0);
+std::vector<char> ConstrainingSpeciesDictionary::s_innateCovalentBondabilities(static_cast<std::size_t>(ConstrainingSpeciesDictionary::maxNumSpecies()) * ConstrainingSpeciesDictionary::maxNumSpecies(), 0);
+std::vector<char> ConstrainingSpeciesDictionary::s_innateIonicBondabilities(static_cast<std::size_t>(ConstrainingSpeciesDictionary::maxNumSpecies()) * ConstrainingSpeciesDictionary::maxNumSpecies(), 0);
+
+
+
+void ConstrainingSpeciesDictionary::initialize(const ChemicalComposition& crystalComposition)
+{
+	ConstrainingChemicalComposition constrainingCrystalComposition;
+	{
+		for (const auto& numAndCount : crystalComposition)
+			constrainingCrystalComposition.add(ConstrainingAtomicSpecies{ numAndCount.first }, numAndCount.second);
+	}
+
+	initialize(constrainingCrystalComposition);
+}
+
+void ConstrainingSpeciesDictionary::initialize(const ConstrainingChemicalComposition& constrainingCrystalComposition)
+{
+	// Species are never removed, so the indices held by atoms of earlier compositions stay valid.
+	for (const auto& speciesAndCount : constrainingCrystalComposition)
+	{
+		if (findSpeciesIndex(speciesAndCount.first.ionicAtomicNumber()) == invalidSpeciesIndex())
+			internSpecies(speciesAndCount.first);
+	}
+}
+
+// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+ConstrainingSpeciesDictionary::size_type ConstrainingSpeciesDictionary::internSpecies(const ConstrainingAtomicSpecies& species)
+{
+	std::lock_guard<std::mutex> guard{ s_internMutex };
+	const size_type speciesIndex = s_numSpecies.load(std::memory_order_relaxed);
+
+	// Another thread may have interned the same species while this one was waiting.
+	for (size_type internedIndex = 0; internedIndex < speciesIndex; ++internedIndex)
+	{
+		if (s_constrainingAtomicSpecies[internedIndex].ionicAtomicNumber() == species.ionicAtomicNumber())
+			return internedIndex;
+	}
+
+	if (!(speciesIndex < maxNumSpecies()))
+		throw System::ExceptionServices::InvalidOperationException{ "MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::internSpecies", "There are more species than the dictionary can hold." };
+
+
+	s_constrainingAtomicSpecies[speciesIndex] = species;
+
+	for (size_type otherIndex = 0; otherIndex <= speciesIndex; ++otherIndex)
+	{
+		setPairTables(speciesIndex, otherIndex);
+		setPairTables(otherIndex, speciesIndex);
+	}
+
+	// Publishing the count last makes the slot and its table rows visible to every thread that later reads the index.
+	s_numSpecies.store(static_cast<size_type>(speciesIndex + 1), std::memory_order_release);
+
+	return speciesIndex;
+}
+
+void ConstrainingSpeciesDictionary::setPairTables(const size_type speciesIndexA, const size_type speciesIndexB) noexcept
+{
+	const ConstrainingAtomicSpecies& speciesA = s_constrainingAtomicSpecies[speciesIndexA];
+	const ConstrainingAtomicSpecies& speciesB = s_constrainingAtomicSpecies[speciesIndexB];
+	const std::size_t pairIndex = toPairIndex(speciesIndexA, speciesIndexB);
+
+	if (speciesA.ionicAtomicNumber().formalCharge().isAnion() && speciesB.ionicAtomicNumber().formalCharge().isCation())
+		s_ionicAttractivities[pairIndex] = 1;
+	else if (speciesA.ionicAtomicNumber().formalCharge().isCation() && speciesB.ionicAtomicNumber().formalCharge().isAnion())
+		s_ionicAttractivities[pairIndex] = 1;
+
+	if (speciesA.ionicAtomicNumber().formalCharge().isAnion() && speciesB.ionicAtomicNumber().formalCharge().isAnion())
+		s_ionicRepulsivities[pairIndex] = 1;
+	else if (speciesA.ionicAtomicNumber().formalCharge().isCation() && speciesB.ionicAtomicNumber().formalCharge().isCation())
+		s_ionicRepulsivities[pairIndex] = 1;
+
+	if (!(speciesA.coordinationConstraints().isInfeasibleAtomicNumber(speciesB.ionicAtomicNumber().atomicNumber())))
+	{
+		if (!(speciesB.coordinationConstraints().isInfeasibleAtomicNumber(speciesA.ionicAtomicNumber().atomicNumber())))
+			s_innateChemicalBondabilities[pairIndex] = 1;
+	}
+
+	if ((0 < speciesA.coordinationConstraints().maxConstrainedCovalentCoordinationNumber()) && (0 < speciesB.coordinationConstraints().maxConstrainedCovalentCoordinationNumber()))
+		s_innateCovalentBondabilities[pairIndex] = 1;
+
+	if ((0 < speciesA.coordinationConstraints().maxConstrainedIonicCoordinationNumber()) && (0 < speciesB.coordinationConstraints().maxConstrainedIonicCoordinationNumber()))
+		s_innateIonicBondabilities[pairIndex] = 1;
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
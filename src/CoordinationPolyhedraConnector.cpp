@@ -117,6 +117,7 @@ std::vector<CoordinationPolyhedraConnector::BasicChemicalComposition> Coordinati
 				constrainingMolecularStructure.setExclusiveRadiusRatio(_coordinationPolyhedraConnectionParameters.geometricalConstraintParameters().minimumExclusionDistanceRatio());
 				constrainingMolecularStructure.setInteratomicDistanceTracerCutoffRatio(_coordinationPolyhedraConnectionParameters.geometricalConstraintParameters().interatomicDistanceTracerCutoffRatio());
 				constrainingMolecularStructure.setInteratomicDistanceConstrainerCutoffRatio(_coordinationPolyhedraConnectionParameters.geometricalConstraintParameters().interatomicDistanceConstrainerCutoffRatio());
+				constrainingMolecularStructure.setParallelConstrainingAtomThreshold(_coordinationPolyhedraConnectionParameters.geometricalConstraintParameters().parallelConstrainingAtomThreshold());
 				constrainingMolecularStructure.updateTracingIndexPairs();
 				constrainingMolecularStructure.createInteratomicDistanceConstraints();
 			}
@@ -150,7 +151,7 @@ std::vector<CoordinationPolyhedraConnector::BasicChemicalComposition> Coordinati
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // Private utility
 
-std::set<CoordinationPolyhedraConnector::BasicChemicalComposition> CoordinationPolyhedraConnector::getPossibleBridgingCompositionDictionary(const std::set<BasicChemicalComposition>& formerFeasibleCompositionDictionary, const std::set<BasicChemicalComposition>& latterFeasibleCompositionDictionary) const
+std::set<CoordinationPolyhedraConnector::BasicChemicalComposition> CoordinationPolyhedraConnector::getPossibleBridgingCompositionDictionary(const std::set<FlatChemicalComposition>& formerFeasibleCompositionDictionary, const std::set<FlatChemicalComposition>& latterFeasibleCompositionDictionary) const
 {
 	std::set<BasicChemicalComposition> possibleBridgingCompositionDictionary;
 	{
@@ -162,10 +163,10 @@ std::set<CoordinationPolyhedraConnector::BasicChemicalComposition> CoordinationP
 				{
 					for (const auto& formerNumAndCount : formerFeasibleComposition)
 					{
-						size_type latterCount = latterFeasibleComposition.count(formerNumAndCount.first);
+						size_type latterCount = latterFeasibleComposition.count(AtomicNumber{ formerNumAndCount.first });
 
 						if (0 < latterCount)
-							maximumCommonBridgingComposition.add(formerNumAndCount.first, std::min(formerNumAndCount.second, latterCount));
+							maximumCommonBridgingComposition.add(AtomicNumber{ formerNumAndCount.first }, std::min(formerNumAndCount.second, latterCount));
 					}
 				}
 
@@ -1,5 +1,7 @@
 #include "CoordinationPolyhedraRetriever.h"
 
+#include <utility>
+
 using namespace MathematicalCrystalChemistry::CrystalModel::Components::Internal;
 
 
@@ -50,42 +52,107 @@ CoordinationPolyhedraRetriever::CoordinationPolyhedraRetriever(const ChemToolkit
 
 void CoordinationPolyhedraRetriever::eraseInfeasibleChemicalBonds()
 {
-	for (size_type originalIndex = 0; originalIndex < atoms().size(); ++originalIndex)
+	if (isParallelConstrainable())
 	{
-		const ConstrainingAtom& constrainingAtom = atoms()[originalIndex];
+		std::vector<std::vector<std::pair<bool, bool>>> infeasibleChemicalBonds(atoms().size());
+		{
+			executeParallelTasks(infeasibleChemicalBonds.size(), [this, &infeasibleChemicalBonds](const std::size_t taskIndex)
+				{
+					OriginalAtomIndex originalIndex = static_cast<OriginalAtomIndex>(taskIndex);
+					const ConstrainingAtom& constrainingAtom = atoms()[originalIndex];
+
+					for (size_type translatedOriginalIndex = (1 + originalIndex); translatedOriginalIndex < atoms().size(); ++translatedOriginalIndex)
+					{
+						bool isInfeasibleIonicBond = (constrainingAtom.hasIonicBondWith(translatedOriginalIndex) && !(isFeasibleIonicBond(originalIndex, translatedOriginalIndex)));
+						bool isInfeasibleCovalentBond = (constrainingAtom.hasCovalentBondWith(translatedOriginalIndex) && !(isFeasibleCovalentBond(originalIndex, translatedOriginalIndex)));
 
+						infeasibleChemicalBonds[taskIndex].push_back(std::make_pair(isInfeasibleIonicBond, isInfeasibleCovalentBond));
+					}
+				});
+		}
 
-		for (size_type translatedOriginalIndex = (1 + originalIndex); translatedOriginalIndex < atoms().size(); ++translatedOriginalIndex)
+		for (size_type originalIndex = 0; originalIndex < atoms().size(); ++originalIndex)
 		{
-			if (constrainingAtom.hasIonicBondWith(translatedOriginalIndex))
+			for (size_type translatedOriginalIndex = (1 + originalIndex); translatedOriginalIndex < atoms().size(); ++translatedOriginalIndex)
 			{
-				if (!(isFeasibleIonicBond(originalIndex, translatedOriginalIndex)))
+				const auto& infeasibleChemicalBond = infeasibleChemicalBonds[originalIndex][translatedOriginalIndex - originalIndex - 1];
+
+				if (infeasibleChemicalBond.first)
 					eraseIonicBond(originalIndex, translatedOriginalIndex);
+
+				if (infeasibleChemicalBond.second)
+					eraseCovalentBond(originalIndex, translatedOriginalIndex);
 			}
+		}
+	}
 
-			if (constrainingAtom.hasCovalentBondWith(translatedOriginalIndex))
+	else
+	{
+		for (size_type originalIndex = 0; originalIndex < atoms().size(); ++originalIndex)
+		{
+			const ConstrainingAtom& constrainingAtom = atoms()[originalIndex];
+
+
+			for (size_type translatedOriginalIndex = (1 + originalIndex); translatedOriginalIndex < atoms().size(); ++translatedOriginalIndex)
 			{
-				if (!(isFeasibleCovalentBond(originalIndex, translatedOriginalIndex)))
-					eraseCovalentBond(originalIndex, translatedOriginalIndex);
+				if (constrainingAtom.hasIonicBondWith(translatedOriginalIndex))
+				{
+					if (!(isFeasibleIonicBond(originalIndex, translatedOriginalIndex)))
+						eraseIonicBond(originalIndex, translatedOriginalIndex);
+				}
+
+				if (constrainingAtom.hasCovalentBondWith(translatedOriginalIndex))
+				{
+					if (!(isFeasibleCovalentBond(originalIndex, translatedOriginalIndex)))
+						eraseCovalentBond(originalIndex, translatedOriginalIndex);
+				}
 			}
 		}
 	}
 
-	for (const auto& indices : constrainingIndexPairs())
+
+	if (isParallelConstrainable())
 	{
-		const ConstrainingAtom& constrainingAtom = atoms()[indices.originalAtomIndex()];
+		std::vector<std::pair<bool, bool>> infeasibleChemicalBonds(constrainingIndexPairs().size(), std::make_pair(false, false));
+		{
+			executeParallelTasks(infeasibleChemicalBonds.size(), [this, &infeasibleChemicalBonds](const std::size_t taskIndex)
+				{
+					const auto& indices = constrainingIndexPairs()[taskIndex];
+					const ConstrainingAtom& constrainingAtom = atoms()[indices.originalAtomIndex()];
 
+					infeasibleChemicalBonds[taskIndex].first = (constrainingAtom.hasIonicBondWith(indices.translatedAtomIndex()) && !(isFeasibleIonicBond(indices.originalAtomIndex(), indices.translatedAtomIndex())));
+					infeasibleChemicalBonds[taskIndex].second = (constrainingAtom.hasCovalentBondWith(indices.translatedAtomIndex()) && !(isFeasibleCovalentBond(indices.originalAtomIndex(), indices.translatedAtomIndex())));
+				});
+		}
 
-		if (constrainingAtom.hasIonicBondWith(indices.translatedAtomIndex()))
+		for (std::size_t index = 0; index < constrainingIndexPairs().size(); ++index)
 		{
-			if (!(isFeasibleIonicBond(indices.originalAtomIndex(), indices.translatedAtomIndex())))
-				eraseIonicBond(indices.originalAtomIndex(), indices.translatedAtomIndex());
+			if (infeasibleChemicalBonds[index].first)
+				eraseIonicBond(constrainingIndexPairs()[index].originalAtomIndex(), constrainingIndexPairs()[index].translatedAtomIndex());
+
+			if (infeasibleChemicalBonds[index].second)
+				eraseCovalentBond(constrainingIndexPairs()[index].originalAtomIndex(), constrainingIndexPairs()[index].translatedAtomIndex());
 		}
+	}
 
-		if (constrainingAtom.hasCovalentBondWith(indices.translatedAtomIndex()))
+	else
+	{
+		for (const auto& indices : constrainingIndexPairs())
 		{
-			if (!(isFeasibleCovalentBond(indices.originalAtomIndex(), indices.translatedAtomIndex())))
-				eraseCovalentBond(indices.originalAtomIndex(), indices.translatedAtomIndex());
+			const ConstrainingAtom& constrainingAtom = atoms()[indices.originalAtomIndex()];
+
+
+			if (constrainingAtom.hasIonicBondWith(indices.translatedAtomIndex()))
+			{
+				if (!(isFeasibleIonicBond(indices.originalAtomIndex(), indices.translatedAtomIndex())))
+					eraseIonicBond(indices.originalAtomIndex(), indices.translatedAtomIndex());
+			}
+
+			if (constrainingAtom.hasCovalentBondWith(indices.translatedAtomIndex()))
+			{
+				if (!(isFeasibleCovalentBond(indices.originalAtomIndex(), indices.translatedAtomIndex())))
+					eraseCovalentBond(indices.originalAtomIndex(), indices.translatedAtomIndex());
+			}
 		}
 	}
 }
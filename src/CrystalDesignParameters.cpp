@@ -29,6 +29,7 @@ CrystalDesignParameters::CrystalDesignParameters() noexcept
 	, _globalStructuralOptimizationParameters{}
 	, _localStructuralOptimizationParameters{}
 	, _preciseStructuralOptimizationParameters{}
+	, _needEarlyDuplicateRejection{ false }
 {
 }
 
@@ -60,6 +61,8 @@ void CrystalDesignParameters::initialize() noexcept
 	_localStructuralOptimizationParameters.initialize();
 	_preciseStructuralOptimizationParameters.initialize();
 
+	_needEarlyDuplicateRejection = false;
+
 
 	MathematicalCrystalChemistry::CrystalModel::Constraints::AtomicRadiusDictionary::initialize();
 	MathematicalCrystalChemistry::CrystalModel::Constraints::CoordinationConstraintsDictionary::initialize();
@@ -76,6 +79,14 @@ void CrystalDesignParameters::initialize(const System::IO::StreamReader& streamR
 		if (!(genericStreamReader.readParameter("Maximum.Number.of.Ceaseless.Global.Structural.Optimization.Steps", _maxCeaselessGlobalStructuralOptimizing)))
 			_maxCeaselessGlobalStructuralOptimizing = s_defaultMaxCeaselessGlobalStructuralOptimizing;
 	}
+	{
+		std::string necessityTexts;
+
+		if (genericStreamReader.readParameter("Early.Duplicate.Rejection", necessityTexts))
+			_needEarlyDuplicateRejection = toNecessity(necessityTexts);
+		else
+			_needEarlyDuplicateRejection = false;
+	}
 
 	_initialStructureGenerationParameters.initialize(streamReader.getListBlock("&", "INITIAL_STRUCTURE_GENERATION"));
 	_geometricalConstraintParameters.initialize(streamReader.getListBlock("&", "GEOMETRICAL_CONSTRAINTS"));
@@ -98,3 +109,31 @@ void CrystalDesignParameters::initialize(const System::IO::StreamReader& streamR
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+bool CrystalDesignParameters::toNecessity(const std::string& inputTexts) const
+{
+	if (inputTexts == "ON" || inputTexts == "On" || inputTexts == "on")
+		return true;
+
+	else if (inputTexts == "OFF" || inputTexts == "Off" || inputTexts == "off")
+		return false;
+
+	else
+		throw System::IO::InvalidFileException{ typeid(*this), "toNecessity", "Could not read necessity texts." };
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
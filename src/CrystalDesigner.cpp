@@ -1,5 +1,8 @@
 #include "CrystalDesigner.h"
 
+#include <algorithm>
+#include <vector>
+
 using namespace MathematicalCrystalChemistry::Design;
 
 
@@ -12,10 +15,21 @@ using namespace MathematicalCrystalChemistry::Design;
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // Constructors
 
+std::unordered_map<CrystalDesigner::StructuralHash, std::unordered_set<CrystalDesigner::StructuralHash, CrystalDesigner::StructuralHash::Hasher>, CrystalDesigner::StructuralHash::Hasher> CrystalDesigner::s_knownTopologies{};
+CrystalDesigner::size_type CrystalDesigner::s_numTopologyLookups{ 0 };
+CrystalDesigner::size_type CrystalDesigner::s_numDuplicateRejections{ 0 };
+std::mutex CrystalDesigner::s_topologyMutex{};
+
+std::atomic<CrystalDesigner::size_type> CrystalDesigner::s_numTriggeredUnitCellReductions{ 0 };
+std::atomic<CrystalDesigner::size_type> CrystalDesigner::s_numAvoidedUnitCellReductions{ 0 };
+
+
+
 CrystalDesigner::CrystalDesigner() noexcept
 	: _maxTotalStructuralOptimizing{ 0 }
 	, _maxCeaselessGlobalStructuralOptimizing{ 0 }
 	, _geometricalConstraintParameters{}
+	, _needEarlyDuplicateRejection{ false }
 	, _randomStructureGenerator{}
 	, _globalStructuralOptimizer{}
 	, _localStructuralOptimizer{}
@@ -24,6 +38,8 @@ CrystalDesigner::CrystalDesigner() noexcept
 	, m_ceaselessGlobalStructuralOptimizing{ 0 }
 	, m_interatomicDistanceTrackerUsing{ 0 }
 	, m_unitCellUsing{ 0 }
+	, m_topologicalHash{}
+	, m_isRejectedAsDuplicate{ false }
 {
 }
 
@@ -31,6 +47,7 @@ CrystalDesigner::CrystalDesigner(const CrystalDesignParameters& parameters)
 	: _maxTotalStructuralOptimizing{ parameters.maxTotalStructuralOptimizing() }
 	, _maxCeaselessGlobalStructuralOptimizing{ parameters.maxCeaselessGlobalStructuralOptimizing() }
 	, _geometricalConstraintParameters{ parameters.geometricalConstraintParameters() }
+	, _needEarlyDuplicateRejection{ parameters.needEarlyDuplicateRejection() }
 	, _randomStructureGenerator{ parameters.initialStructureGenerationParameters().randomStructureGenerationParameters() }
 	, _globalStructuralOptimizer{ parameters.globalStructuralOptimizationParameters(), parameters.geometricalConstraintParameters() }
 	, _localStructuralOptimizer{ parameters.localStructuralOptimizationParameters(), parameters.geometricalConstraintParameters() }
@@ -39,6 +56,8 @@ CrystalDesigner::CrystalDesigner(const CrystalDesignParameters& parameters)
 	, m_ceaselessGlobalStructuralOptimizing{ 0 }
 	, m_interatomicDistanceTrackerUsing{ 0 }
 	, m_unitCellUsing{ 0 }
+	, m_topologicalHash{}
+	, m_isRejectedAsDuplicate{ false }
 {
 }
 
@@ -61,10 +80,14 @@ CrystalDesigner::CrystalDesigner(const CrystalDesignParameters& parameters)
 void CrystalDesigner::execute(ConstrainingCrystalStructure& constrainingCrystalStructure) const
 {
 	initializeTimers();
+	m_isRejectedAsDuplicate = false;
+
 	constrainingCrystalStructure.setFeasibleErrorRate(_globalStructuralOptimizer.structuralOptimizationParameters().feasibleGeometricalConstraintErrorRate());
 	constrainingCrystalStructure.setExclusiveRadiusRatio(_geometricalConstraintParameters.minimumExclusionDistanceRatio());
 	constrainingCrystalStructure.setInteratomicDistanceTracerCutoffRatio(_geometricalConstraintParameters.interatomicDistanceTracerCutoffRatio());
 	constrainingCrystalStructure.setInteratomicDistanceConstrainerCutoffRatio(_geometricalConstraintParameters.interatomicDistanceConstrainerCutoffRatio());
+	constrainingCrystalStructure.setParallelConstrainingAtomThreshold(_geometricalConstraintParameters.parallelConstrainingAtomThreshold());
+	constrainingCrystalStructure.setReductionValidationNecessity(_geometricalConstraintParameters.needReductionValidation());
 	constrainingCrystalStructure.updateTracingIndexPairs();
 	constrainingCrystalStructure.createInteratomicDistanceConstraints();
 	constrainingCrystalStructure.eraseInfeasibleIonicPolyhedraConnections();
@@ -89,6 +112,14 @@ void CrystalDesigner::execute(ConstrainingCrystalStructure& constrainingCrystalS
 
 			if (applyLocalStructuralOptimization(objectiveCrystalStructure))
 			{
+				if (_needEarlyDuplicateRejection && isKnownTopology(constrainingCrystalStructure))
+				{
+					m_isRejectedAsDuplicate = true;
+					initializeTimers();
+
+					return;
+				}
+
 				if (applyPreciseStructuralOptimization(objectiveCrystalStructure))
 				{
 					constrainingCrystalStructure.importStructure(objectiveCrystalStructure);
@@ -97,6 +128,9 @@ void CrystalDesigner::execute(ConstrainingCrystalStructure& constrainingCrystalS
 
 					if (isFeasible(constrainingCrystalStructure))
 					{
+						if (_needEarlyDuplicateRejection)
+							registerTopology(constrainingCrystalStructure);
+
 						initializeTimers();
 						return;
 					}
@@ -148,10 +182,14 @@ void CrystalDesigner::execute(ConstrainingCrystalStructure& constrainingCrystalS
 void CrystalDesigner::execute(ConstrainingCrystalStructure& constrainingCrystalStructure, CrystalDesignRecorder& crystalDesignRecorder) const
 {
 	initializeTimers();
+	m_isRejectedAsDuplicate = false;
+
 	constrainingCrystalStructure.setFeasibleErrorRate(_globalStructuralOptimizer.structuralOptimizationParameters().feasibleGeometricalConstraintErrorRate());
 	constrainingCrystalStructure.setExclusiveRadiusRatio(_geometricalConstraintParameters.minimumExclusionDistanceRatio());
 	constrainingCrystalStructure.setInteratomicDistanceTracerCutoffRatio(_geometricalConstraintParameters.interatomicDistanceTracerCutoffRatio());
 	constrainingCrystalStructure.setInteratomicDistanceConstrainerCutoffRatio(_geometricalConstraintParameters.interatomicDistanceConstrainerCutoffRatio());
+	constrainingCrystalStructure.setParallelConstrainingAtomThreshold(_geometricalConstraintParameters.parallelConstrainingAtomThreshold());
+	constrainingCrystalStructure.setReductionValidationNecessity(_geometricalConstraintParameters.needReductionValidation());
 	constrainingCrystalStructure.updateTracingIndexPairs();
 	constrainingCrystalStructure.createInteratomicDistanceConstraints();
 	constrainingCrystalStructure.eraseInfeasibleIonicPolyhedraConnections();
@@ -179,6 +217,14 @@ void CrystalDesigner::execute(ConstrainingCrystalStructure& constrainingCrystalS
 
 			if (applyLocalStructuralOptimization(objectiveCrystalStructure, crystalDesignRecorder))
 			{
+				if (_needEarlyDuplicateRejection && isKnownTopology(constrainingCrystalStructure))
+				{
+					m_isRejectedAsDuplicate = true;
+					initializeTimers();
+
+					return;
+				}
+
 				if (applyPreciseStructuralOptimization(objectiveCrystalStructure, crystalDesignRecorder))
 				{
 					constrainingCrystalStructure.importStructure(objectiveCrystalStructure);
@@ -187,6 +233,9 @@ void CrystalDesigner::execute(ConstrainingCrystalStructure& constrainingCrystalS
 
 					if (isFeasible(constrainingCrystalStructure))
 					{
+						if (_needEarlyDuplicateRejection)
+							registerTopology(constrainingCrystalStructure);
+
 						initializeTimers();
 						return;
 					}
@@ -235,6 +284,32 @@ void CrystalDesigner::execute(ConstrainingCrystalStructure& constrainingCrystalS
 	initializeTimers();
 }
 
+CrystalDesigner::size_type CrystalDesigner::countTopologyLookups() noexcept
+{
+	std::lock_guard<std::mutex> guard{ s_topologyMutex };
+	return s_numTopologyLookups;
+}
+
+CrystalDesigner::size_type CrystalDesigner::countDuplicateRejections() noexcept
+{
+	std::lock_guard<std::mutex> guard{ s_topologyMutex };
+	return s_numDuplicateRejections;
+}
+
+void CrystalDesigner::initializeDuplicateRejectionStatistics() noexcept
+{
+	std::lock_guard<std::mutex> guard{ s_topologyMutex };
+
+	s_numTopologyLookups = 0;
+	s_numDuplicateRejections = 0;
+}
+
+void CrystalDesigner::initializeUnitCellReductionStatistics() noexcept
+{
+	s_numTriggeredUnitCellReductions = 0;
+	s_numAvoidedUnitCellReductions = 0;
+}
+
 // Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -243,3 +318,73 @@ void CrystalDesigner::execute(ConstrainingCrystalStructure& constrainingCrystalS
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+bool CrystalDesigner::isKnownTopology(const ConstrainingCrystalStructure& constrainingCrystalStructure) const
+{
+	m_topologicalHash = constrainingCrystalStructure.toTopologicalHash();
+	const StructuralHash compositionHash = toCompositionHash(constrainingCrystalStructure);
+
+
+	std::lock_guard<std::mutex> guard{ s_topologyMutex };
+	++s_numTopologyLookups;
+
+	auto iter = s_knownTopologies.find(compositionHash);
+
+	if (!(iter == s_knownTopologies.end()) && !(iter->second.find(m_topologicalHash) == iter->second.end()))
+	{
+		++s_numDuplicateRejections;
+		return true;
+	}
+
+	else
+		return false;
+}
+
+void CrystalDesigner::registerTopology(const ConstrainingCrystalStructure& constrainingCrystalStructure) const
+{
+	const StructuralHash compositionHash = toCompositionHash(constrainingCrystalStructure);
+
+	std::lock_guard<std::mutex> guard{ s_topologyMutex };
+	s_knownTopologies[compositionHash].insert(m_topologicalHash);
+}
+
+CrystalDesigner::StructuralHash CrystalDesigner::toCompositionHash(const ConstrainingCrystalStructure& constrainingCrystalStructure)
+{
+	std::vector<std::uint64_t> ionicAtomicNumbers;
+	{
+		for (const auto& constrainingAtom : constrainingCrystalStructure.atoms())
+		{
+			const std::uint64_t atomicNumber = static_cast<std::uint64_t>(static_cast<unsigned short>(constrainingAtom.ionicAtomicNumber().atomicNumber()));
+			const std::uint64_t formalCharge = static_cast<std::uint64_t>(static_cast<unsigned short>(static_cast<short>(constrainingAtom.ionicAtomicNumber().formalCharge())));
+
+			ionicAtomicNumbers.push_back((atomicNumber << 16) | formalCharge);
+		}
+	}
+
+	std::sort(ionicAtomicNumbers.begin(), ionicAtomicNumbers.end());
+
+
+	StructuralHash compositionHash;
+	{
+		for (const auto& ionicAtomicNumber : ionicAtomicNumbers)
+			compositionHash.add(ionicAtomicNumber);
+	}
+
+	return compositionHash;
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
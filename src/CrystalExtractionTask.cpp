@@ -29,6 +29,8 @@ CrystalExtractionTask::CrystalExtractionTask() noexcept
 	, _outputCrystalsDirectoryPath{}
 	, _spaceGroupPrecision{ s_defaultSpaceGroupPrecision }
 	, _geometricalConstraintParameters{}
+	, _nearDuplicateDetectionParameters{}
+	, _crystalScreeningParameters{}
 	, _crystalOptimalityAnalysisParameters{}
 	, _isotypicCrystalExtractionParameters{}
 	, _promisingCrystalExtractionParameters{}
@@ -90,7 +92,9 @@ void CrystalExtractionTask::initialize() noexcept
 
 	_spaceGroupPrecision = s_defaultSpaceGroupPrecision;
 	_geometricalConstraintParameters.initialize();
+	_nearDuplicateDetectionParameters.initialize();
 
+	_crystalScreeningParameters.initialize();
 	_crystalOptimalityAnalysisParameters.initialize();
 	_isotypicCrystalExtractionParameters.initialize();
 	_promisingCrystalExtractionParameters.initialize();
@@ -127,9 +131,12 @@ void CrystalExtractionTask::initialize(const System::IO::StreamReader& inputStre
 			else
 				_spaceGroupPrecision = s_defaultSpaceGroupPrecision;
 		}
+
+		_nearDuplicateDetectionParameters.initialize(genericStreamReader);
 	}
 
 	_geometricalConstraintParameters.initialize(inputStreamReader.getListBlock("&", "GEOMETRICAL_CONSTRAINTS"));
+	_crystalScreeningParameters.initialize(inputStreamReader);
 	_crystalOptimalityAnalysisParameters.initialize(inputStreamReader);
 	_isotypicCrystalExtractionParameters.initialize(inputStreamReader);
 	_promisingCrystalExtractionParameters.initialize(inputStreamReader);
@@ -1,10 +1,22 @@
 #include "CrystalExtractor.h"
 
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
 #include <vector>
 #include <thread>
 
+#include <mpi.h>
+
+#include "MpiPolicy.h"
 #include "ThreadingPolicy.h"
+#include "DistributedWorkCounter.h"
+#include "BoundedConcurrentQueue.h"
+#include "StreamWriter.h"
+
+#include "SpaceGroupTypeSearcher.h"
 
+#include "EnumerateCifFiles.h"
 #include "ExtractCrystals.h"
 
 using namespace MathematicalCrystalChemistry::Extraction;
@@ -47,24 +59,74 @@ CrystalExtractor::CrystalExtractor(const CrystalExtractionTask& task) noexcept
 
 void CrystalExtractor::execute() const
 {
-	std::vector<Internal::ExtractCrystals> crystalAnalyzers;
+	Internal::ExtractCrystals::initializeExtractionStatistics();
+	Internal::ExtractionFilterPipeline::initializeTotalStatistics();
+	ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::initializeToleranceStatistics();
+
+	// The work counter is released before the reductions below, so that its progress thread on rank 0 no longer calls MPI concurrently with them.
 	{
-		for (std::size_t threadRank = 0; threadRank < System::Parallel::ThreadingPolicy::maxThreading(); ++threadRank)
+		constexpr std::size_t numQueuedFilesPerThread = 8;
+
+		System::Parallel::DistributedWorkCounter workCounter;
+		System::Parallel::BoundedConcurrentQueue<std::filesystem::path> cifFileQueue{ numQueuedFilesPerThread * System::Parallel::ThreadingPolicy::maxThreading() };
+
+		Internal::EnumerateCifFiles cifFileEnumerator;
+		{
+			cifFileEnumerator.setCrystalExtractionTask(_crystalExtractionTask);
+			cifFileEnumerator.setWorkCounter(workCounter);
+			cifFileEnumerator.setCifFileQueue(cifFileQueue);
+		}
+
+		std::vector<Internal::ExtractCrystals> crystalAnalyzers;
+		{
+			for (std::size_t threadRank = 0; threadRank < System::Parallel::ThreadingPolicy::maxThreading(); ++threadRank)
+			{
+				crystalAnalyzers.push_back(Internal::ExtractCrystals{ threadRank });
+				crystalAnalyzers.back().setCrystalExtractionTask(_crystalExtractionTask);
+				crystalAnalyzers.back().setCifFileQueue(cifFileQueue);
+			}
+		}
+
+		std::thread enumeratingSystem{ cifFileEnumerator };
+
+		std::vector<std::thread> operatingSystems;
 		{
-			crystalAnalyzers.push_back(Internal::ExtractCrystals{ threadRank });
-			crystalAnalyzers.back().setCrystalExtractionTask(_crystalExtractionTask);
+			for (std::size_t threadRank = 0; threadRank < System::Parallel::ThreadingPolicy::maxThreading(); ++threadRank)
+				operatingSystems.push_back(std::thread{ crystalAnalyzers[threadRank] });
 		}
+
+
+		enumeratingSystem.join();
+
+		for (auto& operatingSystem : operatingSystems)
+			operatingSystem.join();
 	}
 
-	std::vector<std::thread> operatingSystems;
+	reduceExtractionStatistics();
+	std::string lockStatisticsReport = reduceOutputDirectoryLockStatistics();
+
+
+	if (System::Parallel::MpiPolicy::mpiRank() == 0)
 	{
-		for (std::size_t threadRank = 0; threadRank < System::Parallel::ThreadingPolicy::maxThreading(); ++threadRank)
-			operatingSystems.push_back(std::thread{ crystalAnalyzers[threadRank] });
-	}
+		std::cout << Internal::ExtractCrystals::countProcessedFiles() << " CIF files were processed." << std::endl;
+		std::cout << Internal::ExtractionFilterPipeline::toStatisticsReport();
 
+		if (0 < Internal::ExtractCrystals::countNearDuplicates())
+			std::cout << Internal::ExtractCrystals::countNearDuplicates() << " near-duplicate structures were flagged." << std::endl;
 
-	for (auto& operatingSystem : operatingSystems)
-		operatingSystem.join();
+		if (0 < ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::countToleranceSearches())
+		{
+			System::IO::StreamWriter streamWriter;
+			streamWriter.write(ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::getMeanToleranceTrials(), 2);
+
+			System::IO::StreamWriter ladderStreamWriter;
+			ladderStreamWriter.write(ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::getMeanLadderTrials(), 2);
+
+			std::cout << streamWriter.allTexts() << " spglib trials per symmetry search (" << ladderStreamWriter.allTexts() << " with the sequential tolerance ladder, " << ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::countToleranceSearches() << " searches)." << std::endl;
+		}
+
+		std::cout << lockStatisticsReport;
+	}
 }
 
 // Methods
@@ -75,3 +137,95 @@ void CrystalExtractor::execute() const
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+void CrystalExtractor::reduceExtractionStatistics() const
+{
+	using Internal::ExtractionFilterPipeline;
+
+	const std::size_t numFilterStages = ExtractionFilterPipeline::countFilterStages();
+
+	std::vector<unsigned long long> localCounts;
+	std::vector<std::int64_t> localElapsedNanoseconds;
+	{
+		for (std::size_t stageIndex = 0; stageIndex < numFilterStages; ++stageIndex)
+		{
+			const ExtractionFilterPipeline::FilterStatistics statistics = ExtractionFilterPipeline::getTotalStatistics(static_cast<ExtractionFilterPipeline::FilterStage>(stageIndex));
+
+			localCounts.push_back(statistics.numAccepted);
+			localCounts.push_back(statistics.numRejected);
+			localElapsedNanoseconds.push_back(statistics.elapsedNanoseconds);
+		}
+
+		localCounts.push_back(Internal::ExtractCrystals::countProcessedFiles());
+		localCounts.push_back(Internal::ExtractCrystals::countNearDuplicates());
+		localCounts.push_back(ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::countToleranceSearches());
+		localCounts.push_back(ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::countToleranceTrials());
+		localCounts.push_back(ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::countLadderTrials());
+	}
+
+
+	std::vector<unsigned long long> totalCounts(localCounts.size(), 0);
+	std::vector<std::int64_t> totalElapsedNanoseconds(localElapsedNanoseconds.size(), 0);
+	{
+		MPI_Reduce(localCounts.data(), totalCounts.data(), static_cast<int>(localCounts.size()), MPI_UNSIGNED_LONG_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
+		MPI_Reduce(localElapsedNanoseconds.data(), totalElapsedNanoseconds.data(), static_cast<int>(localElapsedNanoseconds.size()), MPI_INT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+	}
+
+	if (System::Parallel::MpiPolicy::mpiRank() == 0)
+	{
+		for (std::size_t stageIndex = 0; stageIndex < numFilterStages; ++stageIndex)
+		{
+			const ExtractionFilterPipeline::FilterStatistics statistics{ totalCounts[2 * stageIndex], totalCounts[(2 * stageIndex) + 1], totalElapsedNanoseconds[stageIndex] };
+			ExtractionFilterPipeline::setTotalStatistics(static_cast<ExtractionFilterPipeline::FilterStage>(stageIndex), statistics);
+		}
+
+		Internal::ExtractCrystals::setExtractionStatistics(totalCounts[2 * numFilterStages], totalCounts[(2 * numFilterStages) + 1]);
+		ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::setToleranceStatistics(totalCounts[(2 * numFilterStages) + 2], totalCounts[(2 * numFilterStages) + 3], totalCounts[(2 * numFilterStages) + 4]);
+	}
+}
+
+std::string CrystalExtractor::reduceOutputDirectoryLockStatistics() const
+{
+	const System::Parallel::ShardedMutexTable& outputDirectoryLocks = Internal::ExtractCrystals::outputDirectoryLocks();
+
+	unsigned long long localCounts[2] = { outputDirectoryLocks.countAcquisitions(), outputDirectoryLocks.countContentions() };
+	double localContentionSeconds = outputDirectoryLocks.contentionSeconds();
+
+	unsigned long long totalCounts[2] = { 0, 0 };
+	double totalContentionSeconds = 0.0;
+	{
+		MPI_Reduce(localCounts, totalCounts, 2, MPI_UNSIGNED_LONG_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
+		MPI_Reduce(&localContentionSeconds, &totalContentionSeconds, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+	}
+
+
+	System::IO::StreamWriter streamWriter;
+
+	if ((System::Parallel::MpiPolicy::mpiRank() == 0) && (0 < totalCounts[0]))
+	{
+		streamWriter.write(static_cast<std::size_t>(totalCounts[1]));
+		streamWriter.write(" of ");
+		streamWriter.write(static_cast<std::size_t>(totalCounts[0]));
+		streamWriter.write(" output directory locks were contended (");
+		streamWriter.write(totalContentionSeconds, 3);
+		streamWriter.writeLine(" s waiting).");
+	}
+
+	return streamWriter.allTexts();
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -20,6 +20,9 @@
 #include "ConstrainingCrystalStructure.h"
 #include "OptimalCrystalStructure.h"
 
+#include "ConstrainingSpeciesDictionary.h"
+#include "SpaceGroupTypeSearcher.h"
+#include "SymmetryDatasetCache.h"
 #include "FeasiblePolyhedraConnectionsDictionary.h"
 
 using namespace MathematicalCrystalChemistry::Prediction;
@@ -120,6 +123,15 @@ void CrystalPredictor::ProduceCrystals::operator()()
 					else
 						_crystalDesigner.execute(constrainingCrystalStructure);
 				}
+
+				if (_crystalDesigner.isRejectedAsDuplicate())
+				{
+					if (System::IO::Directory::exist(producedDirectoryPath))
+						System::IO::Directory::deleteDirectory(producedDirectoryPath);
+
+					continue;
+				}
+
 				constrainingCrystalStructure.setFeasibleErrorRate(_crystalDesigner.preciseStructuralOptimizationParameters().feasibleGeometricalConstraintErrorRate());
 
 
@@ -225,9 +237,16 @@ void CrystalPredictor::execute() const
 		for (const auto& compositionAndGenerating : _crystalPredictionTask.crystalDesignRequest())
 		{
 			ProduceCrystals::initializeStructureProducing();
+			CrystalDesigner::initializeDuplicateRejectionStatistics();
+			CrystalDesigner::initializeUnitCellReductionStatistics();
+			CrystalProductionReporter::initializeNearDuplicateStatistics();
+			CrystalProductionReporter::initializeOutputDirectoryLockStatistics();
+			ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::initializeToleranceStatistics();
+			ChemToolkit::Crystallography::Symmetry::SymmetryDatasetCache::initializeStatistics();
 			ProduceCrystals::setMaxStructureProducing(getMaxCrystalProducing(compositionAndGenerating.second));
 			ProduceCrystals::setChemicalComposition(compositionAndGenerating.first);
 
+			MathematicalCrystalChemistry::CrystalModel::Constraints::ConstrainingSpeciesDictionary::initialize(compositionAndGenerating.first);
 			MathematicalCrystalChemistry::CrystalModel::Constraints::FeasiblePolyhedraConnectionsDictionary::initialize(compositionAndGenerating.first);
 
 
@@ -492,6 +511,69 @@ void CrystalPredictor::reportJobFinalization(const ChemicalComposition& chemical
 		message += std::to_string(structureGenerating);
 		message += " generating of ";
 		message += chemicalComposition.toString();
+
+		if (0 < CrystalDesigner::countTopologyLookups())
+		{
+			message += " (";
+			message += std::to_string(CrystalDesigner::countDuplicateRejections());
+			message += " of ";
+			message += std::to_string(CrystalDesigner::countTopologyLookups());
+			message += " topology lookups rejected as duplicates)";
+		}
+
+		if (0 < (CrystalDesigner::countTriggeredUnitCellReductions() + CrystalDesigner::countAvoidedUnitCellReductions()))
+		{
+			message += " (";
+			message += std::to_string(CrystalDesigner::countTriggeredUnitCellReductions());
+			message += " unit cell reductions on skewed cells, ";
+			message += std::to_string(CrystalDesigner::countAvoidedUnitCellReductions());
+			message += " periodic reductions avoided)";
+		}
+
+		if (0 < CrystalProductionReporter::countNearDuplicateMerges())
+		{
+			message += " (";
+			message += std::to_string(CrystalProductionReporter::countNearDuplicateMerges());
+			message += " near-duplicate structures merged)";
+		}
+
+		if (0 < ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::countToleranceSearches())
+		{
+			System::IO::StreamWriter streamWriter;
+			streamWriter.write(ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::getMeanToleranceTrials(), 2);
+
+			System::IO::StreamWriter ladderStreamWriter;
+			ladderStreamWriter.write(ChemToolkit::Crystallography::Symmetry::SpaceGroupTypeSearcher::getMeanLadderTrials(), 2);
+
+			message += " (";
+			message += streamWriter.allTexts();
+			message += " spglib trials per symmetry search, ";
+			message += ladderStreamWriter.allTexts();
+			message += " with the sequential tolerance ladder)";
+		}
+
+		if (0 < CrystalProductionReporter::outputDirectoryLocks().countContentions())
+		{
+			System::IO::StreamWriter streamWriter;
+			streamWriter.write(CrystalProductionReporter::outputDirectoryLocks().contentionSeconds(), 3);
+
+			message += " (";
+			message += std::to_string(CrystalProductionReporter::outputDirectoryLocks().countContentions());
+			message += " of ";
+			message += std::to_string(CrystalProductionReporter::outputDirectoryLocks().countAcquisitions());
+			message += " output directory locks contended, ";
+			message += streamWriter.allTexts();
+			message += " s waiting)";
+		}
+
+		if (0 < (ChemToolkit::Crystallography::Symmetry::SymmetryDatasetCache::countHits() + ChemToolkit::Crystallography::Symmetry::SymmetryDatasetCache::countMisses()))
+		{
+			message += " (";
+			message += std::to_string(ChemToolkit::Crystallography::Symmetry::SymmetryDatasetCache::countHits());
+			message += " of ";
+			message += std::to_string(ChemToolkit::Crystallography::Symmetry::SymmetryDatasetCache::countHits() + ChemToolkit::Crystallography::Symmetry::SymmetryDatasetCache::countMisses());
+			message += " symmetry datasets served from the cache)";
+		}
 	}
 
 
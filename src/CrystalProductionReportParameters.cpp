@@ -26,6 +26,7 @@ CrystalProductionReportParameters::CrystalProductionReportParameters() noexcept
 	, _needExceptionalCrystalData{ false }
 	, _spaceGroupPrecision{ s_defaultSpaceGroupPrecision }
 	, _crystalDesignRecordParameters{}
+	, _nearDuplicateDetectionParameters{}
 {
 }
 
@@ -54,6 +55,7 @@ void CrystalProductionReportParameters::initialize() noexcept
 
 	_spaceGroupPrecision = s_defaultSpaceGroupPrecision;
 	_crystalDesignRecordParameters.initialize();
+	_nearDuplicateDetectionParameters.initialize();
 }
 
 void CrystalProductionReportParameters::initialize(const System::IO::StreamReader& inputStreamReader)
@@ -98,6 +100,7 @@ void CrystalProductionReportParameters::initialize(const System::IO::StreamReade
 	}
 
 	_crystalDesignRecordParameters.initialize(streamReader);
+	_nearDuplicateDetectionParameters.initialize(streamReader);
 
 
 	validateInitializedValues();
@@ -1,8 +1,11 @@
 #include "CrystalProductionReporter.h"
 
+#include <numeric>
+
 #include "Directory.h"
 #include "DirectoryNotFoundException.h"
 #include "FileStream.h"
+#include "IOException.h"
 #include "InvalidFileException.h"
 
 #include "CrystallographicInformation.h"
@@ -20,8 +23,15 @@ using namespace MathematicalCrystalChemistry::Design::Diagnostics;
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // Constructors
 
-std::mutex CrystalProductionReporter::s_reportMutex;
+System::Parallel::ShardedMutexTable CrystalProductionReporter::s_outputDirectoryLocks;
 std::string CrystalProductionReporter::s_fingerprintFilename{ "fingerprint.txt" };
+std::string CrystalProductionReporter::s_descriptorFilename{ "descriptor.txt" };
+
+std::unordered_map<std::string, CrystalProductionReporter::FingerprintIndex> CrystalProductionReporter::s_fingerprintIndices{};
+std::unordered_map<std::string, CrystalProductionReporter::DescriptorIndex> CrystalProductionReporter::s_descriptorIndices{};
+std::shared_mutex CrystalProductionReporter::s_fingerprintIndexMutex{};
+
+std::atomic<CrystalProductionReporter::size_type> CrystalProductionReporter::s_numNearDuplicateMerges{ 0 };
 
 
 
@@ -103,6 +113,10 @@ void CrystalProductionReporter::setCrystalProductionReportParameters(const Cryst
 
 void CrystalProductionReporter::outputFeasibleCrystalStructure(const OptimalCrystalStructure& optimalCrystalStructure) const
 {
+	if (!(_crystalProductionReportParameters.needPiSymmetryCrystalData()) && optimalCrystalStructure.hasTrivialSymmetry(_crystalProductionReportParameters.spaceGroupPrecision()))
+		return;
+
+
 	OptimalCrystalStructure conventionalStructure = optimalCrystalStructure;
 	conventionalStructure.conventionalizeStructure(_crystalProductionReportParameters.spaceGroupPrecision());
 	{
@@ -112,10 +126,17 @@ void CrystalProductionReporter::outputFeasibleCrystalStructure(const OptimalCrys
 		else
 		{
 			std::string structureFingerprint = conventionalStructure.toStructuralFingerprint();
+			StructuralDescriptor structuralDescriptor = toStructuralDescriptor(conventionalStructure);
 			std::filesystem::path spaceGroupDirectoryPath = getSpaceGroupDirectoryPath(conventionalStructure.spaceGroupNumber(), optimalCrystalStructure.toChemicalComposition());
 
+			if (!(findIndexedDirectoryPath(structureFingerprint, spaceGroupDirectoryPath).first))
+				return;
+
+
 			constexpr size_type maxRepetitionCount = 50;
-			std::lock_guard<std::mutex> guard{ s_reportMutex };
+			std::unique_lock<std::mutex> guard = s_outputDirectoryLocks.lock(spaceGroupDirectoryPath.generic_string());
+
+			System::IO::Directory::createDirectories(spaceGroupDirectoryPath, System::IO::Directory::CreateOptions::skip_existing);
 
 
 			for (size_type rep = 0; rep < maxRepetitionCount; ++rep)
@@ -123,21 +144,52 @@ void CrystalProductionReporter::outputFeasibleCrystalStructure(const OptimalCrys
 				try
 				{
 					auto stateAndDirectory = getOutputDirectoryPath(structureFingerprint, spaceGroupDirectoryPath);
+					bool isNearDuplicate = false;
+					{
+						if (stateAndDirectory.first && !(structuralDescriptor.isEmpty()))
+						{
+							auto nearDuplicateAndDirectory = findNearDuplicateDirectoryPath(structuralDescriptor, spaceGroupDirectoryPath);
+
+							if (nearDuplicateAndDirectory.first)
+							{
+								stateAndDirectory = std::make_pair(false, nearDuplicateAndDirectory.second);
+								isNearDuplicate = true;
+							}
+						}
+					}
 
 					if (stateAndDirectory.first)
 					{
-						System::IO::Directory::createDirectory(stateAndDirectory.second, System::IO::Directory::CreateOptions::none);
+						createOutputDirectory(stateAndDirectory.second, spaceGroupDirectoryPath);
 						outputFeasibleCrystallographicData(conventionalStructure, optimalCrystalStructure, stateAndDirectory.second);
 
 
+						if (!(structuralDescriptor.isEmpty()))
+						{
+							std::filesystem::path descriptorFilePath = stateAndDirectory.second;
+							descriptorFilePath /= s_descriptorFilename;
+
+							System::IO::FileStream descriptorStreamWriter{ descriptorFilePath, System::IO::FileStream::FileMode::createNew };
+							descriptorStreamWriter.write(structuralDescriptor.toString());
+						}
+
+
 						std::filesystem::path fingerprintFilePath = stateAndDirectory.second;
 						fingerprintFilePath /= s_fingerprintFilename;
 
 						System::IO::FileStream fingerprintStreamWriter{ fingerprintFilePath, System::IO::FileStream::FileMode::createNew };
 						fingerprintStreamWriter.write(structureFingerprint);
+
+						registerFingerprint(structureFingerprint, structuralDescriptor, spaceGroupDirectoryPath, stateAndDirectory.second);
 					}
 
 
+					if (isNearDuplicate)
+					{
+						registerMergedFingerprint(structureFingerprint, spaceGroupDirectoryPath, stateAndDirectory.second);
+						++s_numNearDuplicateMerges;
+					}
+
 					break;
 				}
 
@@ -155,6 +207,10 @@ void CrystalProductionReporter::outputFeasibleCrystalStructure(const OptimalCrys
 
 void CrystalProductionReporter::outputFeasibleCrystalStructure(const OptimalCrystalStructure& optimalCrystalStructure, const std::filesystem::path& producedDirectoryPath) const
 {
+	if (!(_crystalProductionReportParameters.needPiSymmetryCrystalData()) && optimalCrystalStructure.hasTrivialSymmetry(_crystalProductionReportParameters.spaceGroupPrecision()))
+		return;
+
+
 	OptimalCrystalStructure conventionalStructure = optimalCrystalStructure;
 	conventionalStructure.conventionalizeStructure(_crystalProductionReportParameters.spaceGroupPrecision());
 	{
@@ -164,10 +220,13 @@ void CrystalProductionReporter::outputFeasibleCrystalStructure(const OptimalCrys
 		else
 		{
 			std::string structureFingerprint = conventionalStructure.toStructuralFingerprint();
+			StructuralDescriptor structuralDescriptor = toStructuralDescriptor(conventionalStructure);
 			std::filesystem::path spaceGroupDirectoryPath = getSpaceGroupDirectoryPath(conventionalStructure.spaceGroupNumber(), optimalCrystalStructure.toChemicalComposition());
 
 			const size_type maxRepetitionCount = 50;
-			std::lock_guard<std::mutex> guard{ s_reportMutex };
+			std::unique_lock<std::mutex> guard = s_outputDirectoryLocks.lock(spaceGroupDirectoryPath.generic_string());
+
+			System::IO::Directory::createDirectories(spaceGroupDirectoryPath, System::IO::Directory::CreateOptions::skip_existing);
 
 
 			for (size_type rep = 0; rep < maxRepetitionCount; ++rep)
@@ -175,19 +234,44 @@ void CrystalProductionReporter::outputFeasibleCrystalStructure(const OptimalCrys
 				try
 				{
 					auto stateAndDirectory = getOutputDirectoryPath(structureFingerprint, spaceGroupDirectoryPath);
+					bool isNearDuplicate = false;
+					{
+						if (stateAndDirectory.first && !(structuralDescriptor.isEmpty()))
+						{
+							auto nearDuplicateAndDirectory = findNearDuplicateDirectoryPath(structuralDescriptor, spaceGroupDirectoryPath);
+
+							if (nearDuplicateAndDirectory.first)
+							{
+								stateAndDirectory = std::make_pair(false, nearDuplicateAndDirectory.second);
+								isNearDuplicate = true;
+							}
+						}
+					}
 
 					if (stateAndDirectory.first)
 					{
-						System::IO::Directory::createDirectory(stateAndDirectory.second, System::IO::Directory::CreateOptions::none);
+						createOutputDirectory(stateAndDirectory.second, spaceGroupDirectoryPath);
 						outputFeasibleCrystallographicData(conventionalStructure, optimalCrystalStructure, stateAndDirectory.second);
 
 
+						if (!(structuralDescriptor.isEmpty()))
+						{
+							std::filesystem::path descriptorFilePath = stateAndDirectory.second;
+							descriptorFilePath /= s_descriptorFilename;
+
+							System::IO::FileStream descriptorStreamWriter{ descriptorFilePath, System::IO::FileStream::FileMode::createNew };
+							descriptorStreamWriter.write(structuralDescriptor.toString());
+						}
+
+
 						std::filesystem::path fingerprintFilePath = stateAndDirectory.second;
 						fingerprintFilePath /= s_fingerprintFilename;
 
 						System::IO::FileStream fingerprintStreamWriter{ fingerprintFilePath, System::IO::FileStream::FileMode::createNew };
 						fingerprintStreamWriter.write(structureFingerprint);
 
+						registerFingerprint(structureFingerprint, structuralDescriptor, spaceGroupDirectoryPath, stateAndDirectory.second);
+
 
 						std::filesystem::path productionReportDirectoryPath = stateAndDirectory.second;
 						productionReportDirectoryPath /= getDirectoryName(producedDirectoryPath);
@@ -202,6 +286,12 @@ void CrystalProductionReporter::outputFeasibleCrystalStructure(const OptimalCrys
 					}
 
 
+					if (isNearDuplicate)
+					{
+						registerMergedFingerprint(structureFingerprint, spaceGroupDirectoryPath, stateAndDirectory.second);
+						++s_numNearDuplicateMerges;
+					}
+
 					break;
 				}
 
@@ -230,7 +320,7 @@ void CrystalProductionReporter::outputInfeasibleCrystalStructure(const OptimalCr
 		outputDirectoryPath /= productionName;
 
 
-		std::lock_guard<std::mutex> guard{ s_reportMutex };
+		std::unique_lock<std::mutex> guard = s_outputDirectoryLocks.lock(outputDirectoryPath.parent_path().generic_string());
 		System::IO::Directory::createDirectories(outputDirectoryPath, System::IO::Directory::CreateOptions::overwrite_existing);
 
 		outputInfeasibleCrystallographicData(optimalCrystalStructure, outputDirectoryPath);
@@ -249,7 +339,7 @@ void CrystalProductionReporter::outputInfeasibleCrystalStructure(const OptimalCr
 		outputDirectoryPath /= chemicalComposition.toString();
 
 
-		std::lock_guard<std::mutex> guard{ s_reportMutex };
+		std::unique_lock<std::mutex> guard = s_outputDirectoryLocks.lock(outputDirectoryPath.generic_string());
 		System::IO::Directory::createDirectories(outputDirectoryPath, System::IO::Directory::CreateOptions::skip_existing);
 
 		outputDirectoryPath /= getDirectoryName(producedDirectoryPath);
@@ -273,7 +363,7 @@ void CrystalProductionReporter::outputExceptionalCrystalStructure(const OptimalC
 		outputDirectoryPath /= chemicalComposition.toChemicalSystem().toString();
 		outputDirectoryPath /= chemicalComposition.toString();
 
-		std::lock_guard<std::mutex> guard{ s_reportMutex };
+		std::unique_lock<std::mutex> guard = s_outputDirectoryLocks.lock(outputDirectoryPath.generic_string());
 		System::IO::Directory::createDirectories(outputDirectoryPath, System::IO::Directory::CreateOptions::skip_existing);
 
 		outputDirectoryPath /= productionName;
@@ -294,7 +384,7 @@ void CrystalProductionReporter::outputExceptionalCrystalStructure(const OptimalC
 		outputDirectoryPath /= chemicalComposition.toChemicalSystem().toString();
 		outputDirectoryPath /= chemicalComposition.toString();
 
-		std::lock_guard<std::mutex> guard{ s_reportMutex };
+		std::unique_lock<std::mutex> guard = s_outputDirectoryLocks.lock(outputDirectoryPath.generic_string());
 		System::IO::Directory::createDirectories(outputDirectoryPath, System::IO::Directory::CreateOptions::skip_existing);
 
 		outputDirectoryPath /= getDirectoryName(producedDirectoryPath);
@@ -311,6 +401,26 @@ void CrystalProductionReporter::outputExceptionalCrystalStructure(const OptimalC
 	}
 }
 
+const System::Parallel::ShardedMutexTable& CrystalProductionReporter::outputDirectoryLocks() noexcept
+{
+	return s_outputDirectoryLocks;
+}
+
+CrystalProductionReporter::size_type CrystalProductionReporter::countNearDuplicateMerges() noexcept
+{
+	return s_numNearDuplicateMerges.load();
+}
+
+void CrystalProductionReporter::initializeNearDuplicateStatistics() noexcept
+{
+	s_numNearDuplicateMerges = 0;
+}
+
+void CrystalProductionReporter::initializeOutputDirectoryLockStatistics() noexcept
+{
+	s_outputDirectoryLocks.resetStatistics();
+}
+
 // Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -336,47 +446,293 @@ std::filesystem::path CrystalProductionReporter::getSpaceGroupDirectoryPath(cons
 		spaceGroupDirectoryPath /= composition.toString();
 		spaceGroupDirectoryPath /= "SpaceGroup-";
 		spaceGroupDirectoryPath += std::to_string(spaceGroupNumber);
-
-		System::IO::Directory::createDirectories(spaceGroupDirectoryPath, System::IO::Directory::CreateOptions::skip_existing);
 	}
 
 	return spaceGroupDirectoryPath;
 }
 
 std::pair<bool, std::filesystem::path> CrystalProductionReporter::getOutputDirectoryPath(const std::string& outputFingerprint, const std::filesystem::path& spaceGroupPath) const
+{
+	auto stateAndDirectory = findIndexedDirectoryPath(outputFingerprint, spaceGroupPath);
+
+	// Other ranks write into the same space group directory, so a miss first reads the Type directories not indexed yet.
+	if (stateAndDirectory.first)
+	{
+		indexFingerprints(spaceGroupPath);
+		stateAndDirectory = findIndexedDirectoryPath(outputFingerprint, spaceGroupPath);
+	}
+
+	return stateAndDirectory;
+}
+
+std::pair<bool, std::filesystem::path> CrystalProductionReporter::findIndexedDirectoryPath(const std::string& outputFingerprint, const std::filesystem::path& spaceGroupPath) const
 {
 	size_type numDirectory = 1;
 	{
-		for (const auto& directoryPath : System::IO::Directory::enumerateDirectories(spaceGroupPath))
+		std::shared_lock<std::shared_mutex> guard{ s_fingerprintIndexMutex };
+		auto indexIter = s_fingerprintIndices.find(spaceGroupPath.generic_string());
+
+		if (!(indexIter == s_fingerprintIndices.end()))
+		{
+			auto iter = indexIter->second.fingerprintAndDirectory.find(outputFingerprint);
+
+			if (!(iter == indexIter->second.fingerprintAndDirectory.end()))
+				return std::make_pair(false, iter->second);
+			else
+				numDirectory += indexIter->second.indexedDirectoryNames.size();
+		}
+	}
+
+
+	std::filesystem::path outputDirectoryPath = spaceGroupPath;
+	outputDirectoryPath /= "Type-";
+	outputDirectoryPath += std::to_string(numDirectory);
+
+	return std::make_pair(true, outputDirectoryPath);
+}
+
+std::pair<bool, std::filesystem::path> CrystalProductionReporter::findNearDuplicateDirectoryPath(const StructuralDescriptor& structuralDescriptor, const std::filesystem::path& spaceGroupPath) const
+{
+	indexDescriptors(spaceGroupPath);
+
+
+	std::shared_lock<std::shared_mutex> guard{ s_fingerprintIndexMutex };
+	auto indexIter = s_descriptorIndices.find(getDescriptorIndexKey(spaceGroupPath));
+
+	if (!(indexIter == s_descriptorIndices.end()))
+	{
+		auto stateAndIndex = indexIter->second.descriptorIndex.findMostSimilar(structuralDescriptor, _crystalProductionReportParameters.nearDuplicateDetectionParameters().similarityThreshold());
+
+		if (stateAndIndex.first)
+			return std::make_pair(true, indexIter->second.descriptorDirectories[stateAndIndex.second]);
+	}
+
+	return std::make_pair(false, std::filesystem::path{});
+}
+
+void CrystalProductionReporter::indexFingerprints(const std::filesystem::path& spaceGroupPath) const
+{
+	std::unordered_set<std::string> indexedDirectoryNames;
+	{
+		std::shared_lock<std::shared_mutex> guard{ s_fingerprintIndexMutex };
+		auto indexIter = s_fingerprintIndices.find(spaceGroupPath.generic_string());
+
+		if (!(indexIter == s_fingerprintIndices.end()))
+			indexedDirectoryNames = indexIter->second.indexedDirectoryNames;
+	}
+
+
+	std::vector<std::pair<std::string, std::filesystem::path>> fingerprintAndDirectories;
+
+	for (const auto& directoryPath : System::IO::Directory::enumerateDirectories(spaceGroupPath))
+	{
+		if (indexedDirectoryNames.find(getDirectoryName(directoryPath)) == indexedDirectoryNames.end())
 		{
 			std::vector<std::filesystem::path> fingerprintFilePaths = System::IO::Directory::enumerateFiles(directoryPath, s_fingerprintFilename);
 
 
 			if (fingerprintFilePaths.empty())
-				throw System::IO::FileNotFoundException{ typeid(*this), "getStructureIndex", "Could not find fingerprint file." };
+				throw System::IO::FileNotFoundException{ typeid(*this), "indexFingerprints", "Could not find fingerprint file." };
 
 			else if (1 < fingerprintFilePaths.size())
-				throw System::IO::InvalidFileException{ typeid(*this), "getStructureIndex", "There are multiple fingerprint files." };
+				throw System::IO::InvalidFileException{ typeid(*this), "indexFingerprints", "There are multiple fingerprint files." };
 
 			else
 			{
 				System::IO::FileStream fingerprintStreamReader{ fingerprintFilePaths.back(), System::IO::FileStream::FileMode::openRead };
+				fingerprintAndDirectories.emplace_back(fingerprintStreamReader.readAllTexts(), directoryPath);
+			}
+		}
+	}
+
 
+	std::lock_guard<std::shared_mutex> guard{ s_fingerprintIndexMutex };
+	FingerprintIndex& fingerprintIndex = s_fingerprintIndices[spaceGroupPath.generic_string()];
 
-				if (outputFingerprint == fingerprintStreamReader.readAllTexts())
-					return std::make_pair(false, directoryPath);
-				else
-					++numDirectory;
+	for (auto& fingerprintAndDirectory : fingerprintAndDirectories)
+	{
+		fingerprintIndex.indexedDirectoryNames.insert(getDirectoryName(fingerprintAndDirectory.second));
+		fingerprintIndex.fingerprintAndDirectory.insert_or_assign(std::move(fingerprintAndDirectory.first), std::move(fingerprintAndDirectory.second));
+	}
+}
+
+void CrystalProductionReporter::indexDescriptors(const std::filesystem::path& spaceGroupPath) const
+{
+	const std::string descriptorIndexKey = getDescriptorIndexKey(spaceGroupPath);
+
+	std::unordered_set<std::string> indexedDirectoryPaths;
+	{
+		std::shared_lock<std::shared_mutex> guard{ s_fingerprintIndexMutex };
+		auto indexIter = s_descriptorIndices.find(descriptorIndexKey);
+
+		if (!(indexIter == s_descriptorIndices.end()))
+			indexedDirectoryPaths = indexIter->second.indexedDirectoryPaths;
+	}
+
+
+	std::vector<std::pair<StructuralDescriptor, std::filesystem::path>> descriptorAndDirectories;
+	std::vector<std::filesystem::path> directoryPaths;
+
+	// A small distortion can change the space group that spglib assigns, and the cell composition is not reduced,
+	// so every space group of every composition with the same reduced composition is searched.
+	const std::filesystem::path compositionPath = spaceGroupPath.parent_path();
+	const std::string reducedCompositionName = toReducedCompositionName(getDirectoryName(compositionPath));
+
+	for (const auto& siblingCompositionPath : System::IO::Directory::enumerateDirectories(compositionPath.parent_path()))
+	{
+		if (!(toReducedCompositionName(getDirectoryName(siblingCompositionPath)) == reducedCompositionName))
+			continue;
+
+		for (const auto& siblingSpaceGroupPath : System::IO::Directory::enumerateDirectories(siblingCompositionPath, "SpaceGroup-([[:digit:]]+)"))
+		{
+			for (const auto& directoryPath : System::IO::Directory::enumerateDirectories(siblingSpaceGroupPath))
+			{
+				if (indexedDirectoryPaths.find(directoryPath.generic_string()) == indexedDirectoryPaths.end())
+				{
+					// The fingerprint file is written after the descriptor file, so a directory without one is still being filled and is read next time.
+					if (System::IO::Directory::enumerateFiles(directoryPath, s_fingerprintFilename).empty())
+						continue;
+
+
+					std::vector<std::filesystem::path> descriptorFilePaths = System::IO::Directory::enumerateFiles(directoryPath, s_descriptorFilename);
+
+					if (1 == descriptorFilePaths.size())
+					{
+						System::IO::FileStream descriptorStreamReader{ descriptorFilePaths.back(), System::IO::FileStream::FileMode::openRead };
+						descriptorAndDirectories.emplace_back(StructuralDescriptor{ descriptorStreamReader.readAllTexts() }, directoryPath);
+					}
+
+					else
+						directoryPaths.push_back(directoryPath);
+				}
 			}
 		}
 	}
 
 
-	std::filesystem::path outputDirectoryPath = spaceGroupPath;
-	outputDirectoryPath /= "Type-";
-	outputDirectoryPath += std::to_string(numDirectory);
+	std::lock_guard<std::shared_mutex> guard{ s_fingerprintIndexMutex };
+	DescriptorIndex& descriptorIndex = s_descriptorIndices[descriptorIndexKey];
 
-	return std::make_pair(true, outputDirectoryPath);
+	for (const auto& directoryPath : directoryPaths)
+		descriptorIndex.indexedDirectoryPaths.insert(directoryPath.generic_string());
+
+	for (auto& descriptorAndDirectory : descriptorAndDirectories)
+	{
+		// Another thread may have registered the same directory between the two locks.
+		if (descriptorIndex.indexedDirectoryPaths.insert(descriptorAndDirectory.second.generic_string()).second)
+		{
+			descriptorIndex.descriptorIndex.insert(descriptorAndDirectory.first);
+			descriptorIndex.descriptorDirectories.push_back(std::move(descriptorAndDirectory.second));
+		}
+	}
+}
+
+std::string CrystalProductionReporter::getDescriptorIndexKey(const std::filesystem::path& spaceGroupPath) const
+{
+	std::filesystem::path reducedCompositionPath = spaceGroupPath.parent_path().parent_path();
+	reducedCompositionPath /= toReducedCompositionName(getDirectoryName(spaceGroupPath.parent_path()));
+
+	return reducedCompositionPath.generic_string();
+}
+
+std::string CrystalProductionReporter::toReducedCompositionName(const std::string& compositionName) const
+{
+	// Composition directories are named Symbol_Count_Symbol_Count_..., as written by ChemicalComposition::toString().
+	std::vector<std::string> tokens;
+	{
+		std::string::size_type first = 0;
+
+		for (std::string::size_type last = compositionName.find('_'); !(last == std::string::npos); last = compositionName.find('_', first))
+		{
+			tokens.push_back(compositionName.substr(first, (last - first)));
+			first = last + 1;
+		}
+
+		tokens.push_back(compositionName.substr(first));
+	}
+
+	if (!((tokens.size() % 2) == 0))
+		return compositionName;
+
+
+	size_type greatestCommonDivider = 0;
+	{
+		for (size_type index = 1; index < tokens.size(); index += 2)
+		{
+			if (tokens[index].empty() || !(tokens[index].find_first_not_of("0123456789") == std::string::npos))
+				return compositionName;
+
+			greatestCommonDivider = std::gcd(greatestCommonDivider, static_cast<size_type>(std::stoull(tokens[index])));
+		}
+	}
+
+	if (greatestCommonDivider == 0)
+		return compositionName;
+
+
+	std::string reducedCompositionName;
+	{
+		for (size_type index = 0; index < tokens.size(); index += 2)
+		{
+			reducedCompositionName += tokens[index];
+			reducedCompositionName += "_";
+			reducedCompositionName += std::to_string(std::stoull(tokens[index + 1]) / greatestCommonDivider);
+			reducedCompositionName += "_";
+		}
+
+		reducedCompositionName.pop_back();
+	}
+
+	return reducedCompositionName;
+}
+
+void CrystalProductionReporter::registerFingerprint(const std::string& outputFingerprint, const StructuralDescriptor& structuralDescriptor, const std::filesystem::path& spaceGroupPath, const std::filesystem::path& outputDirectoryPath) const
+{
+	std::lock_guard<std::shared_mutex> guard{ s_fingerprintIndexMutex };
+	FingerprintIndex& fingerprintIndex = s_fingerprintIndices[spaceGroupPath.generic_string()];
+
+	fingerprintIndex.fingerprintAndDirectory.emplace(outputFingerprint, outputDirectoryPath);
+	fingerprintIndex.indexedDirectoryNames.insert(getDirectoryName(outputDirectoryPath));
+
+	if (!(structuralDescriptor.isEmpty()))
+	{
+		DescriptorIndex& descriptorIndex = s_descriptorIndices[getDescriptorIndexKey(spaceGroupPath)];
+
+		descriptorIndex.descriptorIndex.insert(structuralDescriptor);
+		descriptorIndex.descriptorDirectories.push_back(outputDirectoryPath);
+		descriptorIndex.indexedDirectoryPaths.insert(outputDirectoryPath.generic_string());
+	}
+}
+
+void CrystalProductionReporter::registerMergedFingerprint(const std::string& outputFingerprint, const std::filesystem::path& spaceGroupPath, const std::filesystem::path& outputDirectoryPath) const
+{
+	std::lock_guard<std::shared_mutex> guard{ s_fingerprintIndexMutex };
+	s_fingerprintIndices[spaceGroupPath.generic_string()].fingerprintAndDirectory.emplace(outputFingerprint, outputDirectoryPath);
+}
+
+void CrystalProductionReporter::createOutputDirectory(const std::filesystem::path& outputDirectoryPath, const std::filesystem::path& spaceGroupPath) const
+{
+	try
+	{
+		System::IO::Directory::createDirectory(outputDirectoryPath, System::IO::Directory::CreateOptions::none);
+	}
+
+	catch (const System::IO::IOException&)
+	{
+		// Another process has taken this Type-N name since the index was seeded.
+		indexFingerprints(spaceGroupPath);
+		throw;
+	}
+}
+
+CrystalProductionReporter::StructuralDescriptor CrystalProductionReporter::toStructuralDescriptor(const OptimalCrystalStructure& conventionalCrystalStructure) const
+{
+	const NearDuplicateDetectionParameters& parameters = _crystalProductionReportParameters.nearDuplicateDetectionParameters();
+
+	if (parameters.needDetection())
+		return conventionalCrystalStructure.toStructuralDescriptor(parameters.radialCutoff(), parameters.numRadialBins());
+	else
+		return StructuralDescriptor{};
 }
 
 void CrystalProductionReporter::outputFeasibleCrystallographicData(const OptimalCrystalStructure& conventionalCrystalStructure, const OptimalCrystalStructure& optimalCrystalStructure, const std::filesystem::path& outputDirectoryPath) const
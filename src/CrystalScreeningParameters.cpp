@@ -0,0 +1,147 @@
+#include "CrystalScreeningParameters.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "InvalidFileException.h"
+
+using namespace MathematicalCrystalChemistry::Analysis;
+
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Constructors
+
+CrystalScreeningParameters::CrystalScreeningParameters() noexcept
+	: _needCostOrdering{ true }
+	, _spaceGroupRange{ SpaceGroupNumber{ 1 }, SpaceGroupNumber{ 230 } }
+	, _numAtomsRange{ 0, std::numeric_limits<size_type>::max() }
+	, _allowedAtomicNumbers{}
+{
+}
+
+// Constructors
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Methods
+
+void CrystalScreeningParameters::initialize() noexcept
+{
+	_needCostOrdering = true;
+
+	_spaceGroupRange = std::make_pair(SpaceGroupNumber{ 1 }, SpaceGroupNumber{ 230 });
+	_numAtomsRange = std::make_pair(size_type{ 0 }, std::numeric_limits<size_type>::max());
+	_allowedAtomicNumbers.clear();
+}
+
+void CrystalScreeningParameters::initialize(const System::IO::StreamReader& inputStreamReader)
+{
+	initialize();
+
+	System::IO::StreamReader genericStreamReader = inputStreamReader.getListBlock("&", "CRYSTAL_EXTRACTION_GENERIC");
+	{
+		std::string necessityTexts;
+
+		if (genericStreamReader.readParameter("Cost.Ordered.Filtering", necessityTexts))
+			_needCostOrdering = toNecessity(necessityTexts);
+	}
+
+
+	{
+		std::pair<size_type, size_type> range;
+
+		if (genericStreamReader.readParameter("Screening.Space.Group.Range", range))
+			_spaceGroupRange = std::make_pair(SpaceGroupNumber{ range.first }, SpaceGroupNumber{ range.second });
+	}
+	{
+		std::pair<size_type, size_type> range;
+
+		if (genericStreamReader.readParameter("Screening.Number.of.Atoms.Range", range))
+			_numAtomsRange = range;
+	}
+	{
+		std::vector<std::string> elementTexts;
+
+		if (genericStreamReader.readParameter("Screening.Chemical.Elements", elementTexts))
+		{
+			for (const auto& elementText : elementTexts)
+				_allowedAtomicNumbers.push_back(AtomicNumber{ elementText });
+
+			std::sort(_allowedAtomicNumbers.begin(), _allowedAtomicNumbers.end());
+			_allowedAtomicNumbers.erase(std::unique(_allowedAtomicNumbers.begin(), _allowedAtomicNumbers.end()), _allowedAtomicNumbers.end());
+		}
+	}
+
+
+	validate();
+}
+
+bool CrystalScreeningParameters::isAllowedAtomicNumber(const AtomicNumber atomicNumber) const noexcept
+{
+	if (_allowedAtomicNumbers.empty())
+		return true;
+	else
+		return std::binary_search(_allowedAtomicNumbers.begin(), _allowedAtomicNumbers.end(), atomicNumber);
+}
+
+// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+bool CrystalScreeningParameters::toNecessity(const std::string& inputTexts) const
+{
+	if (inputTexts == "ON" || inputTexts == "On" || inputTexts == "on")
+		return true;
+
+	else if (inputTexts == "OFF" || inputTexts == "Off" || inputTexts == "off")
+		return false;
+
+	else
+		throw System::IO::InvalidFileException{ typeid(*this), "toNecessity", "Could not read necessity texts." };
+}
+
+void CrystalScreeningParameters::validate() const
+{
+	if (_spaceGroupRange.second < _spaceGroupRange.first)
+		throw System::IO::InvalidFileException{ typeid(*this), "validate", "Maximum value of Screening.Space.Group.Range is less than the minimum." };
+
+	if (_numAtomsRange.second < _numAtomsRange.first)
+		throw System::IO::InvalidFileException{ typeid(*this), "validate", "Maximum value of Screening.Number.of.Atoms.Range is less than the minimum." };
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -1,5 +1,7 @@
 #include "CrystallineConstraintManager.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 
 #include "GeometricalConstraintParameters.h"
@@ -22,6 +24,7 @@ CrystallineConstraintManager::CrystallineConstraintManager() noexcept
 	, _exclusiveRadiusRatio{ MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultMinimumExclusionDistanceRatio() }
 	, _interatomicDistanceTracerCutoffRatio{ MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultInteratomicDistanceTracerCutoffRatio() }
 	, _interatomicDistanceConstrainerCutoffRatio{ MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultInteratomicDistanceConstrainerCutoffRatio() }
+	, _parallelConstrainingAtomThreshold{ MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultParallelConstrainingAtomThreshold() }
 	, _constrainingIndexPairs{}
 	, _tracingIndexPairs{}
 {
@@ -33,6 +36,7 @@ CrystallineConstraintManager::CrystallineConstraintManager(const ChemToolkit::Cr
 	, _exclusiveRadiusRatio{ MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultMinimumExclusionDistanceRatio() }
 	, _interatomicDistanceTracerCutoffRatio{ MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultInteratomicDistanceTracerCutoffRatio() }
 	, _interatomicDistanceConstrainerCutoffRatio{ MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultInteratomicDistanceConstrainerCutoffRatio() }
+	, _parallelConstrainingAtomThreshold{ MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultParallelConstrainingAtomThreshold() }
 	, _constrainingIndexPairs{}
 	, _tracingIndexPairs{}
 {
@@ -44,6 +48,7 @@ CrystallineConstraintManager::CrystallineConstraintManager(const ChemToolkit::Cr
 	, _exclusiveRadiusRatio{ MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultMinimumExclusionDistanceRatio() }
 	, _interatomicDistanceTracerCutoffRatio{ MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultInteratomicDistanceTracerCutoffRatio() }
 	, _interatomicDistanceConstrainerCutoffRatio{ MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultInteratomicDistanceConstrainerCutoffRatio() }
+	, _parallelConstrainingAtomThreshold{ MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultParallelConstrainingAtomThreshold() }
 	, _constrainingIndexPairs{}
 	, _tracingIndexPairs{}
 {
@@ -55,6 +60,7 @@ CrystallineConstraintManager::CrystallineConstraintManager(const ChemToolkit::Cr
 	, _exclusiveRadiusRatio{ MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultMinimumExclusionDistanceRatio() }
 	, _interatomicDistanceTracerCutoffRatio{ MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultInteratomicDistanceTracerCutoffRatio() }
 	, _interatomicDistanceConstrainerCutoffRatio{ MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultInteratomicDistanceConstrainerCutoffRatio() }
+	, _parallelConstrainingAtomThreshold{ MathematicalCrystalChemistry::Design::Optimization::GeometricalConstraintParameters::defaultParallelConstrainingAtomThreshold() }
 	, _constrainingIndexPairs{}
 	, _tracingIndexPairs{}
 {
@@ -81,96 +87,160 @@ void CrystallineConstraintManager::updateTracingIndexPairs()
 	clearInteratomicDistanceConstraints();
 	NumericalMatrix inverseBasisVectors = unitCell().getInverseBasisVectors();
 
+	if (isParallelConstrainable())
+	{
+		std::vector<std::vector<ConstrainerIndices<TranslatedAtomIndex>>> tracingIndexPairs(2 * atoms().size());
+		{
+			executeParallelTasks(tracingIndexPairs.size(), [this, &inverseBasisVectors, &tracingIndexPairs](const std::size_t taskIndex)
+				{
+					if (taskIndex < atoms().size())
+						traceInteratomicDistances(static_cast<OriginalAtomIndex>(taskIndex), inverseBasisVectors, tracingIndexPairs[taskIndex]);
+					else
+						traceSelfInteratomicDistances(static_cast<OriginalAtomIndex>(taskIndex - atoms().size()), inverseBasisVectors, tracingIndexPairs[taskIndex]);
+				});
+		}
 
-	for (size_type originalIndex = 0; originalIndex < atoms().size(); ++originalIndex)
+		for (const auto& indexPairs : tracingIndexPairs)
+			_tracingIndexPairs.insert(_tracingIndexPairs.end(), indexPairs.begin(), indexPairs.end());
+	}
+
+	else
 	{
-		for (size_type translatedOriginalIndex = (1 + originalIndex); translatedOriginalIndex < atoms().size(); ++translatedOriginalIndex)
+		for (size_type originalIndex = 0; originalIndex < atoms().size(); ++originalIndex)
+			traceInteratomicDistances(originalIndex, inverseBasisVectors, _tracingIndexPairs);
+
+		for (size_type originalIndex = 0; originalIndex < atoms().size(); ++originalIndex)
+			traceSelfInteratomicDistances(originalIndex, inverseBasisVectors, _tracingIndexPairs);
+	}
+}
+
+// For each atom, the in-cell atoms with a larger index in its own and the 26 surrounding bins, sorted by index.
+// Bins are cubes no smaller than the longest constrainable distance, so every in-cell pair within that distance is listed.
+// An empty result means that every bin surrounds every other one, that is, every in-cell pair is a neighbour.
+std::vector<std::vector<CrystallineConstraintManager::OriginalAtomIndex>> CrystallineConstraintManager::getConstrainableNeighborIndices() const
+{
+	std::vector<std::vector<OriginalAtomIndex>> neighborIndices;
+
+	if (atoms().empty())
+		return neighborIndices;
+
+
+	double cutoffDistance = 0.0;
+	NumericalVector minimumCoordinate = atoms().front().cartesianCoordinate();
+	NumericalVector maximumCoordinate = atoms().front().cartesianCoordinate();
+	{
+		double maximumRepulsionRadius = 0.0;
+		double maximumCovalentRadius = 0.0;
+		double maximumIonicRadius = 0.0;
+
+		for (const auto& atom : atoms())
 		{
-			if (isIonicAttractive(originalIndex, translatedOriginalIndex))
+			maximumRepulsionRadius = std::max(maximumRepulsionRadius, atom.ionicRepulsionRadius().minimum());
+			maximumCovalentRadius = std::max(maximumCovalentRadius, atom.covalentRadius().maximum());
+			maximumIonicRadius = std::max(maximumIonicRadius, atom.ionicRadius().maximum());
+
+			for (std::size_t axis = 0; axis < 3; ++axis)
 			{
-				double neighborZoneRadius = _interatomicDistanceTracerCutoffRatio * _exclusiveRadiusRatio * (atoms()[originalIndex].ionicRadius().maximum() + atoms()[translatedOriginalIndex].ionicRadius().maximum());
-				{
-					for (const auto& latticePoint : enumerateNeighborLatticePoints(originalIndex, translatedOriginalIndex, inverseBasisVectors, neighborZoneRadius))
-					{
-						if (!(isOriginalLatticePoint(latticePoint)))
-						{
-							if (isTraceableIonicExclusionDistance(originalIndex, translatedOriginalIndex, latticePoint))
-								_tracingIndexPairs.push_back(ConstrainerIndices<TranslatedAtomIndex>{ OriginalAtomIndex{ originalIndex }, TranslatedAtomIndex{ translatedOriginalIndex, latticePoint } });
-						}
-					}
-				}
+				minimumCoordinate[axis] = std::min(minimumCoordinate[axis], atom.cartesianCoordinate()[axis]);
+				maximumCoordinate[axis] = std::max(maximumCoordinate[axis], atom.cartesianCoordinate()[axis]);
 			}
+		}
 
-			else
-			{
-				if (isIonicRepulsive(originalIndex, translatedOriginalIndex))
-				{
-					double neighborZoneRadius = _interatomicDistanceTracerCutoffRatio * (atoms()[originalIndex].ionicRepulsionRadius().minimum() + atoms()[translatedOriginalIndex].ionicRepulsionRadius().minimum());
-					{
-						for (const auto& latticePoint : enumerateNeighborLatticePoints(originalIndex, translatedOriginalIndex, inverseBasisVectors, neighborZoneRadius))
-						{
-							if (!(isOriginalLatticePoint(latticePoint)))
-							{
-								if (isTraceableIonicRepulsionDistance(originalIndex, translatedOriginalIndex, latticePoint))
-									_tracingIndexPairs.push_back(ConstrainerIndices<TranslatedAtomIndex>{ OriginalAtomIndex{ originalIndex }, TranslatedAtomIndex{ translatedOriginalIndex, latticePoint } });
-							}
-						}
-					}
-				}
+		cutoffDistance = _interatomicDistanceConstrainerCutoffRatio * (maximumRepulsionRadius + maximumRepulsionRadius);
+		cutoffDistance = std::max(cutoffDistance, _interatomicDistanceConstrainerCutoffRatio * _exclusiveRadiusRatio * (maximumCovalentRadius + maximumCovalentRadius));
+		cutoffDistance = std::max(cutoffDistance, _interatomicDistanceConstrainerCutoffRatio * _exclusiveRadiusRatio * (maximumIonicRadius + maximumIonicRadius));
+	}
 
-				else
-				{
-					double neighborZoneRadius = _interatomicDistanceTracerCutoffRatio * _exclusiveRadiusRatio * (atoms()[originalIndex].covalentRadius().maximum() + atoms()[translatedOriginalIndex].covalentRadius().maximum());
-					{
-						for (const auto& latticePoint : enumerateNeighborLatticePoints(originalIndex, translatedOriginalIndex, inverseBasisVectors, neighborZoneRadius))
-						{
-							if (!(isOriginalLatticePoint(latticePoint)))
-							{
-								if (isTraceableCovalentExclusionDistance(originalIndex, translatedOriginalIndex, latticePoint))
-									_tracingIndexPairs.push_back(ConstrainerIndices<TranslatedAtomIndex>{ OriginalAtomIndex{ originalIndex }, TranslatedAtomIndex{ translatedOriginalIndex, latticePoint } });
-							}
-						}
-					}
-				}
-			}
+
+	// The bin side never drops below the mean spacing either, which bounds the number of bins by the number of atoms.
+	std::array<std::size_t, 3> numBins{ 1, 1, 1 };
+	double binSide = cutoffDistance;
+	{
+		double boundingVolume = 1.0;
+
+		for (std::size_t axis = 0; axis < 3; ++axis)
+			boundingVolume *= std::max(maximumCoordinate[axis] - minimumCoordinate[axis], cutoffDistance);
+
+		binSide = std::max(binSide, std::cbrt(boundingVolume / atoms().size()));
+
+		if (binSide > 0.0)
+		{
+			for (std::size_t axis = 0; axis < 3; ++axis)
+				numBins[axis] = 1 + static_cast<std::size_t>((maximumCoordinate[axis] - minimumCoordinate[axis]) / binSide);
 		}
 	}
 
-	for (size_type originalIndex = 0; originalIndex < atoms().size(); ++originalIndex)
+	if ((numBins[0] < 3) && (numBins[1] < 3) && (numBins[2] < 3))
+		return neighborIndices;
+	else
+		neighborIndices.resize(atoms().size());
+
+	std::vector<std::array<std::size_t, 3>> atomBins(atoms().size());
+	std::vector<std::size_t> binOffsets(1 + (numBins[0] * numBins[1] * numBins[2]), 0);
+	std::vector<OriginalAtomIndex> binnedIndices(atoms().size());
 	{
-		LatticePoint originalLatticePoint{ 0,0,0 };
+		for (std::size_t originalIndex = 0; originalIndex < atoms().size(); ++originalIndex)
+		{
+			for (std::size_t axis = 0; axis < 3; ++axis)
+				atomBins[originalIndex][axis] = (numBins[axis] == 1) ? 0 : std::min(numBins[axis] - 1, static_cast<std::size_t>((atoms()[originalIndex].cartesianCoordinate()[axis] - minimumCoordinate[axis]) / binSide));
+
+			++binOffsets[1 + ((atomBins[originalIndex][0] * numBins[1] + atomBins[originalIndex][1]) * numBins[2] + atomBins[originalIndex][2])];
+		}
 
+		for (std::size_t binIndex = 1; binIndex < binOffsets.size(); ++binIndex)
+			binOffsets[binIndex] += binOffsets[binIndex - 1];
+
+		std::vector<std::size_t> binPositions(binOffsets.begin(), binOffsets.end() - 1);
+
+		for (std::size_t originalIndex = 0; originalIndex < atoms().size(); ++originalIndex)
+			binnedIndices[binPositions[(atomBins[originalIndex][0] * numBins[1] + atomBins[originalIndex][1]) * numBins[2] + atomBins[originalIndex][2]]++] = static_cast<OriginalAtomIndex>(originalIndex);
+	}
 
-		if (isIonicRepulsive(originalIndex, originalIndex))
+
+	// Every atom with a larger index in the surrounding bins is counted first, so that every list is allocated once.
+	for (std::size_t originalIndex = 0; originalIndex < atoms().size(); ++originalIndex)
+	{
+		const std::array<std::size_t, 3>& atomBin = atomBins[originalIndex];
+		std::size_t numNeighbors = 0;
+
+		for (std::size_t x = ((atomBin[0] == 0) ? 0 : (atomBin[0] - 1)); x < std::min(numBins[0], atomBin[0] + 2); ++x)
 		{
-			double neighborZoneRadius = _interatomicDistanceTracerCutoffRatio * (atoms()[originalIndex].ionicRepulsionRadius().minimum() + atoms()[originalIndex].ionicRepulsionRadius().minimum());
+			for (std::size_t y = ((atomBin[1] == 0) ? 0 : (atomBin[1] - 1)); y < std::min(numBins[1], atomBin[1] + 2); ++y)
 			{
-				for (const auto& latticePoint : enumerateNeighborLatticePoints(originalIndex, originalIndex, inverseBasisVectors, neighborZoneRadius))
+				for (std::size_t z = ((atomBin[2] == 0) ? 0 : (atomBin[2] - 1)); z < std::min(numBins[2], atomBin[2] + 2); ++z)
 				{
-					if (originalLatticePoint < latticePoint)
-					{
-						if (isTraceableIonicRepulsionDistance(originalIndex, originalIndex, latticePoint))
-							_tracingIndexPairs.push_back(ConstrainerIndices<TranslatedAtomIndex>{ OriginalAtomIndex{ originalIndex }, TranslatedAtomIndex{ originalIndex, latticePoint } });
-					}
+					const std::size_t binIndex = (x * numBins[1] + y) * numBins[2] + z;
+
+					// Indices ascend within a bin.
+					numNeighbors += (binnedIndices.begin() + binOffsets[binIndex + 1]) - std::upper_bound(binnedIndices.begin() + binOffsets[binIndex], binnedIndices.begin() + binOffsets[binIndex + 1], originalIndex);
 				}
 			}
 		}
 
-		else
+		neighborIndices[originalIndex].reserve(numNeighbors);
+	}
+
+	// Visiting the larger index of each pair in ascending order appends to every list in ascending order, so no list needs sorting.
+	for (std::size_t translatedOriginalIndex = 0; translatedOriginalIndex < atoms().size(); ++translatedOriginalIndex)
+	{
+		const std::array<std::size_t, 3>& atomBin = atomBins[translatedOriginalIndex];
+
+		for (std::size_t x = ((atomBin[0] == 0) ? 0 : (atomBin[0] - 1)); x < std::min(numBins[0], atomBin[0] + 2); ++x)
 		{
-			double neighborZoneRadius = _interatomicDistanceTracerCutoffRatio * _exclusiveRadiusRatio * (atoms()[originalIndex].covalentRadius().maximum() + atoms()[originalIndex].covalentRadius().maximum());
+			for (std::size_t y = ((atomBin[1] == 0) ? 0 : (atomBin[1] - 1)); y < std::min(numBins[1], atomBin[1] + 2); ++y)
 			{
-				for (const auto& latticePoint : enumerateNeighborLatticePoints(originalIndex, originalIndex, inverseBasisVectors, neighborZoneRadius))
+				for (std::size_t z = ((atomBin[2] == 0) ? 0 : (atomBin[2] - 1)); z < std::min(numBins[2], atomBin[2] + 2); ++z)
 				{
-					if (originalLatticePoint < latticePoint)
-					{
-						if (isTraceableCovalentExclusionDistance(originalIndex, originalIndex, latticePoint))
-							_tracingIndexPairs.push_back(ConstrainerIndices<TranslatedAtomIndex>{ OriginalAtomIndex{ originalIndex }, TranslatedAtomIndex{ originalIndex, latticePoint } });
-					}
+					const std::size_t binIndex = (x * numBins[1] + y) * numBins[2] + z;
+
+					for (std::size_t position = binOffsets[binIndex]; (position < binOffsets[binIndex + 1]) && (binnedIndices[position] < translatedOriginalIndex); ++position)
+						neighborIndices[binnedIndices[position]].push_back(static_cast<OriginalAtomIndex>(translatedOriginalIndex));
 				}
 			}
 		}
 	}
+
+	return neighborIndices;
 }
 
 // Methods
@@ -193,29 +263,69 @@ void CrystallineConstraintManager::updateConstrainingIndexPairs()
 {
 	_constrainingIndexPairs.clear();
 
-
-	for (const auto& indices : _tracingIndexPairs)
+	if (isParallelConstrainable())
 	{
-		if (isIonicAttractive(indices.originalAtomIndex(), indices.translatedAtomIndex().originalIndex()))
+		std::vector<char> areConstrainable(_tracingIndexPairs.size(), 0);
 		{
-			if (isConstrainableIonicExclusionDistance(indices.originalAtomIndex(), indices.translatedAtomIndex()))
-				_constrainingIndexPairs.push_back(indices);
+			executeParallelTasks(_tracingIndexPairs.size(), [this, &areConstrainable](const std::size_t taskIndex)
+				{
+					if (isConstrainableTracingIndexPair(_tracingIndexPairs[taskIndex]))
+						areConstrainable[taskIndex] = 1;
+				});
 		}
 
-		else if (isIonicRepulsive(indices.originalAtomIndex(), indices.translatedAtomIndex().originalIndex()))
+		for (std::size_t index = 0; index < _tracingIndexPairs.size(); ++index)
 		{
-			if (isConstrainableIonicRepulsionDistance(indices.originalAtomIndex(), indices.translatedAtomIndex()))
-				_constrainingIndexPairs.push_back(indices);
+			if (areConstrainable[index] != 0)
+				_constrainingIndexPairs.push_back(_tracingIndexPairs[index]);
 		}
+	}
 
-		else
+	else
+	{
+		for (const auto& indices : _tracingIndexPairs)
 		{
-			if (isConstrainableCovalentExclusionDistance(indices.originalAtomIndex(), indices.translatedAtomIndex()))
+			if (isConstrainableTracingIndexPair(indices))
 				_constrainingIndexPairs.push_back(indices);
 		}
 	}
 }
 
+void CrystallineConstraintManager::transformUnitCell(const TransformationMatrix& transformationMatrix)
+{
+	const TransformationMatrix inverseTransformationMatrix = ChemToolkit::Crystallography::DelaunayReducer::getInverseMatrix(transformationMatrix);
+	const std::vector<LatticePoint> wrappingLatticePoints = transformCartesianCoordinates(transformationMatrix);
+
+
+	for (size_type originalIndex = 0; originalIndex < atoms().size(); ++originalIndex)
+		transformChemicalBonds(originalIndex, inverseTransformationMatrix, wrappingLatticePoints);
+
+	transformIndexPairs(_tracingIndexPairs, inverseTransformationMatrix, wrappingLatticePoints);
+	transformIndexPairs(_constrainingIndexPairs, inverseTransformationMatrix, wrappingLatticePoints);
+
+
+	for (size_type originalIndex = 0; originalIndex < atoms().size(); ++originalIndex)
+	{
+		for (size_type translatedOriginalIndex = (1 + originalIndex); translatedOriginalIndex < atoms().size(); ++translatedOriginalIndex)
+		{
+			TranslatedAtomIndex translatedAtomIndex = getTransformedAtomIndex(originalIndex, TranslatedAtomIndex{ translatedOriginalIndex }, inverseTransformationMatrix, wrappingLatticePoints);
+
+			if (!(isOriginalLatticePoint(translatedAtomIndex.latticePoint())))
+			{
+				ConstrainerIndices<TranslatedAtomIndex> indices{ OriginalAtomIndex{ originalIndex }, std::move(translatedAtomIndex) };
+
+				if (isTraceableIndexPair(indices))
+				{
+					_tracingIndexPairs.push_back(indices);
+
+					if (isConstrainableTracingIndexPair(indices))
+						_constrainingIndexPairs.push_back(indices);
+				}
+			}
+		}
+	}
+}
+
 // Protected methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -232,6 +342,108 @@ void CrystallineConstraintManager::updateConstrainingIndexPairs()
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // Private methods
 
+void CrystallineConstraintManager::traceInteratomicDistances(const OriginalAtomIndex originalIndex, const NumericalMatrix& inverseBasisVectors, std::vector<ConstrainerIndices<TranslatedAtomIndex>>& tracingIndexPairs) const
+{
+	for (size_type translatedOriginalIndex = (1 + originalIndex); translatedOriginalIndex < atoms().size(); ++translatedOriginalIndex)
+	{
+		if (isIonicAttractive(originalIndex, translatedOriginalIndex))
+		{
+			double neighborZoneRadius = _interatomicDistanceTracerCutoffRatio * _exclusiveRadiusRatio * (atoms()[originalIndex].ionicRadius().maximum() + atoms()[translatedOriginalIndex].ionicRadius().maximum());
+			{
+				for (const auto& latticePoint : enumerateNeighborLatticePoints(originalIndex, translatedOriginalIndex, inverseBasisVectors, neighborZoneRadius))
+				{
+					if (!(isOriginalLatticePoint(latticePoint)))
+					{
+						if (isTraceableIonicExclusionDistance(originalIndex, translatedOriginalIndex, latticePoint))
+							tracingIndexPairs.push_back(ConstrainerIndices<TranslatedAtomIndex>{ OriginalAtomIndex{ originalIndex }, TranslatedAtomIndex{ translatedOriginalIndex, latticePoint } });
+					}
+				}
+			}
+		}
+
+		else
+		{
+			if (isIonicRepulsive(originalIndex, translatedOriginalIndex))
+			{
+				double neighborZoneRadius = _interatomicDistanceTracerCutoffRatio * (atoms()[originalIndex].ionicRepulsionRadius().minimum() + atoms()[translatedOriginalIndex].ionicRepulsionRadius().minimum());
+				{
+					for (const auto& latticePoint : enumerateNeighborLatticePoints(originalIndex, translatedOriginalIndex, inverseBasisVectors, neighborZoneRadius))
+					{
+						if (!(isOriginalLatticePoint(latticePoint)))
+						{
+							if (isTraceableIonicRepulsionDistance(originalIndex, translatedOriginalIndex, latticePoint))
+								tracingIndexPairs.push_back(ConstrainerIndices<TranslatedAtomIndex>{ OriginalAtomIndex{ originalIndex }, TranslatedAtomIndex{ translatedOriginalIndex, latticePoint } });
+						}
+					}
+				}
+			}
+
+			else
+			{
+				double neighborZoneRadius = _interatomicDistanceTracerCutoffRatio * _exclusiveRadiusRatio * (atoms()[originalIndex].covalentRadius().maximum() + atoms()[translatedOriginalIndex].covalentRadius().maximum());
+				{
+					for (const auto& latticePoint : enumerateNeighborLatticePoints(originalIndex, translatedOriginalIndex, inverseBasisVectors, neighborZoneRadius))
+					{
+						if (!(isOriginalLatticePoint(latticePoint)))
+						{
+							if (isTraceableCovalentExclusionDistance(originalIndex, translatedOriginalIndex, latticePoint))
+								tracingIndexPairs.push_back(ConstrainerIndices<TranslatedAtomIndex>{ OriginalAtomIndex{ originalIndex }, TranslatedAtomIndex{ translatedOriginalIndex, latticePoint } });
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+void CrystallineConstraintManager::traceSelfInteratomicDistances(const OriginalAtomIndex originalIndex, const NumericalMatrix& inverseBasisVectors, std::vector<ConstrainerIndices<TranslatedAtomIndex>>& tracingIndexPairs) const
+{
+	LatticePoint originalLatticePoint{ 0,0,0 };
+
+
+	if (isIonicRepulsive(originalIndex, originalIndex))
+	{
+		double neighborZoneRadius = _interatomicDistanceTracerCutoffRatio * (atoms()[originalIndex].ionicRepulsionRadius().minimum() + atoms()[originalIndex].ionicRepulsionRadius().minimum());
+		{
+			for (const auto& latticePoint : enumerateNeighborLatticePoints(originalIndex, originalIndex, inverseBasisVectors, neighborZoneRadius))
+			{
+				if (originalLatticePoint < latticePoint)
+				{
+					if (isTraceableIonicRepulsionDistance(originalIndex, originalIndex, latticePoint))
+						tracingIndexPairs.push_back(ConstrainerIndices<TranslatedAtomIndex>{ OriginalAtomIndex{ originalIndex }, TranslatedAtomIndex{ originalIndex, latticePoint } });
+				}
+			}
+		}
+	}
+
+	else
+	{
+		double neighborZoneRadius = _interatomicDistanceTracerCutoffRatio * _exclusiveRadiusRatio * (atoms()[originalIndex].covalentRadius().maximum() + atoms()[originalIndex].covalentRadius().maximum());
+		{
+			for (const auto& latticePoint : enumerateNeighborLatticePoints(originalIndex, originalIndex, inverseBasisVectors, neighborZoneRadius))
+			{
+				if (originalLatticePoint < latticePoint)
+				{
+					if (isTraceableCovalentExclusionDistance(originalIndex, originalIndex, latticePoint))
+						tracingIndexPairs.push_back(ConstrainerIndices<TranslatedAtomIndex>{ OriginalAtomIndex{ originalIndex }, TranslatedAtomIndex{ originalIndex, latticePoint } });
+				}
+			}
+		}
+	}
+}
+
+bool CrystallineConstraintManager::isConstrainableTracingIndexPair(const ConstrainerIndices<TranslatedAtomIndex>& indices) const noexcept
+{
+	if (isIonicAttractive(indices.originalAtomIndex(), indices.translatedAtomIndex().originalIndex()))
+		return isConstrainableIonicExclusionDistance(indices.originalAtomIndex(), indices.translatedAtomIndex());
+
+	else if (isIonicRepulsive(indices.originalAtomIndex(), indices.translatedAtomIndex().originalIndex()))
+		return isConstrainableIonicRepulsionDistance(indices.originalAtomIndex(), indices.translatedAtomIndex());
+
+	else
+		return isConstrainableCovalentExclusionDistance(indices.originalAtomIndex(), indices.translatedAtomIndex());
+}
+
 std::vector<CrystallineConstraintManager::LatticePoint> CrystallineConstraintManager::enumerateNeighborLatticePoints(const OriginalAtomIndex originalIndex, const OriginalAtomIndex translatedIndex, const NumericalMatrix& inverseBasisVectors, const double neighborZoneRadius) const
 {
 	std::vector<LatticePoint> latticePoints;
@@ -289,6 +501,138 @@ std::vector<CrystallineConstraintManager::LatticePoint> CrystallineConstraintMan
 	return latticePoints;
 }
 
+bool CrystallineConstraintManager::isTraceableIndexPair(const ConstrainerIndices<TranslatedAtomIndex>& indices) const noexcept
+{
+	const OriginalAtomIndex originalIndex = indices.originalAtomIndex();
+	const OriginalAtomIndex translatedOriginalIndex = indices.translatedAtomIndex().originalIndex();
+
+
+	if (isIonicAttractive(originalIndex, translatedOriginalIndex))
+		return isTraceableIonicExclusionDistance(originalIndex, translatedOriginalIndex, indices.translatedAtomIndex().latticePoint());
+	else if (isIonicRepulsive(originalIndex, translatedOriginalIndex))
+		return isTraceableIonicRepulsionDistance(originalIndex, translatedOriginalIndex, indices.translatedAtomIndex().latticePoint());
+	else
+		return isTraceableCovalentExclusionDistance(originalIndex, translatedOriginalIndex, indices.translatedAtomIndex().latticePoint());
+}
+
+std::vector<CrystallineConstraintManager::LatticePoint> CrystallineConstraintManager::transformCartesianCoordinates(const TransformationMatrix& transformationMatrix)
+{
+	unitCell() = ChemToolkit::Crystallography::DelaunayReducer::getTransformedUnitCell(unitCell(), transformationMatrix);
+	NumericalMatrix inverseBasisVectors = unitCell().getInverseBasisVectors();
+
+	std::vector<LatticePoint> wrappingLatticePoints;
+	{
+		for (auto& atom : atoms())
+		{
+			NumericalVector fractionalCoordinate = inverseBasisVectors * atom.cartesianCoordinate();
+			LatticePoint wrappingLatticePoint{ 0,0,0 };
+			{
+				for (size_type axis = 0; axis < 3; ++axis)
+				{
+					wrappingLatticePoint[axis] = static_cast<TranslatedAtomIndex::lattice_point_value_type>(std::floor(fractionalCoordinate[axis]));
+					fractionalCoordinate[axis] -= static_cast<double>(wrappingLatticePoint[axis]);
+				}
+			}
+
+			atom.cartesianCoordinate() = unitCell().basisVectors() * fractionalCoordinate;
+			wrappingLatticePoints.push_back(wrappingLatticePoint);
+		}
+	}
+
+	return wrappingLatticePoints;
+}
+
+void CrystallineConstraintManager::transformChemicalBonds(const OriginalAtomIndex originalIndex, const TransformationMatrix& inverseTransformationMatrix, const std::vector<LatticePoint>& wrappingLatticePoints)
+{
+	ConstrainingAtom& atom = atoms()[originalIndex];
+
+	std::vector<TranslatedAtomIndex> covalentBondedIndices;
+	std::vector<TranslatedAtomIndex> ionicBondedIndices;
+	std::vector<TranslatedAtomIndex> ionicRepulsedIndices;
+	{
+		for (const auto& bondedIndex : atom.getCovalentBondedOriginalAtomIndices())
+			covalentBondedIndices.push_back(getTransformedAtomIndex(originalIndex, TranslatedAtomIndex{ bondedIndex }, inverseTransformationMatrix, wrappingLatticePoints));
+		for (const auto& bondedIndex : atom.getCovalentBondedTranslatedAtomIndices())
+			covalentBondedIndices.push_back(getTransformedAtomIndex(originalIndex, bondedIndex, inverseTransformationMatrix, wrappingLatticePoints));
+
+		for (const auto& bondedIndex : atom.getIonicBondedOriginalAtomIndices())
+			ionicBondedIndices.push_back(getTransformedAtomIndex(originalIndex, TranslatedAtomIndex{ bondedIndex }, inverseTransformationMatrix, wrappingLatticePoints));
+		for (const auto& bondedIndex : atom.getIonicBondedTranslatedAtomIndices())
+			ionicBondedIndices.push_back(getTransformedAtomIndex(originalIndex, bondedIndex, inverseTransformationMatrix, wrappingLatticePoints));
+
+		for (const auto& repulsedIndex : atom.getIonicRepulsedOriginalAtomIndices())
+			ionicRepulsedIndices.push_back(getTransformedAtomIndex(originalIndex, TranslatedAtomIndex{ repulsedIndex }, inverseTransformationMatrix, wrappingLatticePoints));
+		for (const auto& repulsedIndex : atom.getIonicRepulsedTranslatedAtomIndices())
+			ionicRepulsedIndices.push_back(getTransformedAtomIndex(originalIndex, repulsedIndex, inverseTransformationMatrix, wrappingLatticePoints));
+	}
+
+	atom.clearCovalentBonds();
+	atom.clearIonicBonds();
+	atom.clearIonicRepulsions();
+
+
+	for (const auto& bondedIndex : covalentBondedIndices)
+	{
+		if (isOriginalLatticePoint(bondedIndex.latticePoint()))
+			atom.createCovalentBondWith(bondedIndex.originalIndex(), atoms()[bondedIndex.originalIndex()].ionicAtomicNumber().atomicNumber());
+		else
+			atom.createCovalentBondWith(bondedIndex, atoms()[bondedIndex.originalIndex()].ionicAtomicNumber().atomicNumber());
+	}
+
+	for (const auto& bondedIndex : ionicBondedIndices)
+	{
+		if (isOriginalLatticePoint(bondedIndex.latticePoint()))
+			atom.createIonicBondWith(bondedIndex.originalIndex(), atoms()[bondedIndex.originalIndex()].ionicAtomicNumber().atomicNumber());
+		else
+			atom.createIonicBondWith(bondedIndex, atoms()[bondedIndex.originalIndex()].ionicAtomicNumber().atomicNumber());
+	}
+
+	for (const auto& repulsedIndex : ionicRepulsedIndices)
+	{
+		if (isOriginalLatticePoint(repulsedIndex.latticePoint()))
+			atom.createIonicRepulsionWith(repulsedIndex.originalIndex());
+		else
+			atom.createIonicRepulsionWith(repulsedIndex);
+	}
+}
+
+void CrystallineConstraintManager::transformIndexPairs(std::vector<ConstrainerIndices<TranslatedAtomIndex>>& indexPairs, const TransformationMatrix& inverseTransformationMatrix, const std::vector<LatticePoint>& wrappingLatticePoints) const
+{
+	constexpr LatticePoint originalLatticePoint{ 0,0,0 };
+
+	std::vector<ConstrainerIndices<TranslatedAtomIndex>> transformedIndexPairs;
+	{
+		for (const auto& indices : indexPairs)
+		{
+			TranslatedAtomIndex translatedAtomIndex = getTransformedAtomIndex(indices.originalAtomIndex(), indices.translatedAtomIndex(), inverseTransformationMatrix, wrappingLatticePoints);
+
+			if (!(isOriginalLatticePoint(translatedAtomIndex.latticePoint())))
+			{
+				if ((translatedAtomIndex.originalIndex() == indices.originalAtomIndex()) && (translatedAtomIndex.latticePoint() < originalLatticePoint))
+					translatedAtomIndex.reverseLatticePoint();
+
+				transformedIndexPairs.push_back(ConstrainerIndices<TranslatedAtomIndex>{ indices.originalAtomIndex(), std::move(translatedAtomIndex) });
+			}
+		}
+	}
+
+	indexPairs = std::move(transformedIndexPairs);
+}
+
+CrystallineConstraintManager::TranslatedAtomIndex CrystallineConstraintManager::getTransformedAtomIndex(const OriginalAtomIndex originalIndex, const TranslatedAtomIndex& translatedAtomIndex, const TransformationMatrix& inverseTransformationMatrix, const std::vector<LatticePoint>& wrappingLatticePoints) const noexcept
+{
+	LatticePoint latticePoint = ChemToolkit::Crystallography::DelaunayReducer::getTransformedLatticePoint(inverseTransformationMatrix, translatedAtomIndex.latticePoint());
+	{
+		for (size_type axis = 0; axis < 3; ++axis)
+		{
+			latticePoint[axis] += wrappingLatticePoints[translatedAtomIndex.originalIndex()][axis];
+			latticePoint[axis] -= wrappingLatticePoints[originalIndex][axis];
+		}
+	}
+
+	return TranslatedAtomIndex{ translatedAtomIndex.originalIndex(), latticePoint };
+}
+
 // Private methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -0,0 +1,243 @@
+#include "DelaunayReducer.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "ApplicationException.h"
+
+using namespace ChemToolkit::Crystallography;
+
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Constructors
+
+double DelaunayReducer::s_defaultPrecision{ 0.00001 };
+
+
+
+DelaunayReducer::DelaunayReducer() noexcept
+	: _precision{ s_defaultPrecision }
+{
+}
+
+DelaunayReducer::DelaunayReducer(const double val)
+	: _precision{ val }
+{
+	if (_precision <= 0.0)
+		throw System::ExceptionServices::ArgumentOutOfRangeException{ typeid(*this), "constructor", "Input precision is not more than zero." };
+}
+
+// Constructors
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Methods
+
+DelaunayReducer::TransformationMatrix DelaunayReducer::getTransformationMatrix(const UnitCell& cell) const
+{
+	std::array<NumericalVector, 4> superBasisVectors;
+	std::array<std::array<int, 3>, 4> superBasisCoefficients{ { { 1,0,0 }, { 0,1,0 }, { 0,0,1 }, { -1,-1,-1 } } };
+	{
+		for (size_type column = 0; column < 3; ++column)
+		{
+			for (size_type row = 0; row < 3; ++row)
+				superBasisVectors[column][row] = cell.basisVectors()(row, column);
+		}
+
+		superBasisVectors[3] = 0.0;
+		superBasisVectors[3] -= superBasisVectors[0];
+		superBasisVectors[3] -= superBasisVectors[1];
+		superBasisVectors[3] -= superBasisVectors[2];
+	}
+
+	size_type reductionSteps = 0;
+	{
+		while (reduceSuperBasis(superBasisVectors, superBasisCoefficients))
+		{
+			if (maxReductionSteps() < ++reductionSteps)
+				throw System::ExceptionServices::ApplicationException{ typeid(*this), "getTransformationMatrix", "Could not apply delaunay reduction." };
+		}
+	}
+
+
+	std::array<NumericalVector, 7> candidateVectors{ superBasisVectors[0], superBasisVectors[1], superBasisVectors[2], superBasisVectors[3], superBasisVectors[0] + superBasisVectors[1], superBasisVectors[1] + superBasisVectors[2], superBasisVectors[2] + superBasisVectors[0] };
+	std::array<std::array<int, 3>, 7> candidateCoefficients;
+	{
+		for (size_type position = 0; position < 4; ++position)
+			candidateCoefficients[position] = superBasisCoefficients[position];
+
+		for (size_type position = 0; position < 3; ++position)
+		{
+			for (size_type axis = 0; axis < 3; ++axis)
+				candidateCoefficients[4 + position][axis] = superBasisCoefficients[position][axis] + superBasisCoefficients[(position + 1) % 3][axis];
+		}
+	}
+
+	std::array<size_type, 7> candidateOrder{ 0,1,2,3,4,5,6 };
+	std::stable_sort(candidateOrder.begin(), candidateOrder.end(), [&candidateVectors](const size_type indexA, const size_type indexB) { return (candidateVectors[indexA].normSquare() < candidateVectors[indexB].normSquare()); });
+
+
+	std::array<size_type, 3> basisIndices{ candidateOrder[0], candidateOrder[0], candidateOrder[0] };
+	size_type numBasisVectors = 1;
+	{
+		for (size_type position = 1; (position < candidateOrder.size()) && (numBasisVectors < 3); ++position)
+		{
+			const NumericalVector& candidateVector = candidateVectors[candidateOrder[position]];
+
+			if (numBasisVectors == 1)
+			{
+				NumericalVector crossProduct;
+				{
+					crossProduct[0] = (candidateVectors[basisIndices[0]][1] * candidateVector[2]) - (candidateVectors[basisIndices[0]][2] * candidateVector[1]);
+					crossProduct[1] = (candidateVectors[basisIndices[0]][2] * candidateVector[0]) - (candidateVectors[basisIndices[0]][0] * candidateVector[2]);
+					crossProduct[2] = (candidateVectors[basisIndices[0]][0] * candidateVector[1]) - (candidateVectors[basisIndices[0]][1] * candidateVector[0]);
+				}
+
+				if (_precision < crossProduct.norm())
+					basisIndices[numBasisVectors++] = candidateOrder[position];
+			}
+
+			else
+			{
+				if (_precision < std::abs(getDeterminant(candidateVectors[basisIndices[0]], candidateVectors[basisIndices[1]], candidateVector)))
+					basisIndices[numBasisVectors++] = candidateOrder[position];
+			}
+		}
+	}
+
+	if (numBasisVectors < 3)
+		throw System::ExceptionServices::ApplicationException{ typeid(*this), "getTransformationMatrix", "Could not find three independent reduced basis vectors." };
+
+
+	const int orientation = (getDeterminant(candidateVectors[basisIndices[0]], candidateVectors[basisIndices[1]], candidateVectors[basisIndices[2]]) < 0.0) ? -1 : 1;
+
+	TransformationMatrix transformationMatrix;
+	{
+		for (size_type column = 0; column < 3; ++column)
+		{
+			for (size_type row = 0; row < 3; ++row)
+				transformationMatrix[row][column] = orientation * candidateCoefficients[basisIndices[column]][row];
+		}
+	}
+
+	if (getDeterminant(transformationMatrix) != 1)
+		throw System::ExceptionServices::ApplicationException{ typeid(*this), "getTransformationMatrix", "Reduced basis vectors do not span the original lattice." };
+
+	return transformationMatrix;
+}
+
+UnitCell DelaunayReducer::getTransformedUnitCell(const UnitCell& cell, const TransformationMatrix& transformationMatrix) noexcept
+{
+	UnitCell transformedUnitCell;
+	{
+		for (size_type row = 0; row < 3; ++row)
+		{
+			for (size_type column = 0; column < 3; ++column)
+			{
+				double value = 0.0;
+
+				for (size_type position = 0; position < 3; ++position)
+					value += cell.basisVectors()(row, position) * static_cast<double>(transformationMatrix[position][column]);
+
+				transformedUnitCell.basisVectors()(row, column) = value;
+			}
+		}
+	}
+
+	return transformedUnitCell;
+}
+
+DelaunayReducer::TransformationMatrix DelaunayReducer::getInverseMatrix(const TransformationMatrix& matrix) noexcept
+{
+	const int determinant = getDeterminant(matrix);
+
+	TransformationMatrix inverseMatrix;
+	{
+		inverseMatrix[0][0] = determinant * ((matrix[1][1] * matrix[2][2]) - (matrix[1][2] * matrix[2][1]));
+		inverseMatrix[0][1] = determinant * ((matrix[0][2] * matrix[2][1]) - (matrix[0][1] * matrix[2][2]));
+		inverseMatrix[0][2] = determinant * ((matrix[0][1] * matrix[1][2]) - (matrix[0][2] * matrix[1][1]));
+
+		inverseMatrix[1][0] = determinant * ((matrix[1][2] * matrix[2][0]) - (matrix[1][0] * matrix[2][2]));
+		inverseMatrix[1][1] = determinant * ((matrix[0][0] * matrix[2][2]) - (matrix[0][2] * matrix[2][0]));
+		inverseMatrix[1][2] = determinant * ((matrix[0][2] * matrix[1][0]) - (matrix[0][0] * matrix[1][2]));
+
+		inverseMatrix[2][0] = determinant * ((matrix[1][0] * matrix[2][1]) - (matrix[1][1] * matrix[2][0]));
+		inverseMatrix[2][1] = determinant * ((matrix[0][1] * matrix[2][0]) - (matrix[0][0] * matrix[2][1]));
+		inverseMatrix[2][2] = determinant * ((matrix[0][0] * matrix[1][1]) - (matrix[0][1] * matrix[1][0]));
+	}
+
+	return inverseMatrix;
+}
+
+// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+bool DelaunayReducer::reduceSuperBasis(std::array<NumericalVector, 4>& superBasisVectors, std::array<std::array<int, 3>, 4>& superBasisCoefficients) const noexcept
+{
+	for (size_type first = 0; first < 4; ++first)
+	{
+		for (size_type second = (first + 1); second < 4; ++second)
+		{
+			if (_precision < MathToolkit::LinearAlgebra::getInnerProduct(superBasisVectors[first], superBasisVectors[second]))
+			{
+				for (size_type other = 0; other < 4; ++other)
+				{
+					if ((other != first) && (other != second))
+					{
+						superBasisVectors[other] += superBasisVectors[first];
+
+						for (size_type axis = 0; axis < 3; ++axis)
+							superBasisCoefficients[other][axis] += superBasisCoefficients[first][axis];
+					}
+				}
+
+				superBasisVectors[first] *= -1.0;
+
+				for (size_type axis = 0; axis < 3; ++axis)
+					superBasisCoefficients[first][axis] *= (-1);
+
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
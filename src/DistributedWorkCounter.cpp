@@ -0,0 +1,145 @@
+#include "DistributedWorkCounter.h"
+
+#include <chrono>
+
+#include "MpiPolicy.h"
+
+using namespace System::Parallel;
+
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Constructors
+
+DistributedWorkCounter::DistributedWorkCounter()
+	: _isDistributed{ (1 < MpiPolicy::mpiProcessing()) && MpiPolicy::isMpiThreadSerialized() }
+	, _window{ MPI_WIN_NULL }
+	, _windowCounter{ nullptr }
+	, _windowMutex{}
+	, _isProgressing{ false }
+	, _progressThread{}
+	, _localCounter{ 0 }
+{
+	// Collective over MPI_COMM_WORLD; only rank 0 exposes the counter, which every thread of every process increments atomically.
+	if (_isDistributed)
+	{
+		const MPI_Aint windowSize = (0 == MpiPolicy::mpiRank()) ? static_cast<MPI_Aint>(sizeof(unsigned long long)) : 0;
+		MPI_Win_allocate(windowSize, static_cast<int>(sizeof(unsigned long long)), MPI_INFO_NULL, MPI_COMM_WORLD, &_windowCounter, &_window);
+
+		if (0 == MpiPolicy::mpiRank())
+		{
+			MPI_Win_lock(MPI_LOCK_EXCLUSIVE, 0, 0, _window);
+			*_windowCounter = 0;
+			MPI_Win_unlock(0, _window);
+		}
+
+		MPI_Barrier(MPI_COMM_WORLD);
+
+		// Passive-target operations from other processes are only guaranteed to complete while rank 0 is inside the MPI library,
+		// and its own threads may spend minutes in extraction without calling MPI, so a thread keeps polling for them.
+		if (0 == MpiPolicy::mpiRank())
+		{
+			_isProgressing = true;
+			_progressThread = std::thread{ &DistributedWorkCounter::progressWindow, this };
+		}
+	}
+}
+
+DistributedWorkCounter::~DistributedWorkCounter()
+{
+	if (_isDistributed)
+	{
+		if (_progressThread.joinable())
+		{
+			_isProgressing = false;
+			_progressThread.join();
+		}
+
+		// MPI_Win_free is collective and progresses the remaining fetches itself while rank 0 waits in it.
+		MPI_Win_free(&_window);
+	}
+}
+
+// Constructors
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Public methods
+
+DistributedWorkCounter::size_type DistributedWorkCounter::fetchAndIncrement()
+{
+	if (_isDistributed)
+	{
+		const unsigned long long increment = 1;
+		unsigned long long previousCounter = 0;
+		{
+			std::lock_guard<std::mutex> guard{ _windowMutex };
+
+			MPI_Win_lock(MPI_LOCK_SHARED, 0, 0, _window);
+			MPI_Fetch_and_op(&increment, &previousCounter, MPI_UNSIGNED_LONG_LONG, 0, 0, MPI_SUM, _window);
+			MPI_Win_unlock(0, _window);
+		}
+
+		return static_cast<size_type>(previousCounter);
+	}
+
+	// Without a shared window, each process takes every mpiProcessing-th index starting from its own rank.
+	else
+		return ((_localCounter++ * MpiPolicy::mpiProcessing()) + MpiPolicy::mpiRank());
+}
+
+// Public methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+void DistributedWorkCounter::progressWindow()
+{
+	while (_isProgressing)
+	{
+		{
+			std::lock_guard<std::mutex> guard{ _windowMutex };
+
+			// MPI_THREAD_SERIALIZED: the window mutex keeps this call apart from the fetches of the other threads.
+			int hasMessage = 0;
+			MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, MPI_COMM_WORLD, &hasMessage, MPI_STATUS_IGNORE);
+		}
+
+		std::this_thread::sleep_for(std::chrono::microseconds{ 200 });
+	}
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -0,0 +1,146 @@
+#include "EnumerateCifFiles.h"
+
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <vector>
+
+#include "InvalidOperationException.h"
+
+using namespace MathematicalCrystalChemistry::Extraction::Internal;
+
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Constructors
+
+EnumerateCifFiles::size_type EnumerateCifFiles::s_numFilesPerChunk{ 4 };
+
+
+
+EnumerateCifFiles::EnumerateCifFiles() noexcept
+	: _inputCrystalsDirectoryPath{}
+	, _workCounter{ nullptr }
+	, _cifFileQueue{ nullptr }
+{
+}
+
+// Constructors
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Methods
+
+void EnumerateCifFiles::operator()() const
+{
+	if ((_workCounter == nullptr) || (_cifFileQueue == nullptr))
+		throw System::ExceptionServices::InvalidOperationException{ typeid(*this), "operator()", "The work counter or the CIF file queue is not set." };
+
+
+	try
+	{
+		size_type fileIndex = 0;
+		size_type chunkIndex = _workCounter->fetchAndIncrement();
+
+		enumerateDirectory(_inputCrystalsDirectoryPath, fileIndex, chunkIndex);
+	}
+
+
+	catch (const System::ExceptionServices::IException& e)
+	{
+		std::cout << _inputCrystalsDirectoryPath.generic_string() << std::endl;
+		std::cout << e.toString() << std::endl;
+	}
+
+	catch (const std::exception& e)
+	{
+		std::cout << _inputCrystalsDirectoryPath.generic_string() << std::endl;
+		std::cout << e.what() << std::endl;
+	}
+
+
+	_cifFileQueue->close();
+}
+
+// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+bool EnumerateCifFiles::enumerateDirectory(const std::filesystem::path& directoryPath, size_type& fileIndex, size_type& chunkIndex) const
+{
+	// Entries are sorted so that every MPI process numbers the files identically and the claimed chunks agree.
+	std::vector<std::filesystem::directory_entry> directoryEntries{ std::filesystem::directory_iterator{ directoryPath }, std::filesystem::directory_iterator{} };
+	std::sort(directoryEntries.begin(), directoryEntries.end());
+
+
+	for (const auto& directoryEntry : directoryEntries)
+	{
+		if (directoryEntry.is_directory() && !(directoryEntry.is_symlink()))
+		{
+			if (!(enumerateDirectory(directoryEntry.path(), fileIndex, chunkIndex)))
+				return false;
+		}
+
+		else if (directoryEntry.is_regular_file() && isCifFileName(directoryEntry.path().filename().string()))
+		{
+			if (chunkIndex < (fileIndex / s_numFilesPerChunk))
+				chunkIndex = _workCounter->fetchAndIncrement();
+
+			if (chunkIndex == (fileIndex / s_numFilesPerChunk))
+			{
+				if (!(_cifFileQueue->push(directoryEntry.path())))
+					return false;
+			}
+
+			++fileIndex;
+		}
+	}
+
+	return true;
+}
+
+bool EnumerateCifFiles::isCifFileName(const std::string& fileName)
+{
+	const std::string extension = ".cif";
+
+	if ((fileName.size() <= extension.size()) || !(fileName.compare(fileName.size() - extension.size(), extension.size(), extension) == 0))
+		return false;
+	else
+		return std::all_of(fileName.begin(), fileName.end() - extension.size(), [](const char c) { return (std::isalnum(static_cast<unsigned char>(c)) || (c == '-') || (c == '_')); });
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -3,11 +3,12 @@
 #include <iostream>
 #include <vector>
 
-#include "ThreadingPolicy.h"
+#include "MpiPolicy.h"
 
 #include "File.h"
 #include "Directory.h"
 #include "InvalidFileException.h"
+#include "InvalidOperationException.h"
 
 #include "CifStreamReader.h"
 #include "CifStreamWriter.h"
@@ -25,9 +26,18 @@ using namespace MathematicalCrystalChemistry::Extraction::Internal;
 // Constructors
 
 std::string ExtractCrystals::s_fingerprintFilename{ "fingerprint.txt" };
-std::mutex ExtractCrystals::s_outputMutex;
+std::string ExtractCrystals::s_structuralHashFilename{ "structuralHash.txt" };
+std::string ExtractCrystals::s_descriptorFilename{ "descriptor.txt" };
+std::string ExtractCrystals::s_nearDuplicatesFilename{ "nearDuplicates.txt" };
+System::Parallel::ShardedMutexTable ExtractCrystals::s_outputDirectoryLocks;
 double ExtractCrystals::s_defaultFeasibleErrorRate{ 0.05 };
 
+std::unordered_map<std::string, ExtractCrystals::DescriptorIndex> ExtractCrystals::s_descriptorIndices;
+std::mutex ExtractCrystals::s_descriptorIndexMutex;
+std::atomic<ExtractCrystals::size_type> ExtractCrystals::s_numNearDuplicates{ 0 };
+
+std::atomic<ExtractCrystals::size_type> ExtractCrystals::s_numProcessedFiles{ 0 };
+
 
 
 ExtractCrystals::ExtractCrystals(const size_type rank) noexcept
@@ -37,9 +47,12 @@ ExtractCrystals::ExtractCrystals(const size_type rank) noexcept
 	, _spaceGroupPrecision{ CrystalExtractionTask::defaultSpaceGroupPrecision() }
 	, _feasibleErrorRate{ s_defaultFeasibleErrorRate }
 	, _geometricalConstraintParameters{}
+	, _nearDuplicateDetectionParameters{}
+	, _crystalScreeningParameters{}
 	, _crystalOptimalityAnalyzer{}
 	, _isotypicCrystalExtractor{}
 	, _promisingCrystalExtractor{}
+	, _cifFileQueue{ nullptr }
 {
 }
 
@@ -61,69 +74,23 @@ ExtractCrystals::ExtractCrystals(const size_type rank) noexcept
 
 void ExtractCrystals::operator()() const
 {
-	std::queue<std::filesystem::path> cifFilePaths = getCifFilePaths();
-	eraseFilePathsInitially(cifFilePaths);
-
-
-	while (!(cifFilePaths.empty()))
-	{
-		std::filesystem::path cifFilePath = cifFilePaths.front();
-
-		try
-		{
-			ChemToolkit::Crystallography::IO::CifStreamReader cifStreamReader{ cifFilePath };
-			OptimalCrystalStructure optimalCrystalStructure{ cifStreamReader.readCrystallographicStructure() };
-			optimalCrystalStructure.simplifyStructure();
-			{
-				using MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingCrystalStructure;
-
-				ConstrainingCrystalStructure constrainingCrystalStructure{ optimalCrystalStructure };
-				constrainingCrystalStructure.setFeasibleErrorRate(_feasibleErrorRate);
-				constrainingCrystalStructure.setExclusiveRadiusRatio(_geometricalConstraintParameters.minimumExclusionDistanceRatio());
-				constrainingCrystalStructure.setInteratomicDistanceTracerCutoffRatio(_geometricalConstraintParameters.interatomicDistanceTracerCutoffRatio());
-				constrainingCrystalStructure.setInteratomicDistanceConstrainerCutoffRatio(_geometricalConstraintParameters.interatomicDistanceConstrainerCutoffRatio());
-				constrainingCrystalStructure.updateTracingIndexPairs();
-				constrainingCrystalStructure.createInteratomicDistanceConstraints();
-				//constrainingCrystalStructure.eraseInfeasibleChemicalBonds();
-
-				optimalCrystalStructure.import(constrainingCrystalStructure);
-			}
-
-
-			if (_isotypicCrystalExtractor.crystalIdentificationParameters().needExtraction())
-			{
-				if (!(_isotypicCrystalExtractor.isRegisteredCrystal(optimalCrystalStructure)))
-				{
-					eraseFilePathsForParallel(cifFilePaths);
-					continue;
-				}
-			}
+	if (_cifFileQueue == nullptr)
+		throw System::ExceptionServices::InvalidOperationException{ typeid(*this), "operator()", "The CIF file queue is not set." };
 
-			if (_crystalOptimalityAnalyzer.isActive())
-			{
-				if (!(_crystalOptimalityAnalyzer.isFeasible(optimalCrystalStructure)))
-				{
-					eraseFilePathsForParallel(cifFilePaths);
-					continue;
-				}
-			}
 
-			if (_promisingCrystalExtractor.promisingCrystalExtractionParameters().needExtraction())
-			{
-				OptimalCrystalStructure conventionalOptimalStructure = optimalCrystalStructure;
-				conventionalOptimalStructure.conventionalizeStructure(_spaceGroupPrecision);
+	ExtractionFilterPipeline filterPipeline{ _crystalScreeningParameters.needCostOrdering() };
 
+	const std::vector<FilterStage> screeningStages = getScreeningStages();
+	const std::vector<FilterStage> analysisStages = getAnalysisStages();
 
-				if (!(_promisingCrystalExtractor.isPromising(conventionalOptimalStructure)))
-				{
-					eraseFilePathsForParallel(cifFilePaths);
-					continue;
-				}
-			}
 
+	std::filesystem::path cifFilePath;
 
-			std::lock_guard<std::mutex> guard{ s_outputMutex };
-			outputOptimalCrystalStructure(cifFilePath, optimalCrystalStructure);
+	while (_cifFileQueue->pop(cifFilePath))
+	{
+		try
+		{
+			extractCrystal(cifFilePath, filterPipeline, screeningStages, analysisStages);
 		}
 
 
@@ -140,10 +107,38 @@ void ExtractCrystals::operator()() const
 		}
 
 
-		eraseFilePathsForParallel(cifFilePaths);
+		++s_numProcessedFiles;
 	}
 }
 
+const System::Parallel::ShardedMutexTable& ExtractCrystals::outputDirectoryLocks() noexcept
+{
+	return s_outputDirectoryLocks;
+}
+
+ExtractCrystals::size_type ExtractCrystals::countProcessedFiles() noexcept
+{
+	return s_numProcessedFiles.load();
+}
+
+ExtractCrystals::size_type ExtractCrystals::countNearDuplicates() noexcept
+{
+	return s_numNearDuplicates.load();
+}
+
+void ExtractCrystals::setExtractionStatistics(const size_type numProcessedFiles, const size_type numNearDuplicates) noexcept
+{
+	s_numProcessedFiles = numProcessedFiles;
+	s_numNearDuplicates = numNearDuplicates;
+}
+
+void ExtractCrystals::initializeExtractionStatistics() noexcept
+{
+	s_numProcessedFiles = 0;
+	s_numNearDuplicates = 0;
+	s_outputDirectoryLocks.resetStatistics();
+}
+
 // Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -160,56 +155,207 @@ void ExtractCrystals::operator()() const
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // Private methods
 
-std::queue<std::filesystem::path> ExtractCrystals::getCifFilePaths() const
+void ExtractCrystals::extractCrystal(const std::filesystem::path& cifFilePath, ExtractionFilterPipeline& filterPipeline, const std::vector<FilterStage>& screeningStages, const std::vector<FilterStage>& analysisStages) const
 {
-	std::queue<std::filesystem::path> cifFilePaths;
+	ChemToolkit::Crystallography::IO::CifStreamReader cifStreamReader{ cifFilePath };
+	ChemToolkit::Crystallography::CrystallographicInformation crystallographicInformation = cifStreamReader.readCrystallographicInformation();
+	CrystallographicStructure crystallographicStructure = crystallographicInformation.toCrystallographicStructure();
 	{
-		for (const auto& cifFilePath : System::IO::Directory::enumerateFiles(_inputCrystalsDirectoryPath, "([\\-\\_[:alnum:]]+)[\\.]{1}cif", System::IO::Directory::SearchOptions::AllDirectories))
-			cifFilePaths.push(cifFilePath);
+		for (const auto& stage : filterPipeline.getOrderedStages(screeningStages))
+		{
+			if (!(filterPipeline.evaluate(stage, [&]() { return isAcceptedByScreening(stage, crystallographicInformation.spaceGroupNumber(), crystallographicStructure); })))
+				return;
+		}
 	}
 
-	return cifFilePaths;
+
+	OptimalCrystalStructure optimalCrystalStructure{ crystallographicStructure };
+	optimalCrystalStructure.simplifyStructure();
+	{
+		using MathematicalCrystalChemistry::CrystalModel::Components::ConstrainingCrystalStructure;
+
+		ConstrainingCrystalStructure constrainingCrystalStructure{ optimalCrystalStructure };
+		constrainingCrystalStructure.setFeasibleErrorRate(_feasibleErrorRate);
+		constrainingCrystalStructure.setExclusiveRadiusRatio(_geometricalConstraintParameters.minimumExclusionDistanceRatio());
+		constrainingCrystalStructure.setInteratomicDistanceTracerCutoffRatio(_geometricalConstraintParameters.interatomicDistanceTracerCutoffRatio());
+		constrainingCrystalStructure.setInteratomicDistanceConstrainerCutoffRatio(_geometricalConstraintParameters.interatomicDistanceConstrainerCutoffRatio());
+		constrainingCrystalStructure.setParallelConstrainingAtomThreshold(_geometricalConstraintParameters.parallelConstrainingAtomThreshold());
+		constrainingCrystalStructure.updateTracingIndexPairs();
+		constrainingCrystalStructure.createInteratomicDistanceConstraints();
+		//constrainingCrystalStructure.eraseInfeasibleChemicalBonds();
+
+		optimalCrystalStructure.import(constrainingCrystalStructure);
+	}
+
+
+	for (const auto& stage : filterPipeline.getOrderedStages(analysisStages))
+	{
+		if (!(filterPipeline.evaluate(stage, [&]() { return isAcceptedByAnalysis(stage, optimalCrystalStructure); })))
+			return;
+	}
+
+
+	outputOptimalCrystalStructure(cifFilePath, optimalCrystalStructure);
 }
 
-void ExtractCrystals::eraseFilePathsInitially(std::queue<std::filesystem::path>& cifFilePaths) const
+std::vector<ExtractCrystals::FilterStage> ExtractCrystals::getScreeningStages() const
 {
-	for (size_type rep = 0; (!(cifFilePaths.empty()) && (rep < _threadRank)); ++rep)
-		cifFilePaths.pop();
+	std::vector<FilterStage> screeningStages;
+	{
+		if (_crystalScreeningParameters.needSpaceGroupScreening())
+			screeningStages.push_back(FilterStage::spaceGroupRange);
+
+		if (_crystalScreeningParameters.needChemicalElementScreening())
+			screeningStages.push_back(FilterStage::chemicalElements);
+
+		if (_crystalScreeningParameters.needNumAtomsScreening())
+			screeningStages.push_back(FilterStage::numAtoms);
+	}
+
+	return screeningStages;
 }
 
-void ExtractCrystals::eraseFilePathsForParallel(std::queue<std::filesystem::path>& cifFilePaths) const
+std::vector<ExtractCrystals::FilterStage> ExtractCrystals::getAnalysisStages() const
 {
-	for (size_type rep = 0; (!(cifFilePaths.empty()) && (rep < System::Parallel::ThreadingPolicy::maxThreading())); ++rep)
-		cifFilePaths.pop();
+	std::vector<FilterStage> analysisStages;
+	{
+		if (_isotypicCrystalExtractor.crystalIdentificationParameters().needExtraction())
+			analysisStages.push_back(FilterStage::isotypicCrystals);
+
+		if (_crystalOptimalityAnalyzer.isActive())
+			analysisStages.push_back(FilterStage::crystalOptimality);
+
+		if (_promisingCrystalExtractor.promisingCrystalExtractionParameters().needExtraction())
+			analysisStages.push_back(FilterStage::promisingCrystals);
+	}
+
+	return analysisStages;
+}
+
+bool ExtractCrystals::isAcceptedByScreening(const FilterStage stage, const SpaceGroupNumber declaredSpaceGroupNumber, const CrystallographicStructure& crystallographicStructure) const
+{
+	switch (stage)
+	{
+	case FilterStage::spaceGroupRange:
+		return !((declaredSpaceGroupNumber < _crystalScreeningParameters.spaceGroupRange().first) || (_crystalScreeningParameters.spaceGroupRange().second < declaredSpaceGroupNumber));
+
+	case FilterStage::chemicalElements:
+	{
+		for (const auto& atom : crystallographicStructure.atoms())
+		{
+			if (!(_crystalScreeningParameters.isAllowedAtomicNumber(atom.ionicAtomicNumber().atomicNumber())))
+				return false;
+		}
+
+		return true;
+	}
+
+	case FilterStage::numAtoms:
+		return !((crystallographicStructure.atoms().size() < _crystalScreeningParameters.numAtomsRange().first) || (_crystalScreeningParameters.numAtomsRange().second < crystallographicStructure.atoms().size()));
+
+	default:
+		throw System::ExceptionServices::InvalidOperationException{ typeid(*this), "isAcceptedByScreening", "The filter stage is not a screening stage." };
+	}
+}
+
+bool ExtractCrystals::isAcceptedByAnalysis(const FilterStage stage, const OptimalCrystalStructure& optimalCrystalStructure) const
+{
+	switch (stage)
+	{
+	case FilterStage::isotypicCrystals:
+		return _isotypicCrystalExtractor.isRegisteredCrystal(optimalCrystalStructure);
+
+	case FilterStage::crystalOptimality:
+		return _crystalOptimalityAnalyzer.isFeasible(optimalCrystalStructure);
+
+	case FilterStage::promisingCrystals:
+	{
+		OptimalCrystalStructure conventionalOptimalStructure = optimalCrystalStructure;
+		conventionalOptimalStructure.conventionalizeStructure(_spaceGroupPrecision);
+
+		return _promisingCrystalExtractor.isPromising(conventionalOptimalStructure);
+	}
+
+	default:
+		throw System::ExceptionServices::InvalidOperationException{ typeid(*this), "isAcceptedByAnalysis", "The filter stage is not an analysis stage." };
+	}
 }
 
 void ExtractCrystals::outputOptimalCrystalStructure(std::filesystem::path inputCifFilePath, const OptimalCrystalStructure& optimalCrystalStructure) const
 {
 	OptimalCrystalStructure conventionalOptimalStructure = optimalCrystalStructure;
 	conventionalOptimalStructure.conventionalizeStructure(_spaceGroupPrecision);
-	std::string structureFingerprint = conventionalOptimalStructure.toDetailedStructuralFingerprint();
+	std::string structureFingerprint;
+	StructuralHash structuralHash;
+	{
+		const auto uniqueOptimalAtoms = conventionalOptimalStructure.getUniqueOptimalAtoms();
+
+		structureFingerprint = conventionalOptimalStructure.toDetailedStructuralFingerprint(uniqueOptimalAtoms);
+		structuralHash = conventionalOptimalStructure.toDetailedStructuralHash(uniqueOptimalAtoms);
+	}
 
 	std::filesystem::path spaceGroupDirectoryPath = getSpaceGroupDirectoryPath(conventionalOptimalStructure.spaceGroupNumber(), optimalCrystalStructure.toChemicalComposition().toReducedChemicalComposition());
-	auto stateAndDirectory = getOutputDirectoryPath(structureFingerprint, spaceGroupDirectoryPath);
 
+	std::unique_lock<std::mutex> guard = s_outputDirectoryLocks.lock(spaceGroupDirectoryPath.generic_string());
+	System::IO::Directory::createDirectories(spaceGroupDirectoryPath, System::IO::Directory::CreateOptions::skip_existing);
+
+	constexpr size_type maxRepetitionCount = 50;
+	StructuralDescriptor structuralDescriptor;
 
-	if (stateAndDirectory.first)
-	{
-		System::IO::Directory::createDirectory(stateAndDirectory.second, System::IO::Directory::CreateOptions::none);
 
-		outputFeasibleCrystallographicData(conventionalOptimalStructure, stateAndDirectory.second);
+	// Other MPI processes publish into the same directories without sharing the lock, so a lost race is resolved by rescanning.
+	for (size_type rep = 0; rep < maxRepetitionCount; ++rep)
+	{
+		try
 		{
-			std::filesystem::path replicaCifFilePath = stateAndDirectory.second;
-			replicaCifFilePath /= inputCifFilePath.filename();
-			//System::IO::File::copy(inputCifFilePath, replicaCifFilePath, System::IO::File::CreateOptions::skip_existing);
+			auto stateAndDirectory = getOutputDirectoryPath(structureFingerprint, structuralHash, spaceGroupDirectoryPath);
+
+			if (stateAndDirectory.first && _nearDuplicateDetectionParameters.needDetection())
+			{
+				if (structuralDescriptor.isEmpty())
+					structuralDescriptor = conventionalOptimalStructure.toStructuralDescriptor(_nearDuplicateDetectionParameters.radialCutoff(), _nearDuplicateDetectionParameters.numRadialBins());
+
+				auto nearDuplicateAndDirectory = findNearDuplicateDirectoryPath(structuralDescriptor, spaceGroupDirectoryPath);
+
+				if (nearDuplicateAndDirectory.first)
+				{
+					std::filesystem::path nearDuplicatesFilePath = nearDuplicateAndDirectory.second;
+					nearDuplicatesFilePath /= s_nearDuplicatesFilename;
+
+					System::IO::FileStream nearDuplicatesStreamWriter{ nearDuplicatesFilePath, System::IO::FileStream::FileMode::append };
+					nearDuplicatesStreamWriter.write(inputCifFilePath.generic_string() + "\n");
+
+					++s_numNearDuplicates;
+					return;
+				}
+			}
+
+
+			if (stateAndDirectory.first)
+			{
+				publishOutputDirectory(conventionalOptimalStructure, structureFingerprint, structuralHash, structuralDescriptor, stateAndDirectory.second);
+				registerStructuralDescriptor(structuralDescriptor, spaceGroupDirectoryPath, stateAndDirectory.second);
+			}
+
+			return;
 		}
 
 
-		std::filesystem::path fingerprintFilePath = stateAndDirectory.second;
-		fingerprintFilePath /= s_fingerprintFilename;
+		catch (const System::ExceptionServices::IException&)
+		{
+			if ((1 + rep) < maxRepetitionCount)
+				continue;
+			else
+				throw;
+		}
 
-		System::IO::FileStream fingerprintStreamWriter{ fingerprintFilePath, System::IO::FileStream::FileMode::createNew };
-		fingerprintStreamWriter.write(structureFingerprint);
+		catch (const std::filesystem::filesystem_error&)
+		{
+			if ((1 + rep) < maxRepetitionCount)
+				continue;
+			else
+				throw;
+		}
 	}
 }
 
@@ -237,19 +383,22 @@ std::filesystem::path ExtractCrystals::getSpaceGroupDirectoryPath(const SpaceGro
 		spaceGroupDirectoryPath /= composition.toString();
 		spaceGroupDirectoryPath /= "SpaceGroup-";
 		spaceGroupDirectoryPath += std::to_string(spaceGroupNumber);
-
-		System::IO::Directory::createDirectories(spaceGroupDirectoryPath, System::IO::Directory::CreateOptions::skip_existing);
 	}
 
 	return spaceGroupDirectoryPath;
 }
 
-std::pair<bool, std::filesystem::path> ExtractCrystals::getOutputDirectoryPath(const std::string& outputFingerprint, const std::filesystem::path& spaceGroupPath) const
+std::pair<bool, std::filesystem::path> ExtractCrystals::getOutputDirectoryPath(const std::string& outputFingerprint, const StructuralHash& outputHash, const std::filesystem::path& spaceGroupPath) const
 {
+	const std::string outputHashTexts = outputHash.toString();
+
 	size_type numDirectory = 1;
 	{
 		for (const auto& directoryPath : System::IO::Directory::enumerateDirectories(spaceGroupPath, System::IO::Directory::SearchOptions::TopDirectoryOnly))
 		{
+			if (isStagingDirectoryPath(directoryPath))
+				continue;
+
 			std::vector<std::filesystem::path> fingerprintFilePaths = System::IO::Directory::enumerateFiles(directoryPath, s_fingerprintFilename);
 
 
@@ -261,6 +410,22 @@ std::pair<bool, std::filesystem::path> ExtractCrystals::getOutputDirectoryPath(c
 
 			else
 			{
+				// Equal fingerprints have equal hashes, so a differing hash rules a directory out without reading its fingerprint.
+				// Directories written before the hash file existed fall back to the fingerprint.
+				std::vector<std::filesystem::path> structuralHashFilePaths = System::IO::Directory::enumerateFiles(directoryPath, s_structuralHashFilename);
+
+				if (1 == structuralHashFilePaths.size())
+				{
+					System::IO::FileStream structuralHashStreamReader{ structuralHashFilePaths.back(), System::IO::FileStream::FileMode::openRead };
+
+					if (!(outputHashTexts == structuralHashStreamReader.readAllTexts()))
+					{
+						++numDirectory;
+						continue;
+					}
+				}
+
+
 				System::IO::FileStream fingerprintStreamReader{ fingerprintFilePaths.back(), System::IO::FileStream::FileMode::openRead };
 
 
@@ -280,6 +445,119 @@ std::pair<bool, std::filesystem::path> ExtractCrystals::getOutputDirectoryPath(c
 	return std::make_pair(true, outputDirectoryPath);
 }
 
+std::pair<bool, std::filesystem::path> ExtractCrystals::findNearDuplicateDirectoryPath(const StructuralDescriptor& structuralDescriptor, const std::filesystem::path& spaceGroupPath) const
+{
+	// Output directories are named by the reduced composition, but a small distortion can change the space group that spglib assigns,
+	// so the index spans every space group of the composition.
+	const std::filesystem::path compositionPath = spaceGroupPath.parent_path();
+
+	DescriptorIndex& descriptorIndex = getDescriptorIndex(compositionPath);
+	std::lock_guard<std::mutex> guard{ descriptorIndex.mutex };
+	{
+		for (const auto& siblingSpaceGroupPath : System::IO::Directory::enumerateDirectories(compositionPath, "SpaceGroup-([[:digit:]]+)"))
+		{
+			for (const auto& directoryPath : System::IO::Directory::enumerateDirectories(siblingSpaceGroupPath, System::IO::Directory::SearchOptions::TopDirectoryOnly))
+			{
+				if (isStagingDirectoryPath(directoryPath))
+					continue;
+
+				std::string directoryPathTexts = directoryPath.generic_string();
+
+				if (descriptorIndex.indexedDirectoryPaths.find(directoryPathTexts) == descriptorIndex.indexedDirectoryPaths.end())
+				{
+					std::vector<std::filesystem::path> descriptorFilePaths = System::IO::Directory::enumerateFiles(directoryPath, s_descriptorFilename);
+
+					if (1 == descriptorFilePaths.size())
+					{
+						System::IO::FileStream descriptorStreamReader{ descriptorFilePaths.back(), System::IO::FileStream::FileMode::openRead };
+
+						descriptorIndex.descriptorIndex.insert(StructuralDescriptor{ descriptorStreamReader.readAllTexts() });
+						descriptorIndex.descriptorDirectories.push_back(directoryPath);
+					}
+
+					descriptorIndex.indexedDirectoryPaths.insert(std::move(directoryPathTexts));
+				}
+			}
+		}
+	}
+
+
+	auto stateAndIndex = descriptorIndex.descriptorIndex.findMostSimilar(structuralDescriptor, _nearDuplicateDetectionParameters.similarityThreshold());
+
+	if (stateAndIndex.first)
+		return std::make_pair(true, descriptorIndex.descriptorDirectories[stateAndIndex.second]);
+	else
+		return std::make_pair(false, std::filesystem::path{});
+}
+
+void ExtractCrystals::registerStructuralDescriptor(const StructuralDescriptor& structuralDescriptor, const std::filesystem::path& spaceGroupPath, const std::filesystem::path& outputDirectoryPath) const
+{
+	if (!(structuralDescriptor.isEmpty()))
+	{
+		DescriptorIndex& descriptorIndex = getDescriptorIndex(spaceGroupPath.parent_path());
+		std::lock_guard<std::mutex> guard{ descriptorIndex.mutex };
+
+		descriptorIndex.descriptorIndex.insert(structuralDescriptor);
+		descriptorIndex.descriptorDirectories.push_back(outputDirectoryPath);
+		descriptorIndex.indexedDirectoryPaths.insert(outputDirectoryPath.generic_string());
+	}
+}
+
+ExtractCrystals::DescriptorIndex& ExtractCrystals::getDescriptorIndex(const std::filesystem::path& compositionPath) const
+{
+	// Only the lookup is guarded here; the returned entry is shared by all space groups of the composition and is used under its own mutex.
+	std::lock_guard<std::mutex> guard{ s_descriptorIndexMutex };
+	return s_descriptorIndices[compositionPath.generic_string()];
+}
+
+void ExtractCrystals::publishOutputDirectory(const OptimalCrystalStructure& conventionalOptimalStructure, const std::string& structureFingerprint, const StructuralHash& structuralHash, const StructuralDescriptor& structuralDescriptor, const std::filesystem::path& outputDirectoryPath) const
+{
+	std::filesystem::path stagingDirectoryPath = outputDirectoryPath.parent_path();
+	stagingDirectoryPath /= "." + outputDirectoryPath.filename().generic_string() + "." + System::Parallel::MpiPolicy::getMpiDirectoryName();
+
+	System::IO::Directory::createDirectory(stagingDirectoryPath, System::IO::Directory::CreateOptions::overwrite_existing);
+
+
+	outputFeasibleCrystallographicData(conventionalOptimalStructure, stagingDirectoryPath);
+
+	if (!(structuralDescriptor.isEmpty()))
+	{
+		std::filesystem::path descriptorFilePath = stagingDirectoryPath;
+		descriptorFilePath /= s_descriptorFilename;
+
+		System::IO::FileStream descriptorStreamWriter{ descriptorFilePath, System::IO::FileStream::FileMode::createNew };
+		descriptorStreamWriter.write(structuralDescriptor.toString());
+	}
+
+	{
+		std::filesystem::path fingerprintFilePath = stagingDirectoryPath;
+		fingerprintFilePath /= s_fingerprintFilename;
+
+		System::IO::FileStream fingerprintStreamWriter{ fingerprintFilePath, System::IO::FileStream::FileMode::createNew };
+		fingerprintStreamWriter.write(structureFingerprint);
+	}
+
+	{
+		std::filesystem::path structuralHashFilePath = stagingDirectoryPath;
+		structuralHashFilePath /= s_structuralHashFilename;
+
+		System::IO::FileStream structuralHashStreamWriter{ structuralHashFilePath, System::IO::FileStream::FileMode::createNew };
+		structuralHashStreamWriter.write(structuralHash.toString());
+	}
+
+
+	try
+	{
+		System::IO::Directory::move(stagingDirectoryPath, outputDirectoryPath, System::IO::Directory::CreateOptions::none);
+	}
+
+	catch (...)
+	{
+		System::IO::Directory::deleteDirectory(stagingDirectoryPath);
+		throw;
+	}
+}
+
 void ExtractCrystals::outputFeasibleCrystallographicData(const OptimalCrystalStructure& conventionalOptimalStructure, const std::filesystem::path& outputDirectoryPath) const
 {
 	std::filesystem::path conventionalCifFilePath = outputDirectoryPath;
@@ -289,6 +567,12 @@ void ExtractCrystals::outputFeasibleCrystallographicData(const OptimalCrystalStr
 	conventionalCifStreamWriter.writeCrystallographicStructure(conventionalOptimalStructure, _spaceGroupPrecision);
 }
 
+bool ExtractCrystals::isStagingDirectoryPath(const std::filesystem::path& directoryPath)
+{
+	const std::string directoryName = directoryPath.filename().generic_string();
+	return (!(directoryName.empty()) && (directoryName.front() == '.'));
+}
+
 // Private utility
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
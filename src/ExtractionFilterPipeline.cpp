@@ -0,0 +1,208 @@
+#include "ExtractionFilterPipeline.h"
+
+#include <algorithm>
+
+#include "StreamWriter.h"
+
+using namespace MathematicalCrystalChemistry::Extraction::Internal;
+
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Constructors
+
+ExtractionFilterPipeline::size_type ExtractionFilterPipeline::s_minimumEvaluations{ 16 };
+
+std::array<std::atomic<ExtractionFilterPipeline::size_type>, ExtractionFilterPipeline::s_numFilterStages> ExtractionFilterPipeline::s_numTotalAccepted{};
+std::array<std::atomic<ExtractionFilterPipeline::size_type>, ExtractionFilterPipeline::s_numFilterStages> ExtractionFilterPipeline::s_numTotalRejected{};
+std::array<std::atomic<std::int64_t>, ExtractionFilterPipeline::s_numFilterStages> ExtractionFilterPipeline::s_totalElapsedNanoseconds{};
+
+
+
+ExtractionFilterPipeline::ExtractionFilterPipeline() noexcept
+	: _needCostOrdering{ true }
+	, _filterStatistics{}
+{
+}
+
+ExtractionFilterPipeline::ExtractionFilterPipeline(const bool needCostOrdering) noexcept
+	: _needCostOrdering{ needCostOrdering }
+	, _filterStatistics{}
+{
+}
+
+// Constructors
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Methods
+
+std::vector<ExtractionFilterPipeline::FilterStage> ExtractionFilterPipeline::getOrderedStages(std::vector<FilterStage> stages) const
+{
+	if (_needCostOrdering)
+	{
+		for (const auto& stage : stages)
+		{
+			const FilterStatistics& statistics = _filterStatistics[toStageIndex(stage)];
+
+			if ((statistics.numAccepted + statistics.numRejected) < s_minimumEvaluations)
+				return stages;
+		}
+
+
+		// Running the stage with the least time spent per rejected structure first minimizes the expected cost of the whole chain.
+		std::stable_sort(stages.begin(), stages.end(), [this](const FilterStage forward, const FilterStage backward) { return (getCostPerRejection(forward) < getCostPerRejection(backward)); });
+	}
+
+	return stages;
+}
+
+void ExtractionFilterPipeline::recordEvaluation(const FilterStage stage, const bool isAccepted, const std::int64_t elapsedNanoseconds) noexcept
+{
+	const size_type stageIndex = toStageIndex(stage);
+
+	if (isAccepted)
+	{
+		++_filterStatistics[stageIndex].numAccepted;
+		++s_numTotalAccepted[stageIndex];
+	}
+
+	else
+	{
+		++_filterStatistics[stageIndex].numRejected;
+		++s_numTotalRejected[stageIndex];
+	}
+
+	_filterStatistics[stageIndex].elapsedNanoseconds += elapsedNanoseconds;
+	s_totalElapsedNanoseconds[stageIndex] += elapsedNanoseconds;
+}
+
+ExtractionFilterPipeline::FilterStatistics ExtractionFilterPipeline::getTotalStatistics(const FilterStage stage) noexcept
+{
+	const size_type stageIndex = toStageIndex(stage);
+	return FilterStatistics{ s_numTotalAccepted[stageIndex].load(), s_numTotalRejected[stageIndex].load(), s_totalElapsedNanoseconds[stageIndex].load() };
+}
+
+void ExtractionFilterPipeline::setTotalStatistics(const FilterStage stage, const FilterStatistics& statistics) noexcept
+{
+	const size_type stageIndex = toStageIndex(stage);
+
+	s_numTotalAccepted[stageIndex] = statistics.numAccepted;
+	s_numTotalRejected[stageIndex] = statistics.numRejected;
+	s_totalElapsedNanoseconds[stageIndex] = statistics.elapsedNanoseconds;
+}
+
+void ExtractionFilterPipeline::initializeTotalStatistics() noexcept
+{
+	for (size_type stageIndex = 0; stageIndex < s_numFilterStages; ++stageIndex)
+	{
+		s_numTotalAccepted[stageIndex] = 0;
+		s_numTotalRejected[stageIndex] = 0;
+		s_totalElapsedNanoseconds[stageIndex] = 0;
+	}
+}
+
+std::string ExtractionFilterPipeline::toStatisticsReport()
+{
+	System::IO::StreamWriter streamWriter;
+	{
+		for (size_type stageIndex = 0; stageIndex < s_numFilterStages; ++stageIndex)
+		{
+			const FilterStage stage = static_cast<FilterStage>(stageIndex);
+			const FilterStatistics statistics = getTotalStatistics(stage);
+
+			if (0 < (statistics.numAccepted + statistics.numRejected))
+			{
+				streamWriter.write(toStageName(stage));
+				streamWriter.write(": ");
+				streamWriter.write(statistics.numAccepted);
+				streamWriter.write(" accepted, ");
+				streamWriter.write(statistics.numRejected);
+				streamWriter.write(" rejected, ");
+				streamWriter.write(static_cast<double>(statistics.elapsedNanoseconds) * 1.0e-9, 3);
+				streamWriter.write(" s");
+				streamWriter.breakLine();
+			}
+		}
+	}
+
+	return streamWriter.allTexts();
+}
+
+// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+double ExtractionFilterPipeline::getCostPerRejection(const FilterStage stage) const noexcept
+{
+	const FilterStatistics& statistics = _filterStatistics[toStageIndex(stage)];
+
+	const double numEvaluations = static_cast<double>(statistics.numAccepted + statistics.numRejected);
+	const double meanElapsedNanoseconds = static_cast<double>(statistics.elapsedNanoseconds) / numEvaluations;
+	const double rejectionRate = (static_cast<double>(statistics.numRejected) + 1.0) / (numEvaluations + 2.0);
+
+	return (meanElapsedNanoseconds / rejectionRate);
+}
+
+std::string ExtractionFilterPipeline::toStageName(const FilterStage stage)
+{
+	switch (stage)
+	{
+	case FilterStage::spaceGroupRange:
+		return "Space group range";
+
+	case FilterStage::chemicalElements:
+		return "Chemical elements";
+
+	case FilterStage::numAtoms:
+		return "Number of atoms";
+
+	case FilterStage::isotypicCrystals:
+		return "Isotypic crystals";
+
+	case FilterStage::crystalOptimality:
+		return "Crystal optimality";
+
+	case FilterStage::promisingCrystals:
+		return "Promising crystals";
+
+	default:
+		return "Unknown";
+	}
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -15,10 +15,8 @@ using namespace MathematicalCrystalChemistry::CrystalModel::Constraints;
 // Constructors
 
 FeasiblePolyhedraConnections::FeasiblePolyhedraConnections() noexcept
-	: _dictionary{}
+	: _latticeDictionary{ FeasiblePolyhedraConnectionsDictionary::getLatticeDictionary() }
 {
-	for (const auto& keyAndComposition : FeasiblePolyhedraConnectionsDictionary::getDictionary())
-		_dictionary.emplace(keyAndComposition.first, keyAndComposition.second);
 }
 
 // Constructors
@@ -39,46 +37,12 @@ FeasiblePolyhedraConnections::FeasiblePolyhedraConnections() noexcept
 
 FeasiblePolyhedraConnections::ChemicalComposition FeasiblePolyhedraConnections::getClosestFeasibleCommonBridgingComposition(const IonicAtomicNumber& iana, const IonicAtomicNumber& ianb, const ChemicalComposition& commonBridgingComposition) const
 {
-	auto iter = _dictionary.find(getIonicAtomicNumberKey(iana, ianb));
+	const CommonBridgingCompositionLattice* commonBridgingCompositionLattice = findCommonBridgingCompositionLattice(iana, ianb);
 
-
-	if (iter == _dictionary.end())
+	if (commonBridgingCompositionLattice == nullptr)
 		return commonBridgingComposition;
-
 	else
-	{
-		ChemicalComposition closestComposition;
-		{
-			for (const auto& feasibleComposition : iter->second)
-			{
-				if (commonBridgingComposition < feasibleComposition)
-					break;
-
-				else if (feasibleComposition == commonBridgingComposition)
-					return commonBridgingComposition;
-
-				else
-				{
-					bool isLowerFeasibleComposition = true;
-					{
-						for (const auto& numAndCount : feasibleComposition)
-						{
-							if (commonBridgingComposition.count(numAndCount.first) < numAndCount.second)
-							{
-								isLowerFeasibleComposition = false;
-								break;
-							}
-						}
-					}
-
-					if (isLowerFeasibleComposition)
-						closestComposition = feasibleComposition;
-				}
-			}
-		}
-
-		return closestComposition;
-	}
+		return commonBridgingCompositionLattice->getClosestLowerFeasibleComposition(commonBridgingComposition);
 }
 
 // Methods
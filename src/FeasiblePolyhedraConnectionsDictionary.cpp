@@ -18,6 +18,7 @@ using namespace MathematicalCrystalChemistry::CrystalModel::Constraints;
 
 Internal::CoordinationPolyhedraConnectionParameters FeasiblePolyhedraConnectionsDictionary::s_coordinationPolyhedraConnectionParameters;
 std::unordered_map<std::pair<FeasiblePolyhedraConnectionsDictionary::IonicAtomicNumber, FeasiblePolyhedraConnectionsDictionary::IonicAtomicNumber>, std::vector<FeasiblePolyhedraConnectionsDictionary::BasicChemicalComposition>, FeasiblePolyhedraConnectionsDictionary::KeyHasher, FeasiblePolyhedraConnectionsDictionary::KeyEqual> FeasiblePolyhedraConnectionsDictionary::s_feasiblePolyhedraLinkingDictionary;
+std::shared_ptr<const FeasiblePolyhedraConnectionsDictionary::FeasibleLatticeDictionary> FeasiblePolyhedraConnectionsDictionary::s_feasiblePolyhedraLatticeDictionary;
 
 
 
@@ -26,6 +27,7 @@ void FeasiblePolyhedraConnectionsDictionary::initialize() noexcept
 	s_coordinationPolyhedraConnectionParameters.initialize();
 
 	s_feasiblePolyhedraLinkingDictionary.clear();
+	s_feasiblePolyhedraLatticeDictionary.reset();
 }
 
 void FeasiblePolyhedraConnectionsDictionary::initialize(const System::IO::StreamReader& streamReader)
@@ -57,6 +59,14 @@ void FeasiblePolyhedraConnectionsDictionary::initialize(const ConstrainingChemic
 			s_feasiblePolyhedraLinkingDictionary.emplace(pairAndBridgings.first, std::move(bridgingCompositions));
 		}
 	}
+
+	std::shared_ptr<FeasibleLatticeDictionary> feasiblePolyhedraLatticeDictionary = std::make_shared<FeasibleLatticeDictionary>();
+	{
+		for (const auto& pairAndBridgings : s_feasiblePolyhedraLinkingDictionary)
+			feasiblePolyhedraLatticeDictionary->emplace(pairAndBridgings.first, CommonBridgingCompositionLattice{ pairAndBridgings.second });
+	}
+
+	s_feasiblePolyhedraLatticeDictionary = std::move(feasiblePolyhedraLatticeDictionary);
 }
 
 // Methods
@@ -18,17 +18,24 @@ using namespace MathematicalCrystalChemistry::Design::Optimization;
 
 GeometricalConstraintParameters::size_type GeometricalConstraintParameters::s_defaultInteratomicDistanceTracerTimeout{ 100 };
 GeometricalConstraintParameters::size_type GeometricalConstraintParameters::s_defaultUnitCellReductionTimeout{ 200 };
+double GeometricalConstraintParameters::s_defaultMaxUnitCellSkewness{ 2.0 };
+double GeometricalConstraintParameters::s_defaultMinimumUnitCellAngle{ 45.0 };
 double GeometricalConstraintParameters::s_defaultMinimumExclusionDistanceRatio{ 1.3 };
 double GeometricalConstraintParameters::s_defaultInteratomicDistanceTracerCutoffRatio{ 4.0 };
 double GeometricalConstraintParameters::s_defaultInteratomicDistanceConstrainerCutoffRatio{ 2.0 };
+GeometricalConstraintParameters::size_type GeometricalConstraintParameters::s_defaultParallelConstrainingAtomThreshold{ 256 };
 
 
 GeometricalConstraintParameters::GeometricalConstraintParameters() noexcept
 	: _interatomicDistanceTracerTimeout{ s_defaultInteratomicDistanceTracerTimeout }
 	, _unitCellReductionTimeout{ s_defaultUnitCellReductionTimeout }
+	, _maxUnitCellSkewness{ s_defaultMaxUnitCellSkewness }
+	, _minimumUnitCellAngle{ s_defaultMinimumUnitCellAngle }
 	, _minimumExclusionDistanceRatio{ s_defaultMinimumExclusionDistanceRatio }
 	, _interatomicDistanceTracerCutoffRatio{ s_defaultInteratomicDistanceTracerCutoffRatio }
 	, _interatomicDistanceConstrainerCutoffRatio{ s_defaultInteratomicDistanceConstrainerCutoffRatio }
+	, _parallelConstrainingAtomThreshold{ s_defaultParallelConstrainingAtomThreshold }
+	, _needReductionValidation{ false }
 {
 }
 
@@ -52,9 +59,13 @@ void GeometricalConstraintParameters::initialize() noexcept
 {
 	_interatomicDistanceTracerTimeout = s_defaultInteratomicDistanceTracerTimeout;
 	_unitCellReductionTimeout = s_defaultUnitCellReductionTimeout;
+	_maxUnitCellSkewness = s_defaultMaxUnitCellSkewness;
+	_minimumUnitCellAngle = s_defaultMinimumUnitCellAngle;
 	_minimumExclusionDistanceRatio = s_defaultMinimumExclusionDistanceRatio;
 	_interatomicDistanceTracerCutoffRatio = s_defaultInteratomicDistanceTracerCutoffRatio;
 	_interatomicDistanceConstrainerCutoffRatio = s_defaultInteratomicDistanceConstrainerCutoffRatio;
+	_parallelConstrainingAtomThreshold = s_defaultParallelConstrainingAtomThreshold;
+	_needReductionValidation = false;
 }
 
 void GeometricalConstraintParameters::initialize(const System::IO::StreamReader& streamReader)
@@ -67,6 +78,12 @@ void GeometricalConstraintParameters::initialize(const System::IO::StreamReader&
 	if (!(streamReader.readParameter("Unit.Cell.Reduction.Timeout", _unitCellReductionTimeout)))
 		setUnitCellReductionTimeout();
 
+	if (!(streamReader.readParameter("Unit.Cell.Reduction.Skewness", _maxUnitCellSkewness)))
+		setMaxUnitCellSkewness();
+
+	if (!(streamReader.readParameter("Unit.Cell.Reduction.Angle", _minimumUnitCellAngle)))
+		setMinimumUnitCellAngle();
+
 	if (!(streamReader.readParameter("Minimum.Exclusion.Distance.Ratio", _minimumExclusionDistanceRatio)))
 		setMinimumExclusionDistanceRatio();
 	
@@ -76,6 +93,18 @@ void GeometricalConstraintParameters::initialize(const System::IO::StreamReader&
 	if (!(streamReader.readParameter("Interatomic.Distance.Constrainer.Cutoff.Ratio", _interatomicDistanceConstrainerCutoffRatio)))
 		setInteratomicDistanceConstrainerCutoffRatio();
 
+	if (!(streamReader.readParameter("Parallel.Constraining.Atom.Threshold", _parallelConstrainingAtomThreshold)))
+		setParallelConstrainingAtomThreshold();
+
+	{
+		std::string necessityTexts;
+
+		if (streamReader.readParameter("Unit.Cell.Reduction.Validation", necessityTexts))
+			_needReductionValidation = toNecessity(necessityTexts);
+		else
+			_needReductionValidation = false;
+	}
+
 
 	validateInitializedValues();
 }
@@ -104,6 +133,12 @@ void GeometricalConstraintParameters::validateInitializedValues()
 	if (_unitCellReductionTimeout == 0)
 		throw System::IO::InvalidFileException{ typeid(*this), "validateInitializedValues", "\"Unit.Cell.Reduction.Timeout\" is zero." };
 
+	if (_maxUnitCellSkewness <= 1.0)
+		throw System::IO::InvalidFileException{ typeid(*this), "validateInitializedValues", "\"Unit.Cell.Reduction.Skewness\" is not more than one." };
+
+	if ((_minimumUnitCellAngle <= 0.0) || (90.0 <= _minimumUnitCellAngle))
+		throw System::IO::InvalidFileException{ typeid(*this), "validateInitializedValues", "\"Unit.Cell.Reduction.Angle\" is out of range." };
+
 	if (_minimumExclusionDistanceRatio < 1.0)
 		throw System::IO::InvalidFileException{ typeid(*this), "validateInitializedValues", "\"Minimum.Exclusion.Distance.Ratio\" is less than zero." };
 
@@ -112,6 +147,21 @@ void GeometricalConstraintParameters::validateInitializedValues()
 
 	if (_interatomicDistanceConstrainerCutoffRatio < 1.0)
 		throw System::IO::InvalidFileException{ typeid(*this), "validateInitializedValues", "\"Interatomic.Distance.Constrainer.Cutoff.Ratio\" is less than one." };
+
+	if (_parallelConstrainingAtomThreshold == 0)
+		throw System::IO::InvalidFileException{ typeid(*this), "validateInitializedValues", "\"Parallel.Constraining.Atom.Threshold\" is zero." };
+}
+
+bool GeometricalConstraintParameters::toNecessity(const std::string& inputTexts) const
+{
+	if (inputTexts == "ON" || inputTexts == "On" || inputTexts == "on")
+		return true;
+
+	else if (inputTexts == "OFF" || inputTexts == "Off" || inputTexts == "off")
+		return false;
+
+	else
+		throw System::IO::InvalidFileException{ typeid(*this), "toNecessity", "Could not read necessity texts." };
 }
 
 // Private methods
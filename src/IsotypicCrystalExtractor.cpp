@@ -1,10 +1,15 @@
 #include "IsotypicCrystalExtractor.h"
 
+#include <algorithm>
+#include <fstream>
+#include <random>
+
 #include "InvalidOperationException.h"
 
 #include "Directory.h"
 #include "File.h"
 #include "FileStream.h"
+#include "IOException.h"
 
 #include "CifStreamReader.h"
 
@@ -20,6 +25,15 @@ using namespace MathematicalCrystalChemistry::Analysis;
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // Constructors
 
+std::string IsotypicCrystalExtractor::s_fingerprintIndexFilename{ "fingerprintIndex.bin" };
+std::uint64_t IsotypicCrystalExtractor::s_fingerprintIndexSignature{ 0x3130584449504346ULL };
+std::chrono::seconds IsotypicCrystalExtractor::s_fingerprintIndexRefreshInterval{ 60 };
+std::map<std::string, IsotypicCrystalExtractor::FingerprintIndexState> IsotypicCrystalExtractor::s_fingerprintIndices;
+std::mutex IsotypicCrystalExtractor::s_fingerprintIndexMutex;
+std::mutex IsotypicCrystalExtractor::s_fingerprintIndexUpdateMutex;
+
+
+
 IsotypicCrystalExtractor::IsotypicCrystalExtractor() noexcept
 	: _crystalIdentificationParameters{}
 {
@@ -50,11 +64,15 @@ bool IsotypicCrystalExtractor::isRegisteredCrystal(const OptimalCrystalStructure
 {
 	if (System::IO::Directory::exist(_crystalIdentificationParameters.databaseDirectoryPath()))
 	{
-		for (const auto& cifFilePath : System::IO::Directory::enumerateFiles(_crystalIdentificationParameters.databaseDirectoryPath(), std::string{ "([\\-\\_[:alnum:]]+)[\\.]{1}cif" }, System::IO::Directory::SearchOptions::AllDirectories))
-		{
-			std::string cifFingerprint = readFingerprint(cifFilePath);
+		const std::string structureFingerprint = optimalCrystalStructure.toStructuralFingerprint();
+		const std::pair<std::uint64_t, std::uint64_t> fingerprintHash = toFingerprintHash(structureFingerprint);
+
+		std::shared_ptr<const FingerprintIndex> fingerprintIndex = getFingerprintIndex();
+		auto iter = std::lower_bound(fingerprintIndex->begin(), fingerprintIndex->end(), fingerprintHash, [](const FingerprintIndexEntry& entry, const std::pair<std::uint64_t, std::uint64_t>& hash) { return (entry.fingerprintHash < hash); });
 
-			if (optimalCrystalStructure.toStructuralFingerprint() == readFingerprint(cifFilePath))
+		for (; (!(iter == fingerprintIndex->end()) && (iter->fingerprintHash == fingerprintHash)); ++iter)
+		{
+			if (structureFingerprint == readFingerprint(iter->cifFilePath))
 				return true;
 		}
 
@@ -65,6 +83,75 @@ bool IsotypicCrystalExtractor::isRegisteredCrystal(const OptimalCrystalStructure
 		throw System::ExceptionServices::InvalidOperationException{ typeid(*this), "isRegisteredCrystal", "Database directory path is not a path to a directory." };
 }
 
+void IsotypicCrystalExtractor::updateFingerprintIndex() const
+{
+	if (System::IO::Directory::exist(_crystalIdentificationParameters.databaseDirectoryPath()))
+	{
+		const std::filesystem::path databaseDirectoryPath = _crystalIdentificationParameters.databaseDirectoryPath();
+		const std::filesystem::path fingerprintIndexFilePath = databaseDirectoryPath / s_fingerprintIndexFilename;
+
+		std::lock_guard<std::mutex> updateGuard{ s_fingerprintIndexUpdateMutex };
+
+
+		std::map<std::string, FingerprintIndexEntry> pathAndEntry;
+		{
+			for (auto& entry : readFingerprintIndex(fingerprintIndexFilePath))
+				pathAndEntry.emplace(entry.cifFilePath.generic_string(), std::move(entry));
+		}
+
+		bool isModified = false;
+		std::size_t numReusedEntries = 0;
+
+		FingerprintIndex fingerprintIndex;
+		{
+			std::vector<std::filesystem::path> unindexedCifFilePaths;
+			std::vector<std::int64_t> unindexedLastWriteTimes;
+
+			for (const auto& cifFilePath : System::IO::Directory::enumerateFiles(databaseDirectoryPath, std::string{ "([\\-\\_[:alnum:]]+)[\\.]{1}cif" }, System::IO::Directory::SearchOptions::AllDirectories))
+			{
+				const std::int64_t lastWriteTime = getLastWriteTime(cifFilePath);
+				auto iter = pathAndEntry.find(cifFilePath.generic_string());
+
+				if (!(iter == pathAndEntry.end()) && (iter->second.lastWriteTime == lastWriteTime))
+				{
+					fingerprintIndex.push_back(iter->second);
+					++numReusedEntries;
+				}
+
+				else
+				{
+					unindexedCifFilePaths.push_back(cifFilePath);
+					unindexedLastWriteTimes.push_back(lastWriteTime);
+				}
+			}
+
+
+			const std::vector<std::string> structureFingerprints = readFingerprints(unindexedCifFilePaths);
+
+			for (std::size_t index = 0; index < unindexedCifFilePaths.size(); ++index)
+			{
+				fingerprintIndex.push_back(FingerprintIndexEntry{ toFingerprintHash(structureFingerprints[index]), unindexedLastWriteTimes[index], unindexedCifFilePaths[index] });
+				isModified = true;
+			}
+		}
+
+		if (numReusedEntries < pathAndEntry.size())
+			isModified = true;
+
+
+		std::sort(fingerprintIndex.begin(), fingerprintIndex.end(), [](const FingerprintIndexEntry& forward, const FingerprintIndexEntry& backward) { return (forward.fingerprintHash < backward.fingerprintHash); });
+
+		if (isModified)
+			writeFingerprintIndex(fingerprintIndexFilePath, fingerprintIndex);
+
+		std::lock_guard<std::mutex> guard{ s_fingerprintIndexMutex };
+		s_fingerprintIndices.insert_or_assign(databaseDirectoryPath.generic_string(), FingerprintIndexState{ std::make_shared<const FingerprintIndex>(std::move(fingerprintIndex)), std::chrono::steady_clock::now() });
+	}
+
+	else
+		throw System::ExceptionServices::InvalidOperationException{ typeid(*this), "updateFingerprintIndex", "Database directory path is not a path to a directory." };
+}
+
 // Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -83,45 +170,169 @@ bool IsotypicCrystalExtractor::isRegisteredCrystal(const OptimalCrystalStructure
 
 std::string IsotypicCrystalExtractor::readFingerprint(const std::filesystem::path& cifFilePath) const
 {
-	if (ChemToolkit::Crystallography::IO::CifStreamReader::isCorrectExtension(cifFilePath))
+	return readFingerprints(std::vector<std::filesystem::path>{ cifFilePath }).front();
+}
+
+std::vector<std::string> IsotypicCrystalExtractor::readFingerprints(const std::vector<std::filesystem::path>& cifFilePaths) const
+{
+	std::vector<std::string> structureFingerprints(cifFilePaths.size());
+
+	std::vector<std::size_t> unfingerprintedIndices;
+	std::vector<OptimalCrystalStructure> conventionalStructures;
+	{
+		for (std::size_t index = 0; index < cifFilePaths.size(); ++index)
+		{
+			if (!(ChemToolkit::Crystallography::IO::CifStreamReader::isCorrectExtension(cifFilePaths[index])))
+				throw System::ExceptionServices::ArgumentOutOfRangeException{ typeid(*this), "readFingerprints", "Argument file path is not a path to a cif file." };
+
+
+			const std::filesystem::path fingerprintFilePath = toFingerprintFilePath(cifFilePaths[index]);
+
+			if (System::IO::File::exist(fingerprintFilePath))
+			{
+				System::IO::FileStream fingerprintStreamReader{ fingerprintFilePath, System::IO::FileStream::FileMode::openRead };
+				structureFingerprints[index] = fingerprintStreamReader.readAllTexts();
+			}
+
+			else
+			{
+				ChemToolkit::Crystallography::IO::CifStreamReader cifStreamReader{ cifFilePaths[index] };
+				conventionalStructures.push_back(OptimalCrystalStructure{ cifStreamReader.readCrystallographicStructure() });
+				unfingerprintedIndices.push_back(index);
+			}
+		}
+	}
+
+
+	// Structures without a fingerprint file go through symmetry analysis as one batch on the thread pool.
+	OptimalCrystalStructure::conventionalizeStructures(conventionalStructures, _crystalIdentificationParameters.spaceGroupPrecision());
+
+	for (std::size_t index = 0; index < conventionalStructures.size(); ++index)
+	{
+		const std::string structureFingerprint = conventionalStructures[index].toStructuralFingerprint();
+
+		System::IO::FileStream fingerprintStreamWriter{ toFingerprintFilePath(cifFilePaths[unfingerprintedIndices[index]]), System::IO::FileStream::FileMode::createNew };
+		fingerprintStreamWriter.write(structureFingerprint);
+
+		structureFingerprints[unfingerprintedIndices[index]] = structureFingerprint;
+	}
+
+	return structureFingerprints;
+}
+
+std::shared_ptr<const IsotypicCrystalExtractor::FingerprintIndex> IsotypicCrystalExtractor::getFingerprintIndex() const
+{
+	const std::string databaseDirectoryName = _crystalIdentificationParameters.databaseDirectoryPath().generic_string();
+
 	{
-		std::filesystem::path fingerprintFilePath = cifFilePath.parent_path();
+		std::lock_guard<std::mutex> guard{ s_fingerprintIndexMutex };
+		auto iter = s_fingerprintIndices.find(databaseDirectoryName);
+
+		// One lookup per interval claims the refresh, and the others keep using the cached index meanwhile.
+		if (!(iter == s_fingerprintIndices.end()))
 		{
-			fingerprintFilePath /= cifFilePath.stem().string();
-			fingerprintFilePath += "_fingerprint.txt";
+			const auto currentTime = std::chrono::steady_clock::now();
+
+			if ((currentTime - iter->second.refreshTime) < s_fingerprintIndexRefreshInterval)
+				return iter->second.fingerprintIndex;
+			else
+				iter->second.refreshTime = currentTime;
 		}
+	}
+
+
+	updateFingerprintIndex();
+
+	std::lock_guard<std::mutex> guard{ s_fingerprintIndexMutex };
+	return s_fingerprintIndices.at(databaseDirectoryName).fingerprintIndex;
+}
 
+IsotypicCrystalExtractor::FingerprintIndex IsotypicCrystalExtractor::readFingerprintIndex(const std::filesystem::path& fingerprintIndexFilePath) const
+{
+	FingerprintIndex fingerprintIndex;
+
+	if (System::IO::File::exist(fingerprintIndexFilePath))
+	{
+		std::ifstream inputFileStream{ fingerprintIndexFilePath, std::ios_base::in | std::ios_base::binary };
 
-		if (System::IO::File::exist(fingerprintFilePath))
+		std::uint64_t signature = 0;
+		std::uint64_t numEntries = 0;
 		{
-			System::IO::FileStream fingerprintStreamReader{ fingerprintFilePath, System::IO::FileStream::FileMode::openRead };
-			return fingerprintStreamReader.readAllTexts();
+			inputFileStream.read(reinterpret_cast<char*>(&signature), sizeof(signature));
+			inputFileStream.read(reinterpret_cast<char*>(&numEntries), sizeof(numEntries));
 		}
 
-		else
+		if (!(inputFileStream) || (signature != s_fingerprintIndexSignature))
+			return FingerprintIndex{};
+		else if ((std::filesystem::file_size(fingerprintIndexFilePath) - (sizeof(signature) + sizeof(numEntries))) / (2 * sizeof(std::uint64_t)) < numEntries)
+			return FingerprintIndex{};
+
+
+		fingerprintIndex.resize(static_cast<std::size_t>(numEntries));
 		{
-			std::string structureFingerprint;
+			for (auto& entry : fingerprintIndex)
 			{
-				OptimalCrystalStructure conventionalStructure;
+				inputFileStream.read(reinterpret_cast<char*>(&entry.fingerprintHash.first), sizeof(entry.fingerprintHash.first));
+				inputFileStream.read(reinterpret_cast<char*>(&entry.fingerprintHash.second), sizeof(entry.fingerprintHash.second));
+			}
+
+			for (auto& entry : fingerprintIndex)
+			{
+				std::uint64_t pathLength = 0;
 				{
-					ChemToolkit::Crystallography::IO::CifStreamReader cifStreamReader{ cifFilePath };
-					conventionalStructure = OptimalCrystalStructure{ cifStreamReader.readCrystallographicStructure() };
+					inputFileStream.read(reinterpret_cast<char*>(&entry.lastWriteTime), sizeof(entry.lastWriteTime));
+					inputFileStream.read(reinterpret_cast<char*>(&pathLength), sizeof(pathLength));
 				}
 
-				conventionalStructure.conventionalizeStructure(_crystalIdentificationParameters.spaceGroupPrecision());
-				structureFingerprint = conventionalStructure.toStructuralFingerprint();
+				std::string relativePath(static_cast<std::size_t>(pathLength), '\0');
+				inputFileStream.read(relativePath.data(), static_cast<std::streamsize>(pathLength));
+
+				entry.cifFilePath = fingerprintIndexFilePath.parent_path() / std::filesystem::path{ relativePath };
 			}
+		}
+
+		if (!(inputFileStream))
+			return FingerprintIndex{};
+	}
+
+	return fingerprintIndex;
+}
 
+void IsotypicCrystalExtractor::writeFingerprintIndex(const std::filesystem::path& fingerprintIndexFilePath, const FingerprintIndex& fingerprintIndex) const
+{
+	std::filesystem::path temporaryFilePath = fingerprintIndexFilePath;
+	temporaryFilePath += "." + std::to_string(std::random_device{}());
 
-			System::IO::FileStream fingerprintStreamWriter{ fingerprintFilePath, System::IO::FileStream::FileMode::createNew };
-			fingerprintStreamWriter.write(structureFingerprint);
+	{
+		std::ofstream outputFileStream{ temporaryFilePath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc };
 
-			return structureFingerprint;
+		const std::uint64_t numEntries = static_cast<std::uint64_t>(fingerprintIndex.size());
+		{
+			outputFileStream.write(reinterpret_cast<const char*>(&s_fingerprintIndexSignature), sizeof(s_fingerprintIndexSignature));
+			outputFileStream.write(reinterpret_cast<const char*>(&numEntries), sizeof(numEntries));
+		}
+
+		for (const auto& entry : fingerprintIndex)
+		{
+			outputFileStream.write(reinterpret_cast<const char*>(&entry.fingerprintHash.first), sizeof(entry.fingerprintHash.first));
+			outputFileStream.write(reinterpret_cast<const char*>(&entry.fingerprintHash.second), sizeof(entry.fingerprintHash.second));
 		}
+
+		for (const auto& entry : fingerprintIndex)
+		{
+			const std::string relativePath = entry.cifFilePath.lexically_relative(fingerprintIndexFilePath.parent_path()).generic_string();
+			const std::uint64_t pathLength = static_cast<std::uint64_t>(relativePath.size());
+
+			outputFileStream.write(reinterpret_cast<const char*>(&entry.lastWriteTime), sizeof(entry.lastWriteTime));
+			outputFileStream.write(reinterpret_cast<const char*>(&pathLength), sizeof(pathLength));
+			outputFileStream.write(relativePath.data(), static_cast<std::streamsize>(pathLength));
+		}
+
+		if (!(outputFileStream))
+			throw System::IO::IOException{ typeid(*this), "writeFingerprintIndex", "Could not write the fingerprint index file." };
 	}
 
-	else
-		throw System::ExceptionServices::ArgumentOutOfRangeException{ typeid(*this), "readFingerprint", "Argument file path is not a path to a cif file." };
+	std::filesystem::rename(temporaryFilePath, fingerprintIndexFilePath);
 }
 
 // Private methods
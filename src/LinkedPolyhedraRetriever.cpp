@@ -1,5 +1,6 @@
 #include "LinkedPolyhedraRetriever.h"
 
+#include <algorithm>
 #include <unordered_map>
 
 using namespace MathematicalCrystalChemistry::CrystalModel::Components::Internal;
@@ -17,24 +18,32 @@ using namespace MathematicalCrystalChemistry::CrystalModel::Components::Internal
 LinkedPolyhedraRetriever::LinkedPolyhedraRetriever() noexcept
 	: CoordinationPolyhedraRetriever{}
 	, _feasiblePolyhedraConnections{}
+	, m_linkingDictionary{}
+	, m_polyhedraLinkingRecords{}
 {
 }
 
 LinkedPolyhedraRetriever::LinkedPolyhedraRetriever(const ChemToolkit::Crystallography::UnitCell& cell) noexcept
 	: CoordinationPolyhedraRetriever{ cell }
 	, _feasiblePolyhedraConnections{}
+	, m_linkingDictionary{}
+	, m_polyhedraLinkingRecords{}
 {
 }
 
 LinkedPolyhedraRetriever::LinkedPolyhedraRetriever(const ChemToolkit::Crystallography::UnitCell& cell, const std::vector<ConstrainingAtom>& atoms) noexcept
 	: CoordinationPolyhedraRetriever{ cell, atoms }
 	, _feasiblePolyhedraConnections{}
+	, m_linkingDictionary{}
+	, m_polyhedraLinkingRecords{}
 {
 }
 
 LinkedPolyhedraRetriever::LinkedPolyhedraRetriever(const ChemToolkit::Crystallography::UnitCell& cell, std::vector<ConstrainingAtom>&& atoms) noexcept
 	: CoordinationPolyhedraRetriever{ cell, std::move(atoms) }
 	, _feasiblePolyhedraConnections{}
+	, m_linkingDictionary{}
+	, m_polyhedraLinkingRecords{}
 {
 }
 
@@ -54,46 +63,112 @@ LinkedPolyhedraRetriever::LinkedPolyhedraRetriever(const ChemToolkit::Crystallog
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // Public methods
 
-LinkedPolyhedraRetriever::LinkingList LinkedPolyhedraRetriever::getCoordinationPolyhedraLinkings() const
+const LinkedPolyhedraRetriever::LinkingDictionary& LinkedPolyhedraRetriever::getCoordinationPolyhedraLinkings() const
 {
-	LinkingDictionary linkingDictionary;
+	updatePolyhedraLinkings();
+	return m_linkingDictionary;
+}
+
+// Public methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+void LinkedPolyhedraRetriever::updatePolyhedraLinkings() const
+{
+	for (size_type originalAtomIndex = static_cast<size_type>(atoms().size()); originalAtomIndex < m_polyhedraLinkingRecords.size(); ++originalAtomIndex)
+		erasePolyhedraLinkings(originalAtomIndex);
+
+	m_polyhedraLinkingRecords.resize(atoms().size());
+
+
+	for (size_type originalAtomIndex = 0; originalAtomIndex < atoms().size(); ++originalAtomIndex)
 	{
-		for (size_type originalAtomIndex = 0; originalAtomIndex < atoms().size(); ++originalAtomIndex)
+		std::vector<OriginalAtomIndex> chemicalBondedOriginalAtomIndices;
+		std::vector<TranslatedAtomIndex> chemicalBondedTranslatedAtomIndices;
 		{
-			std::vector<OriginalAtomIndex> chemicalBondedOriginalAtomIndices;
-			std::vector<TranslatedAtomIndex> chemicalBondedTranslatedAtomIndices;
-			{
-				for (const auto& originalBondedIndex : atoms()[originalAtomIndex].getCovalentBondedOriginalAtomIndices())
-					chemicalBondedOriginalAtomIndices.push_back(originalBondedIndex);
+			for (const auto& originalBondedIndex : atoms()[originalAtomIndex].getCovalentBondedOriginalAtomIndices())
+				chemicalBondedOriginalAtomIndices.push_back(originalBondedIndex);
+
+			for (const auto& originalBondedIndex : atoms()[originalAtomIndex].getIonicBondedOriginalAtomIndices())
+				chemicalBondedOriginalAtomIndices.push_back(originalBondedIndex);
+
+			for (const auto& translatedBondedIndex : atoms()[originalAtomIndex].getCovalentBondedTranslatedAtomIndices())
+				chemicalBondedTranslatedAtomIndices.push_back(translatedBondedIndex);
 
-				for (const auto& originalBondedIndex : atoms()[originalAtomIndex].getIonicBondedOriginalAtomIndices())
-					chemicalBondedOriginalAtomIndices.push_back(originalBondedIndex);
+			for (const auto& translatedBondedIndex : atoms()[originalAtomIndex].getIonicBondedTranslatedAtomIndices())
+				chemicalBondedTranslatedAtomIndices.push_back(translatedBondedIndex);
+		}
+
+		PolyhedraLinkingRecord& polyhedraLinkingRecord = m_polyhedraLinkingRecords[originalAtomIndex];
 
-				for (const auto& translatedBondedIndex : atoms()[originalAtomIndex].getCovalentBondedTranslatedAtomIndices())
-					chemicalBondedTranslatedAtomIndices.push_back(translatedBondedIndex);
+		if ((chemicalBondedOriginalAtomIndices != polyhedraLinkingRecord.chemicalBondedOriginalAtomIndices) || (chemicalBondedTranslatedAtomIndices != polyhedraLinkingRecord.chemicalBondedTranslatedAtomIndices))
+		{
+			erasePolyhedraLinkings(originalAtomIndex);
 
-				for (const auto& translatedBondedIndex : atoms()[originalAtomIndex].getIonicBondedTranslatedAtomIndices())
-					chemicalBondedTranslatedAtomIndices.push_back(translatedBondedIndex);
+			LinkingDictionary linkingDictionary;
+			{
+				addPolyhedraLinkings(originalAtomIndex, chemicalBondedOriginalAtomIndices, linkingDictionary);
+				addPolyhedraLinkings(originalAtomIndex, chemicalBondedTranslatedAtomIndices, linkingDictionary);
+				addPolyhedraLinkings(originalAtomIndex, chemicalBondedOriginalAtomIndices, chemicalBondedTranslatedAtomIndices, linkingDictionary);
 			}
 
+			insertPolyhedraLinkings(originalAtomIndex, linkingDictionary);
 
-			addPolyhedraLinkings(originalAtomIndex, chemicalBondedOriginalAtomIndices, linkingDictionary);
-			addPolyhedraLinkings(originalAtomIndex, chemicalBondedTranslatedAtomIndices, linkingDictionary);
-			addPolyhedraLinkings(originalAtomIndex, chemicalBondedOriginalAtomIndices, chemicalBondedTranslatedAtomIndices, linkingDictionary);
+			polyhedraLinkingRecord.chemicalBondedOriginalAtomIndices = std::move(chemicalBondedOriginalAtomIndices);
+			polyhedraLinkingRecord.chemicalBondedTranslatedAtomIndices = std::move(chemicalBondedTranslatedAtomIndices);
 		}
 	}
+}
 
+void LinkedPolyhedraRetriever::erasePolyhedraLinkings(const OriginalAtomIndex originalAtomIndex) const
+{
+	PolyhedraLinkingRecord& polyhedraLinkingRecord = m_polyhedraLinkingRecords[originalAtomIndex];
 
-	LinkingList coordinationPolyhedraLinkings;
+	for (const auto& linkingIndices : polyhedraLinkingRecord.linkingIndices)
 	{
-		for (const auto& linkingAndBridging : linkingDictionary)
-			coordinationPolyhedraLinkings.push_back(std::make_pair(linkingAndBridging.first, linkingAndBridging.second));
+		auto iter = m_linkingDictionary.find(linkingIndices);
+
+		if (!(iter == m_linkingDictionary.end()))
+		{
+			iter->second.erase(std::remove_if(iter->second.begin(), iter->second.end(), [originalAtomIndex](const TranslatedAtomIndex& bridgingIndex) { return (bridgingIndex.originalIndex() == originalAtomIndex); }), iter->second.end());
+
+			if (iter->second.empty())
+				m_linkingDictionary.erase(iter);
+		}
 	}
 
-	return coordinationPolyhedraLinkings;
+	polyhedraLinkingRecord.chemicalBondedOriginalAtomIndices.clear();
+	polyhedraLinkingRecord.chemicalBondedTranslatedAtomIndices.clear();
+	polyhedraLinkingRecord.linkingIndices.clear();
 }
 
-// Public methods
+void LinkedPolyhedraRetriever::insertPolyhedraLinkings(const OriginalAtomIndex originalAtomIndex, const LinkingDictionary& linkingDictionary) const
+{
+	PolyhedraLinkingRecord& polyhedraLinkingRecord = m_polyhedraLinkingRecords[originalAtomIndex];
+
+	for (const auto& linkingAndBridging : linkingDictionary)
+	{
+		std::vector<TranslatedAtomIndex>& bridgingIndices = m_linkingDictionary[linkingAndBridging.first];
+		auto position = std::upper_bound(bridgingIndices.begin(), bridgingIndices.end(), originalAtomIndex, [](const OriginalAtomIndex index, const TranslatedAtomIndex& bridgingIndex) { return (index < bridgingIndex.originalIndex()); });
+
+		bridgingIndices.insert(position, linkingAndBridging.second.begin(), linkingAndBridging.second.end());
+		polyhedraLinkingRecord.linkingIndices.push_back(linkingAndBridging.first);
+	}
+}
+
+// Private methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -12,7 +12,8 @@ int main(int argc, char* argv[])
 {
 	int mpiRank = 0;
 	int mpiProcessing = 1;
-	MPI_Init(&argc, &argv);
+	int mpiThreadSupport = MPI_THREAD_SINGLE;
+	MPI_Init_thread(&argc, &argv, MPI_THREAD_SERIALIZED, &mpiThreadSupport);
 	MPI_Comm_size(MPI_COMM_WORLD, &mpiProcessing);
 	MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
 
@@ -20,6 +21,7 @@ int main(int argc, char* argv[])
 	{
 		System::Parallel::MpiPolicy::setMpiRank(static_cast<std::size_t>(mpiRank));
 		System::Parallel::MpiPolicy::setMpiProcessing(static_cast<std::size_t>(mpiProcessing));
+		System::Parallel::MpiPolicy::setMpiThreadSerialized(MPI_THREAD_SERIALIZED <= mpiThreadSupport);
 
 		System::Marici::Program program(argc, argv);
 		program.execute();
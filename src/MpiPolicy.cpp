@@ -16,6 +16,7 @@ using namespace System::Parallel;
 
 MpiPolicy::size_type MpiPolicy::s_mpiRank{ 0 };
 MpiPolicy::size_type MpiPolicy::s_mpiProcessing{ 1 };
+bool MpiPolicy::s_isMpiThreadSerialized{ false };
 
 
 // Public methods
@@ -0,0 +1,146 @@
+#include "NearDuplicateDetectionParameters.h"
+
+#include "LengthCasting.h"
+
+#include "InvalidFileException.h"
+
+using namespace MathematicalCrystalChemistry::Design::Diagnostics;
+
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Constructors
+
+double NearDuplicateDetectionParameters::s_defaultSimilarityThreshold{ 0.995 };
+double NearDuplicateDetectionParameters::s_defaultRadialCutoff{ MathToolkit::UnitConversion::LengthCasting::cast<MathToolkit::UnitConversion::LengthCasting::Unit::Angstrom, MathToolkit::UnitConversion::LengthCasting::Unit::AtomicUnit>(6.0) };
+NearDuplicateDetectionParameters::size_type NearDuplicateDetectionParameters::s_defaultNumRadialBins{ 24 };
+
+
+NearDuplicateDetectionParameters::NearDuplicateDetectionParameters() noexcept
+	: _needDetection{ false }
+	, _similarityThreshold{ s_defaultSimilarityThreshold }
+	, _radialCutoff{ s_defaultRadialCutoff }
+	, _numRadialBins{ s_defaultNumRadialBins }
+{
+}
+
+// Constructors
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Methods
+
+void NearDuplicateDetectionParameters::initialize() noexcept
+{
+	_needDetection = false;
+	_similarityThreshold = s_defaultSimilarityThreshold;
+	_radialCutoff = s_defaultRadialCutoff;
+	_numRadialBins = s_defaultNumRadialBins;
+}
+
+void NearDuplicateDetectionParameters::initialize(const System::IO::StreamReader& genericStreamReader)
+{
+	{
+		std::string necessityTexts;
+
+		if (genericStreamReader.readParameter("Near.Duplicate.Detection", necessityTexts))
+			_needDetection = toNecessity(necessityTexts);
+		else
+			_needDetection = false;
+	}
+	{
+		double threshold = 0.0;
+
+		if (genericStreamReader.readParameter("Near.Duplicate.Similarity.Threshold", threshold))
+			_similarityThreshold = threshold;
+		else
+			_similarityThreshold = s_defaultSimilarityThreshold;
+	}
+	{
+		using namespace MathToolkit::UnitConversion;
+		double cutoffAngstrom = 0.0;
+
+		if (genericStreamReader.readParameter("Near.Duplicate.Radial.Cutoff", cutoffAngstrom))
+			_radialCutoff = LengthCasting::cast<LengthCasting::Unit::Angstrom, LengthCasting::Unit::AtomicUnit>(cutoffAngstrom);
+		else
+			_radialCutoff = s_defaultRadialCutoff;
+	}
+	{
+		int numBins = 0;
+
+		if (genericStreamReader.readParameter("Near.Duplicate.Radial.Bins", numBins))
+		{
+			if (0 < numBins)
+				_numRadialBins = static_cast<size_type>(numBins);
+			else
+				throw System::IO::InvalidFileException{ typeid(*this), "initialize", "\"Near.Duplicate.Radial.Bins\" is not more than zero." };
+		}
+
+		else
+			_numRadialBins = s_defaultNumRadialBins;
+	}
+
+
+	validateInitializedValues();
+}
+
+// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+bool NearDuplicateDetectionParameters::toNecessity(const std::string& inputTexts) const
+{
+	if (inputTexts == "ON" || inputTexts == "On" || inputTexts == "on")
+		return true;
+
+	else if (inputTexts == "OFF" || inputTexts == "Off" || inputTexts == "off")
+		return false;
+
+	else
+		throw System::IO::InvalidFileException{ typeid(*this), "toNecessity", "Could not read Near.Duplicate.Detection." };
+}
+
+void NearDuplicateDetectionParameters::validateInitializedValues() const
+{
+	if (!(0.0 < _similarityThreshold) || (1.0 < _similarityThreshold))
+		throw System::IO::InvalidFileException{ typeid(*this), "validateInitializedValues", "\"Near.Duplicate.Similarity.Threshold\" is not in the range of (0, 1]." };
+
+	if (!(0.0 < _radialCutoff))
+		throw System::IO::InvalidFileException{ typeid(*this), "validateInitializedValues", "\"Near.Duplicate.Radial.Cutoff\" is not more than zero." };
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -1,5 +1,7 @@
 #include "ObjectiveCrystalStructure.h"
 
+#include <algorithm>
+
 #include "ArgumentOutOfRangeException.h"
 
 #include "ConstrainingCrystalStructure.h"
@@ -33,7 +35,7 @@ ObjectiveCrystalStructure::ObjectiveCrystalStructure() noexcept
 {
 }
 
-ObjectiveCrystalStructure::ObjectiveCrystalStructure(const UnitCell& cell, const std::vector<SphericalAtom>& atoms, const std::vector<IonicAtomicNumber>& numbers, const std::vector<CoordinationConstraints>& coordinations) noexcept
+ObjectiveCrystalStructure::ObjectiveCrystalStructure(const UnitCell& cell, const std::vector<SphericalAtom>& atoms, const std::vector<IonicAtomicNumber>& numbers, const std::vector<CoordinationConstraintsHandle>& coordinations) noexcept
 	: CrystalStructure{ cell, atoms }
 	, _correspondingIonicAtomicNumbers{ numbers }
 	, _correspondingCoordinationConstraints{ coordinations }
@@ -50,7 +52,7 @@ ObjectiveCrystalStructure::ObjectiveCrystalStructure(const UnitCell& cell, const
 {
 }
 
-ObjectiveCrystalStructure::ObjectiveCrystalStructure(const UnitCell& cell, std::vector<SphericalAtom>&& atoms, std::vector<IonicAtomicNumber>&& numbers, std::vector<CoordinationConstraints>&& coordinations) noexcept
+ObjectiveCrystalStructure::ObjectiveCrystalStructure(const UnitCell& cell, std::vector<SphericalAtom>&& atoms, std::vector<IonicAtomicNumber>&& numbers, std::vector<CoordinationConstraintsHandle>&& coordinations) noexcept
 	: CrystalStructure{ cell, std::move(atoms) }
 	, _correspondingIonicAtomicNumbers{ std::move(numbers) }
 	, _correspondingCoordinationConstraints{ std::move(coordinations) }
@@ -86,85 +88,11 @@ ObjectiveCrystalStructure::ObjectiveCrystalStructure(const ConstrainingCrystalSt
 	{
 		atoms().push_back(SphericalAtom{ atom });
 		_correspondingIonicAtomicNumbers.push_back(atom.ionicAtomicNumber());
-		_correspondingCoordinationConstraints.push_back(atom.coordinationConstraints());
+		_correspondingCoordinationConstraints.push_back(atom.coordinationConstraintsHandle());
 	}
 
 
-	for (size_type originalIndex = 0; originalIndex < structure.atoms().size(); ++originalIndex)
-	{
-		const ConstrainingAtom& constrainingAtom = structure.atoms()[originalIndex];
-
-
-		for (size_type translatedOriginalIndex = (1 + originalIndex); translatedOriginalIndex < structure.atoms().size(); ++translatedOriginalIndex)
-		{
-			if (structure.isIonicAttractive(originalIndex, translatedOriginalIndex))
-			{
-				if (constrainingAtom.hasIonicBondWith(translatedOriginalIndex))
-					_ionicBondedIndices.push_back(ConstrainerIndices<OriginalAtomIndex>{ originalIndex, translatedOriginalIndex });
-
-				else
-				{
-					if (structure.isConstrainableIonicExclusionDistance(originalIndex, translatedOriginalIndex))
-						_ionicExcludedIndices.push_back(ConstrainerIndices<OriginalAtomIndex>{ originalIndex, translatedOriginalIndex });
-				}
-			}
-
-			else if (structure.isIonicRepulsive(originalIndex, translatedOriginalIndex))
-			{
-				if (constrainingAtom.hasCovalentBondWith(translatedOriginalIndex))
-					_covalentBondedIndices.push_back(ConstrainerIndices<OriginalAtomIndex>{ originalIndex, translatedOriginalIndex });
-
-				else
-				{
-					if (structure.isConstrainableIonicRepulsionDistance(originalIndex, translatedOriginalIndex))
-						_ionicRepulsedIndices.push_back(ConstrainerIndices<OriginalAtomIndex>{ originalIndex, translatedOriginalIndex });
-				}
-			}
-
-			else
-			{
-				if (constrainingAtom.hasCovalentBondWith(translatedOriginalIndex))
-					_covalentBondedIndices.push_back(ConstrainerIndices<OriginalAtomIndex>{ originalIndex, translatedOriginalIndex });
-
-				else
-				{
-					if (structure.isConstrainableCovalentExclusionDistance(originalIndex, translatedOriginalIndex))
-						_covalentExcludedIndices.push_back(ConstrainerIndices<OriginalAtomIndex>{ originalIndex, translatedOriginalIndex });
-				}
-			}
-		}
-	}
-
-
-	for (const auto& indices : structure.constrainingIndexPairs())
-	{
-		const ConstrainingAtom& constrainingAtom = structure.atoms()[indices.originalAtomIndex()];
-
-
-		if (structure.isIonicAttractive(indices.originalAtomIndex(), indices.translatedAtomIndex().originalIndex()))
-		{
-			if (constrainingAtom.hasIonicBondWith(indices.translatedAtomIndex()))
-				_translatedIonicBondedIndices.push_back(ConstrainerIndices<TranslatedAtomIndex>{ indices.originalAtomIndex(), indices.translatedAtomIndex() });
-			else
-				_translatedIonicExcludedIndices.push_back(ConstrainerIndices<TranslatedAtomIndex>{ indices.originalAtomIndex(), indices.translatedAtomIndex() });
-		}
-
-		else if (structure.isIonicRepulsive(indices.originalAtomIndex(), indices.translatedAtomIndex().originalIndex()))
-		{
-			if (constrainingAtom.hasCovalentBondWith(indices.translatedAtomIndex()))
-				_translatedCovalentBondedIndices.push_back(ConstrainerIndices<TranslatedAtomIndex>{ indices.originalAtomIndex(), indices.translatedAtomIndex() });
-			else
-				_translatedIonicRepulsedIndices.push_back(ConstrainerIndices<TranslatedAtomIndex>{ indices.originalAtomIndex(), indices.translatedAtomIndex() });
-		}
-
-		else
-		{
-			if (constrainingAtom.hasCovalentBondWith(indices.translatedAtomIndex()))
-				_translatedCovalentBondedIndices.push_back(ConstrainerIndices<TranslatedAtomIndex>{ indices.originalAtomIndex(), indices.translatedAtomIndex() });
-			else
-				_translatedCovalentExcludedIndices.push_back(ConstrainerIndices<TranslatedAtomIndex>{ indices.originalAtomIndex(), indices.translatedAtomIndex() });
-		}
-	}
+	importInteratomicDistanceConstraints(structure);
 }
 
 // Constructors
@@ -301,56 +229,86 @@ void ObjectiveCrystalStructure::import(const ConstrainingCrystalStructure& struc
 	{
 		atoms().push_back(SphericalAtom{ atom });
 		_correspondingIonicAtomicNumbers.push_back(atom.ionicAtomicNumber());
-		_correspondingCoordinationConstraints.push_back(atom.coordinationConstraints());
+		_correspondingCoordinationConstraints.push_back(atom.coordinationConstraintsHandle());
 	}
 
 
-	for (size_type originalIndex = 0; originalIndex < structure.atoms().size(); ++originalIndex)
-	{
-		const ConstrainingAtom& constrainingAtom = structure.atoms()[originalIndex];
-
+	importInteratomicDistanceConstraints(structure);
+}
 
-		for (size_type translatedOriginalIndex = (1 + originalIndex); translatedOriginalIndex < structure.atoms().size(); ++translatedOriginalIndex)
+void ObjectiveCrystalStructure::importInteratomicDistanceConstraints(const ConstrainingCrystalStructure& structure)
+{
+	auto importConstrainerIndices = [this, &structure](const OriginalAtomIndex originalIndex, const OriginalAtomIndex translatedOriginalIndex)
 		{
+			const ConstrainingAtom& constrainingAtom = structure.atoms()[originalIndex];
+
+
 			if (structure.isIonicAttractive(originalIndex, translatedOriginalIndex))
 			{
 				if (constrainingAtom.hasIonicBondWith(translatedOriginalIndex))
 					_ionicBondedIndices.push_back(ConstrainerIndices<OriginalAtomIndex>{ originalIndex, translatedOriginalIndex });
-
-				else
-				{
-					if (structure.isConstrainableIonicExclusionDistance(originalIndex, translatedOriginalIndex))
-						_ionicExcludedIndices.push_back(ConstrainerIndices<OriginalAtomIndex>{ originalIndex, translatedOriginalIndex });
-				}
+				else if (structure.isConstrainableIonicExclusionDistance(originalIndex, translatedOriginalIndex))
+					_ionicExcludedIndices.push_back(ConstrainerIndices<OriginalAtomIndex>{ originalIndex, translatedOriginalIndex });
 			}
 
 			else if (structure.isIonicRepulsive(originalIndex, translatedOriginalIndex))
 			{
 				if (constrainingAtom.hasCovalentBondWith(translatedOriginalIndex))
 					_covalentBondedIndices.push_back(ConstrainerIndices<OriginalAtomIndex>{ originalIndex, translatedOriginalIndex });
-
-				else
-				{
-					if (structure.isConstrainableIonicRepulsionDistance(originalIndex, translatedOriginalIndex))
-						_ionicRepulsedIndices.push_back(ConstrainerIndices<OriginalAtomIndex>{ originalIndex, translatedOriginalIndex });
-				}
+				else if (structure.isConstrainableIonicRepulsionDistance(originalIndex, translatedOriginalIndex))
+					_ionicRepulsedIndices.push_back(ConstrainerIndices<OriginalAtomIndex>{ originalIndex, translatedOriginalIndex });
 			}
 
 			else
 			{
 				if (constrainingAtom.hasCovalentBondWith(translatedOriginalIndex))
 					_covalentBondedIndices.push_back(ConstrainerIndices<OriginalAtomIndex>{ originalIndex, translatedOriginalIndex });
+				else if (structure.isConstrainableCovalentExclusionDistance(originalIndex, translatedOriginalIndex))
+					_covalentExcludedIndices.push_back(ConstrainerIndices<OriginalAtomIndex>{ originalIndex, translatedOriginalIndex });
+			}
+		};
 
-				else
+
+	std::vector<std::vector<OriginalAtomIndex>> neighborIndices = structure.getConstrainableNeighborIndices();
+
+	if (neighborIndices.empty())
+	{
+		for (size_type originalIndex = 0; originalIndex < structure.atoms().size(); ++originalIndex)
+		{
+			for (size_type translatedOriginalIndex = (1 + originalIndex); translatedOriginalIndex < structure.atoms().size(); ++translatedOriginalIndex)
+				importConstrainerIndices(originalIndex, translatedOriginalIndex);
+		}
+	}
+
+	else
+	{
+		for (size_type originalIndex = 0; originalIndex < structure.atoms().size(); ++originalIndex)
+		{
+			std::vector<OriginalAtomIndex>& candidateIndices = neighborIndices[originalIndex];
+			const std::size_t numNeighbors = candidateIndices.size();
+
+			// Bonded partners beyond the neighbouring bins still yield a constraint.
+			for (const auto& bondedIndices : { structure.atoms()[originalIndex].getCovalentBondedOriginalAtomIndices(), structure.atoms()[originalIndex].getIonicBondedOriginalAtomIndices() })
+			{
+				for (const auto& index : bondedIndices)
 				{
-					if (structure.isConstrainableCovalentExclusionDistance(originalIndex, translatedOriginalIndex))
-						_covalentExcludedIndices.push_back(ConstrainerIndices<OriginalAtomIndex>{ originalIndex, translatedOriginalIndex });
+					if ((index > originalIndex) && !(std::binary_search(candidateIndices.begin(), candidateIndices.begin() + numNeighbors, index)))
+						candidateIndices.push_back(index);
 				}
 			}
+
+			if (candidateIndices.size() > numNeighbors)
+			{
+				std::sort(candidateIndices.begin(), candidateIndices.end());
+				candidateIndices.erase(std::unique(candidateIndices.begin(), candidateIndices.end()), candidateIndices.end());
+			}
+
+
+			for (const auto& translatedOriginalIndex : candidateIndices)
+				importConstrainerIndices(originalIndex, translatedOriginalIndex);
 		}
 	}
 
-
 	for (const auto& indices : structure.constrainingIndexPairs())
 	{
 		const ConstrainingAtom& constrainingAtom = structure.atoms()[indices.originalAtomIndex()];
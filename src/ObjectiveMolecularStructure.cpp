@@ -28,7 +28,7 @@ ObjectiveMolecularStructure::ObjectiveMolecularStructure() noexcept
 {
 }
 
-ObjectiveMolecularStructure::ObjectiveMolecularStructure(const UnitCell& cell, const std::vector<SphericalAtom>& atoms, const std::vector<IonicAtomicNumber>& numbers, const std::vector<CoordinationConstraints>& coordinations) noexcept
+ObjectiveMolecularStructure::ObjectiveMolecularStructure(const UnitCell& cell, const std::vector<SphericalAtom>& atoms, const std::vector<IonicAtomicNumber>& numbers, const std::vector<CoordinationConstraintsHandle>& coordinations) noexcept
 	: CrystalStructure{ cell, atoms }
 	, _correspondingIonicAtomicNumbers{ numbers }
 	, _correspondingCoordinationConstraints{ coordinations }
@@ -40,7 +40,7 @@ ObjectiveMolecularStructure::ObjectiveMolecularStructure(const UnitCell& cell, c
 {
 }
 
-ObjectiveMolecularStructure::ObjectiveMolecularStructure(const UnitCell& cell, std::vector<SphericalAtom>&& atoms, std::vector<IonicAtomicNumber>&& numbers, std::vector<CoordinationConstraints>&& coordinations) noexcept
+ObjectiveMolecularStructure::ObjectiveMolecularStructure(const UnitCell& cell, std::vector<SphericalAtom>&& atoms, std::vector<IonicAtomicNumber>&& numbers, std::vector<CoordinationConstraintsHandle>&& coordinations) noexcept
 	: CrystalStructure{ cell, std::move(atoms) }
 	, _correspondingIonicAtomicNumbers{ std::move(numbers) }
 	, _correspondingCoordinationConstraints{ std::move(coordinations) }
@@ -66,7 +66,7 @@ ObjectiveMolecularStructure::ObjectiveMolecularStructure(const ConstrainingMolec
 	{
 		atoms().push_back(SphericalAtom{ atom });
 		_correspondingIonicAtomicNumbers.push_back(atom.ionicAtomicNumber());
-		_correspondingCoordinationConstraints.push_back(atom.coordinationConstraints());
+		_correspondingCoordinationConstraints.push_back(atom.coordinationConstraintsHandle());
 	}
 
 
@@ -201,7 +201,7 @@ void ObjectiveMolecularStructure::import(const ConstrainingMolecularStructure& s
 	{
 		atoms().push_back(SphericalAtom{ atom });
 		_correspondingIonicAtomicNumbers.push_back(atom.ionicAtomicNumber());
-		_correspondingCoordinationConstraints.push_back(atom.coordinationConstraints());
+		_correspondingCoordinationConstraints.push_back(atom.coordinationConstraintsHandle());
 	}
 
 
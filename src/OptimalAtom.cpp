@@ -96,6 +96,30 @@ void OptimalAtom::addFaceSharings(const std::pair<IonicAtomicNumber, std::vector
 	std::sort(_faceSharings.begin(), _faceSharings.end());
 }
 
+void OptimalAtom::setCoordinations(std::vector<IonicAtomicNumber>&& coordinations) noexcept
+{
+	_coordinations = std::move(coordinations);
+	std::sort(_coordinations.begin(), _coordinations.end());
+}
+
+void OptimalAtom::setVertexSharings(std::vector<std::pair<IonicAtomicNumber, IonicAtomicNumber>>&& sharings) noexcept
+{
+	_vertexSharings = std::move(sharings);
+	std::sort(_vertexSharings.begin(), _vertexSharings.end());
+}
+
+void OptimalAtom::setEdgeSharings(std::vector<std::pair<IonicAtomicNumber, std::array<IonicAtomicNumber, 2>>>&& sharings) noexcept
+{
+	_edgeSharings = std::move(sharings);
+	std::sort(_edgeSharings.begin(), _edgeSharings.end());
+}
+
+void OptimalAtom::setFaceSharings(std::vector<std::pair<IonicAtomicNumber, std::vector<IonicAtomicNumber>>>&& sharings) noexcept
+{
+	_faceSharings = std::move(sharings);
+	std::sort(_faceSharings.begin(), _faceSharings.end());
+}
+
 // Property
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -183,6 +207,81 @@ std::string OptimalAtom::getDetailedFingerprint() const
 	return streamWriter.allTexts();
 }
 
+StructuralHash OptimalAtom::getFingerprintHash() const
+{
+	StructuralHash structuralHash;
+	{
+		if (siteSymmetrySymbol().isValid())
+		{
+			structuralHash.add(static_cast<std::string>(siteSymmetrySymbol()));
+
+			structuralHash.add(static_cast<std::uint64_t>(_coordinations.size()));
+			structuralHash.add(static_cast<std::uint64_t>(_vertexSharings.size()));
+			structuralHash.add(static_cast<std::uint64_t>(_edgeSharings.size()));
+			structuralHash.add(static_cast<std::uint64_t>(_faceSharings.size()));
+		}
+
+		else
+			throw System::ExceptionServices::InvalidOperationException{ typeid(*this), "getFingerprintHash", "Site symmetry symbol is empty." };
+	}
+
+	return structuralHash;
+}
+
+StructuralHash OptimalAtom::getDetailedFingerprintHash() const
+{
+	StructuralHash structuralHash;
+	{
+		if (siteSymmetrySymbol().isValid())
+		{
+			structuralHash.add(static_cast<std::string>(siteSymmetrySymbol()));
+
+			structuralHash.add(static_cast<std::uint64_t>(_coordinations.size()));
+			{
+				for (const auto& coordination : _coordinations)
+					addIonicAtomicNumber(structuralHash, coordination);
+			}
+
+			structuralHash.add(static_cast<std::uint64_t>(_vertexSharings.size()));
+			{
+				for (const auto& vertexSharing : _vertexSharings)
+				{
+					addIonicAtomicNumber(structuralHash, vertexSharing.first);
+					addIonicAtomicNumber(structuralHash, vertexSharing.second);
+				}
+			}
+
+			structuralHash.add(static_cast<std::uint64_t>(_edgeSharings.size()));
+			{
+				for (const auto& edgeSharing : _edgeSharings)
+				{
+					addIonicAtomicNumber(structuralHash, edgeSharing.first);
+
+					for (const auto& bridging : edgeSharing.second)
+						addIonicAtomicNumber(structuralHash, bridging);
+				}
+			}
+
+			structuralHash.add(static_cast<std::uint64_t>(_faceSharings.size()));
+			{
+				for (const auto& faceSharing : _faceSharings)
+				{
+					addIonicAtomicNumber(structuralHash, faceSharing.first);
+					structuralHash.add(static_cast<std::uint64_t>(faceSharing.second.size()));
+
+					for (const auto& bridging : faceSharing.second)
+						addIonicAtomicNumber(structuralHash, bridging);
+				}
+			}
+		}
+
+		else
+			throw System::ExceptionServices::InvalidOperationException{ typeid(*this), "getDetailedFingerprintHash", "Site symmetry symbol is empty." };
+	}
+
+	return structuralHash;
+}
+
 // Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -292,6 +391,14 @@ void OptimalAtom::writeFaceSharings(System::IO::StreamWriter& streamWriter) cons
 	streamWriter.breakLine();
 }
 
+void OptimalAtom::addIonicAtomicNumber(StructuralHash& structuralHash, const IonicAtomicNumber& ionicAtomicNumber) noexcept
+{
+	const std::uint64_t atomicNumber = static_cast<std::uint64_t>(static_cast<unsigned short>(ionicAtomicNumber.atomicNumber()));
+	const std::uint64_t formalCharge = static_cast<std::uint64_t>(static_cast<unsigned short>(static_cast<short>(ionicAtomicNumber.formalCharge())));
+
+	structuralHash.add((atomicNumber << 16) | formalCharge);
+}
+
 // Private methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -1,6 +1,9 @@
 #include "OptimalCrystalStructure.h"
 
+#include <cmath>
 #include <map>
+#include <string>
+#include <unordered_map>
 #include <vector>
 #include <regex>
 
@@ -53,78 +56,7 @@ OptimalCrystalStructure::OptimalCrystalStructure(const CrystallographicStructure
 OptimalCrystalStructure::OptimalCrystalStructure(const ConstrainingCrystalStructure& structure)
 	: CrystallographicStructure{ structure.unitCell() }
 {
-	std::vector<OptimalAtom> atomicArrangement;
-	{
-		for (const auto& constrainingAtom : structure.atoms())
-			atomicArrangement.push_back(OptimalAtom{ constrainingAtom });
-
-
-		for (size_type index = 0; index < atomicArrangement.size(); ++index)
-		{
-			for (const auto& originalAtomIndex : structure.atoms()[index].getCovalentBondedOriginalAtomIndices())
-				atomicArrangement[index].addCoordination(structure.atoms().at(originalAtomIndex).ionicAtomicNumber());
-
-			for (const auto& originalAtomIndex : structure.atoms()[index].getIonicBondedOriginalAtomIndices())
-				atomicArrangement[index].addCoordination(structure.atoms().at(originalAtomIndex).ionicAtomicNumber());
-
-			for (const auto& translatedAtomIndex : structure.atoms()[index].getCovalentBondedTranslatedAtomIndices())
-				atomicArrangement[index].addCoordination(structure.atoms().at(translatedAtomIndex.originalIndex()).ionicAtomicNumber());
-
-			for (const auto& translatedAtomIndex : structure.atoms()[index].getIonicBondedTranslatedAtomIndices())
-				atomicArrangement[index].addCoordination(structure.atoms().at(translatedAtomIndex.originalIndex()).ionicAtomicNumber());
-		}
-
-
-		for (const auto& coordinationPolyhedraLinking : structure.getCoordinationPolyhedraLinkings())
-		{
-			if (1 == coordinationPolyhedraLinking.second.size())
-			{
-				OptimalAtom& originalAtom = atomicArrangement.at(coordinationPolyhedraLinking.first.originalAtomIndex());
-				OptimalAtom& translatedAtom = atomicArrangement.at(coordinationPolyhedraLinking.first.translatedAtomIndex().originalIndex());
-
-				const OptimalAtom& vertexAtom = atomicArrangement.at(coordinationPolyhedraLinking.second.back().originalIndex());
-				IonicAtomicNumber vertexAtomicNumber{ vertexAtom.ionicAtomicNumber() };
-
-				originalAtom.addVertexSharings(std::make_pair(translatedAtom.ionicAtomicNumber(), vertexAtomicNumber));
-				translatedAtom.addVertexSharings(std::make_pair(originalAtom.ionicAtomicNumber(), vertexAtomicNumber));
-			}
-
-			else if (2 == coordinationPolyhedraLinking.second.size())
-			{
-				OptimalAtom& originalAtom = atomicArrangement.at(coordinationPolyhedraLinking.first.originalAtomIndex());
-				OptimalAtom& translatedAtom = atomicArrangement.at(coordinationPolyhedraLinking.first.translatedAtomIndex().originalIndex());
-
-				std::array<IonicAtomicNumber, 2> edgeAtomicNumbers;
-				{
-					edgeAtomicNumbers[0] = atomicArrangement[coordinationPolyhedraLinking.second[0].originalIndex()].ionicAtomicNumber();
-					edgeAtomicNumbers[1] = atomicArrangement[coordinationPolyhedraLinking.second[1].originalIndex()].ionicAtomicNumber();
-				}
-
-				originalAtom.addEdgeSharings(std::make_pair(translatedAtom.ionicAtomicNumber(), edgeAtomicNumbers));
-				translatedAtom.addEdgeSharings(std::make_pair(originalAtom.ionicAtomicNumber(), edgeAtomicNumbers));
-			}
-
-			else if (2 < coordinationPolyhedraLinking.second.size())
-			{
-				OptimalAtom& originalAtom = atomicArrangement.at(coordinationPolyhedraLinking.first.originalAtomIndex());
-				OptimalAtom& translatedAtom = atomicArrangement.at(coordinationPolyhedraLinking.first.translatedAtomIndex().originalIndex());
-
-				std::vector<IonicAtomicNumber> faceAtomicNumbers;
-				{
-					for (const auto& translatedIndex : coordinationPolyhedraLinking.second)
-						faceAtomicNumbers.push_back(atomicArrangement[translatedIndex.originalIndex()].ionicAtomicNumber());
-				}
-
-				originalAtom.addFaceSharings(std::make_pair(translatedAtom.ionicAtomicNumber(), faceAtomicNumbers));
-				translatedAtom.addFaceSharings(std::make_pair(originalAtom.ionicAtomicNumber(), faceAtomicNumbers));
-			}
-
-			else
-				throw System::ExceptionServices::InvalidOperationException{ typeid(*this), "import", "The number of common bridging atoms is zero." };
-		}
-	}
-
-	CrystallographicStructure::setAtoms(std::move(atomicArrangement));
+	CrystallographicStructure::setAtoms(buildAtomicArrangement(structure));
 }
 
 // Constructors
@@ -152,76 +84,7 @@ void OptimalCrystalStructure::import(const ConstrainingCrystalStructure& structu
 {
 	initialize();
 	
-	std::vector<OptimalAtom> atomicArrangement;
-	{
-		for (const auto& constrainingAtom : structure.atoms())
-			atomicArrangement.push_back(OptimalAtom{ constrainingAtom });
-
-
-		for (size_type index = 0; index < atomicArrangement.size(); ++index)
-		{
-			for (const auto& originalAtomIndex : structure.atoms()[index].getCovalentBondedOriginalAtomIndices())
-				atomicArrangement[index].addCoordination(structure.atoms().at(originalAtomIndex).ionicAtomicNumber());
-
-			for (const auto& originalAtomIndex : structure.atoms()[index].getIonicBondedOriginalAtomIndices())
-				atomicArrangement[index].addCoordination(structure.atoms().at(originalAtomIndex).ionicAtomicNumber());
-
-			for (const auto& translatedAtomIndex : structure.atoms()[index].getCovalentBondedTranslatedAtomIndices())
-				atomicArrangement[index].addCoordination(structure.atoms().at(translatedAtomIndex.originalIndex()).ionicAtomicNumber());
-
-			for (const auto& translatedAtomIndex : structure.atoms()[index].getIonicBondedTranslatedAtomIndices())
-				atomicArrangement[index].addCoordination(structure.atoms().at(translatedAtomIndex.originalIndex()).ionicAtomicNumber());
-		}
-
-
-		for (const auto& coordinationPolyhedraLinking : structure.getCoordinationPolyhedraLinkings())
-		{
-			if (1 == coordinationPolyhedraLinking.second.size())
-			{
-				OptimalAtom& originalAtom = atomicArrangement.at(coordinationPolyhedraLinking.first.originalAtomIndex());
-				OptimalAtom& translatedAtom = atomicArrangement.at(coordinationPolyhedraLinking.first.translatedAtomIndex().originalIndex());
-
-				const OptimalAtom& vertexAtom = atomicArrangement.at(coordinationPolyhedraLinking.second.back().originalIndex());
-				IonicAtomicNumber vertexAtomicNumber{ vertexAtom.ionicAtomicNumber() };
-
-				originalAtom.addVertexSharings(std::make_pair(translatedAtom.ionicAtomicNumber(), vertexAtomicNumber));
-				translatedAtom.addVertexSharings(std::make_pair(originalAtom.ionicAtomicNumber(), vertexAtomicNumber));
-			}
-
-			else if (2 == coordinationPolyhedraLinking.second.size())
-			{
-				OptimalAtom& originalAtom = atomicArrangement.at(coordinationPolyhedraLinking.first.originalAtomIndex());
-				OptimalAtom& translatedAtom = atomicArrangement.at(coordinationPolyhedraLinking.first.translatedAtomIndex().originalIndex());
-
-				std::array<IonicAtomicNumber, 2> edgeAtomicNumbers;
-				{
-					edgeAtomicNumbers[0] = atomicArrangement[coordinationPolyhedraLinking.second[0].originalIndex()].ionicAtomicNumber();
-					edgeAtomicNumbers[1] = atomicArrangement[coordinationPolyhedraLinking.second[1].originalIndex()].ionicAtomicNumber();
-				}
-
-				originalAtom.addEdgeSharings(std::make_pair(translatedAtom.ionicAtomicNumber(), edgeAtomicNumbers));
-				translatedAtom.addEdgeSharings(std::make_pair(originalAtom.ionicAtomicNumber(), edgeAtomicNumbers));
-			}
-
-			else if (2 < coordinationPolyhedraLinking.second.size())
-			{
-				OptimalAtom& originalAtom = atomicArrangement.at(coordinationPolyhedraLinking.first.originalAtomIndex());
-				OptimalAtom& translatedAtom = atomicArrangement.at(coordinationPolyhedraLinking.first.translatedAtomIndex().originalIndex());
-
-				std::vector<IonicAtomicNumber> faceAtomicNumbers;
-				{
-					for (const auto& translatedIndex : coordinationPolyhedraLinking.second)
-						faceAtomicNumbers.push_back(atomicArrangement[translatedIndex.originalIndex()].ionicAtomicNumber());
-				}
-
-				originalAtom.addFaceSharings(std::make_pair(translatedAtom.ionicAtomicNumber(), faceAtomicNumbers));
-				translatedAtom.addFaceSharings(std::make_pair(originalAtom.ionicAtomicNumber(), faceAtomicNumbers));
-			}
-
-			else
-				throw System::ExceptionServices::InvalidOperationException{ typeid(*this), "import", "The number of common bridging atoms is zero." };
-		}
-	}
+	std::vector<OptimalAtom> atomicArrangement = buildAtomicArrangement(structure);
 
 	setUnitCell(ChemToolkit::Crystallography::UnitCell{ structure.unitCell().basisVectors() });
 	setAtoms(std::move(atomicArrangement));
@@ -261,10 +124,14 @@ std::string OptimalCrystalStructure::toAbridgedStructuralFingerprint() const
 }
 
 std::string OptimalCrystalStructure::toStructuralFingerprint() const
+{
+	return toStructuralFingerprint(getUniqueOptimalAtoms());
+}
+
+std::string OptimalCrystalStructure::toStructuralFingerprint(const std::vector<std::pair<OptimalAtom, size_type>>& uniqueOptimalAtoms) const
 {
 	System::IO::StreamWriter streamWriter;
 	{
-		std::vector<std::pair<OptimalAtom, size_type>> uniqueOptimalAtoms = getUniqueOptimalAtoms();
 		std::map<AtomicNumber, size_type> numberAndCount;
 
 
@@ -301,10 +168,14 @@ std::string OptimalCrystalStructure::toStructuralFingerprint() const
 }
 
 std::string OptimalCrystalStructure::toDetailedStructuralFingerprint() const
+{
+	return toDetailedStructuralFingerprint(getUniqueOptimalAtoms());
+}
+
+std::string OptimalCrystalStructure::toDetailedStructuralFingerprint(const std::vector<std::pair<OptimalAtom, size_type>>& uniqueOptimalAtoms) const
 {
 	System::IO::StreamWriter streamWriter;
 	{
-		std::vector<std::pair<OptimalAtom, size_type>> uniqueOptimalAtoms = getUniqueOptimalAtoms();
 		std::map<AtomicNumber, size_type> numberAndCount;
 
 
@@ -340,6 +211,234 @@ std::string OptimalCrystalStructure::toDetailedStructuralFingerprint() const
 	return streamWriter.allTexts();
 }
 
+StructuralHash OptimalCrystalStructure::toStructuralHash() const
+{
+	return toStructuralHash(getUniqueOptimalAtoms());
+}
+
+StructuralHash OptimalCrystalStructure::toStructuralHash(const std::vector<std::pair<OptimalAtom, size_type>>& uniqueOptimalAtoms) const
+{
+	StructuralHash structuralHash;
+	{
+		structuralHash.add(static_cast<std::uint64_t>(static_cast<int>(spaceGroupNumber())));
+
+		for (const auto& uniqueOptimalAtom : uniqueOptimalAtoms)
+		{
+			structuralHash.add(static_cast<std::uint64_t>(static_cast<unsigned short>(uniqueOptimalAtom.first.ionicAtomicNumber().atomicNumber())));
+			structuralHash.add(uniqueOptimalAtom.first.getFingerprintHash());
+			structuralHash.add(static_cast<std::uint64_t>(uniqueOptimalAtom.second));
+		}
+	}
+
+	return structuralHash;
+}
+
+StructuralHash OptimalCrystalStructure::toDetailedStructuralHash() const
+{
+	return toDetailedStructuralHash(getUniqueOptimalAtoms());
+}
+
+StructuralHash OptimalCrystalStructure::toDetailedStructuralHash(const std::vector<std::pair<OptimalAtom, size_type>>& uniqueOptimalAtoms) const
+{
+	StructuralHash structuralHash;
+	{
+		structuralHash.add(static_cast<std::uint64_t>(static_cast<int>(spaceGroupNumber())));
+
+		for (const auto& uniqueOptimalAtom : uniqueOptimalAtoms)
+		{
+			structuralHash.add(static_cast<std::uint64_t>(static_cast<unsigned short>(uniqueOptimalAtom.first.ionicAtomicNumber().atomicNumber())));
+			structuralHash.add(uniqueOptimalAtom.first.getDetailedFingerprintHash());
+			structuralHash.add(static_cast<std::uint64_t>(uniqueOptimalAtom.second));
+		}
+	}
+
+	return structuralHash;
+}
+
+std::vector<std::pair<OptimalAtom, OptimalCrystalStructure::size_type>> OptimalCrystalStructure::getUniqueOptimalAtoms() const
+{
+	std::vector<std::pair<OptimalAtom, size_type>> uniqueOptimalAtoms;
+	{
+		std::vector<OptimalAtom> atomicArrangement = atoms();
+		std::sort(atomicArrangement.begin(), atomicArrangement.end());
+
+
+		// Equal optimal atoms always share the site label, so only atoms of the same label need to be compared.
+		std::unordered_map<std::string, std::vector<std::size_t>> labelAndUniqueIndices;
+		labelAndUniqueIndices.reserve(atomicArrangement.size());
+
+		for (auto& atom : atomicArrangement)
+		{
+			std::vector<std::size_t>& uniqueIndices = labelAndUniqueIndices[atom.siteLabel()];
+
+			auto uniqueIter = uniqueIndices.begin();
+			{
+				for (; uniqueIter != uniqueIndices.end(); ++uniqueIter)
+				{
+					if (uniqueOptimalAtoms[*uniqueIter].first == atom)
+						break;
+				}
+			}
+
+			if (uniqueIter == uniqueIndices.end())
+			{
+				uniqueIndices.push_back(uniqueOptimalAtoms.size());
+				uniqueOptimalAtoms.push_back(std::make_pair(std::move(atom), 1));
+			}
+
+			else
+				uniqueOptimalAtoms[*uniqueIter].second += 1;
+		}
+	}
+
+	return uniqueOptimalAtoms;
+}
+
+StructuralDescriptor OptimalCrystalStructure::toStructuralDescriptor(const double radialCutoff, const size_type numRadialBins) const
+{
+	if (!(0.0 < radialCutoff) || (0 == numRadialBins))
+		throw System::ExceptionServices::InvalidOperationException{ typeid(*this), "toStructuralDescriptor", "The radial cutoff or the number of radial bins is not positive." };
+
+	if (atoms().empty() || !(unitCell().hasPositiveVolume()))
+		return StructuralDescriptor{};
+
+
+	std::vector<AtomicNumber> atomicNumbers;
+	{
+		for (const auto& atom : atoms())
+			atomicNumbers.push_back(atom.ionicAtomicNumber().atomicNumber());
+
+		std::sort(atomicNumbers.begin(), atomicNumbers.end());
+		atomicNumbers.erase(std::unique(atomicNumbers.begin(), atomicNumbers.end()), atomicNumbers.end());
+	}
+
+	std::vector<size_type> speciesIndices;
+	{
+		for (const auto& atom : atoms())
+			speciesIndices.push_back(static_cast<size_type>(std::lower_bound(atomicNumbers.begin(), atomicNumbers.end(), atom.ionicAtomicNumber().atomicNumber()) - atomicNumbers.begin()));
+	}
+
+	constexpr size_type numEnvironmentStatistics = 5;
+
+	const size_type numSpecies = atomicNumbers.size();
+	const size_type numRadialValues = ((numSpecies * (numSpecies + 1)) / 2) * numRadialBins;
+
+	std::vector<double> values(numRadialValues + (numSpecies * numEnvironmentStatistics), 0.0);
+
+
+	// Species-resolved radial distance histograms per atom, where each distance is split linearly between the two nearest bins.
+	// Every periodic image within maxTranslations cells along each axis is counted, which covers all pairs up to the radial cutoff.
+	{
+		const NumericalMatrix& basisVectors = unitCell().basisVectors();
+		const NumericalMatrix inverseBasisVectors = unitCell().getInverseBasisVectors();
+
+		std::array<int, 3> maxTranslations;
+		{
+			for (size_type axis = 0; axis < 3; ++axis)
+			{
+				const double reciprocalLength = std::sqrt((inverseBasisVectors(axis, 0) * inverseBasisVectors(axis, 0)) + (inverseBasisVectors(axis, 1) * inverseBasisVectors(axis, 1)) + (inverseBasisVectors(axis, 2) * inverseBasisVectors(axis, 2)));
+				maxTranslations[axis] = 1 + static_cast<int>(std::ceil(radialCutoff * reciprocalLength));
+			}
+		}
+
+		std::vector<NumericalVector> fractionalCoordinates;
+		{
+			for (const auto& atom : atoms())
+				fractionalCoordinates.push_back(inverseBasisVectors * atom.cartesianCoordinate());
+		}
+
+		const double binWidth = radialCutoff / static_cast<double>(numRadialBins);
+		const double atomicWeight = 1.0 / static_cast<double>(atoms().size());
+
+
+		for (size_type index = 0; index < atoms().size(); ++index)
+		{
+			for (size_type pairIndex = index; pairIndex < atoms().size(); ++pairIndex)
+			{
+				const size_type minSpeciesIndex = std::min(speciesIndices[index], speciesIndices[pairIndex]);
+				const size_type maxSpeciesIndex = std::max(speciesIndices[index], speciesIndices[pairIndex]);
+				const size_type histogramOffset = (((minSpeciesIndex * ((2 * numSpecies) + 1 - minSpeciesIndex)) / 2) + (maxSpeciesIndex - minSpeciesIndex)) * numRadialBins;
+
+				const double pairWeight = (index == pairIndex) ? atomicWeight : (2.0 * atomicWeight);
+
+				NumericalVector fractionalDifference = fractionalCoordinates[pairIndex] - fractionalCoordinates[index];
+				{
+					for (size_type axis = 0; axis < 3; ++axis)
+						fractionalDifference[axis] -= std::round(fractionalDifference[axis]);
+				}
+
+
+				for (int translationA = -maxTranslations[0]; translationA <= maxTranslations[0]; ++translationA)
+				{
+					for (int translationB = -maxTranslations[1]; translationB <= maxTranslations[1]; ++translationB)
+					{
+						for (int translationC = -maxTranslations[2]; translationC <= maxTranslations[2]; ++translationC)
+						{
+							if ((index == pairIndex) && (0 == translationA) && (0 == translationB) && (0 == translationC))
+								continue;
+
+							NumericalVector translatedDifference = fractionalDifference;
+							{
+								translatedDifference[0] += static_cast<double>(translationA);
+								translatedDifference[1] += static_cast<double>(translationB);
+								translatedDifference[2] += static_cast<double>(translationC);
+							}
+
+							const double distance = (basisVectors * translatedDifference).norm();
+
+							if (distance < radialCutoff)
+							{
+								const double binPosition = (distance / binWidth) - 0.5;
+								const double lowerBinPosition = std::floor(binPosition);
+								const double upperWeight = binPosition - lowerBinPosition;
+
+								const int lowerBinIndex = static_cast<int>(lowerBinPosition);
+
+								if (0 <= lowerBinIndex)
+									values[histogramOffset + static_cast<size_type>(lowerBinIndex)] += (pairWeight * (1.0 - upperWeight));
+
+								if (static_cast<size_type>(lowerBinIndex + 1) < numRadialBins)
+									values[histogramOffset + static_cast<size_type>(lowerBinIndex + 1)] += (pairWeight * upperWeight);
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	// Mean and standard deviation of coordination numbers, and mean numbers of vertex, edge, and face sharings per species.
+	{
+		std::vector<double> numSpeciesAtoms(numSpecies, 0.0);
+
+		for (size_type index = 0; index < atoms().size(); ++index)
+		{
+			const size_type statisticsOffset = numRadialValues + (speciesIndices[index] * numEnvironmentStatistics);
+			const double coordinationNumber = static_cast<double>(atoms()[index].getCoordinationNumber());
+
+			values[statisticsOffset] += coordinationNumber;
+			values[statisticsOffset + 1] += (coordinationNumber * coordinationNumber);
+			values[statisticsOffset + 2] += static_cast<double>(atoms()[index].countVertexSharings());
+			values[statisticsOffset + 3] += static_cast<double>(atoms()[index].countEdgeSharings());
+			values[statisticsOffset + 4] += static_cast<double>(atoms()[index].countFaceSharings());
+
+			numSpeciesAtoms[speciesIndices[index]] += 1.0;
+		}
+
+		for (size_type speciesIndex = 0; speciesIndex < numSpecies; ++speciesIndex)
+		{
+			const size_type statisticsOffset = numRadialValues + (speciesIndex * numEnvironmentStatistics);
+
+			for (size_type statisticsIndex = 0; statisticsIndex < numEnvironmentStatistics; ++statisticsIndex)
+				values[statisticsOffset + statisticsIndex] /= numSpeciesAtoms[speciesIndex];
+
+			values[statisticsOffset + 1] = std::sqrt(std::max(0.0, values[statisticsOffset + 1] - (values[statisticsOffset] * values[statisticsOffset])));
+		}
+	}
+
+	return StructuralDescriptor{ atomicNumbers, std::move(values) };
+}
+
 // Methods
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -356,33 +455,128 @@ std::string OptimalCrystalStructure::toDetailedStructuralFingerprint() const
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // Private methods
 
-std::vector<std::pair<OptimalAtom, OptimalCrystalStructure::size_type>> OptimalCrystalStructure::getUniqueOptimalAtoms() const
+std::vector<OptimalAtom> OptimalCrystalStructure::buildAtomicArrangement(const ConstrainingCrystalStructure& structure) const
 {
-	std::vector<std::pair<OptimalAtom, size_type>> uniqueOptimalAtoms;
+	const std::size_t numAtoms = structure.atoms().size();
+
+	std::vector<std::vector<IonicAtomicNumber>> coordinations(numAtoms);
 	{
-		std::vector<OptimalAtom> atomicArrangement = atoms();
-		std::sort(atomicArrangement.begin(), atomicArrangement.end());
+		for (std::size_t index = 0; index < numAtoms; ++index)
+		{
+			const auto& constrainingAtom = structure.atoms()[index];
 
+			coordinations[index].reserve(constrainingAtom.getCovalentBondedOriginalAtomIndices().size() + constrainingAtom.getIonicBondedOriginalAtomIndices().size() + constrainingAtom.getCovalentBondedTranslatedAtomIndices().size() + constrainingAtom.getIonicBondedTranslatedAtomIndices().size());
 
-		for (const auto& atom : atomicArrangement)
+			for (const auto& originalAtomIndex : constrainingAtom.getCovalentBondedOriginalAtomIndices())
+				coordinations[index].push_back(structure.atoms().at(originalAtomIndex).ionicAtomicNumber());
+
+			for (const auto& originalAtomIndex : constrainingAtom.getIonicBondedOriginalAtomIndices())
+				coordinations[index].push_back(structure.atoms().at(originalAtomIndex).ionicAtomicNumber());
+
+			for (const auto& translatedAtomIndex : constrainingAtom.getCovalentBondedTranslatedAtomIndices())
+				coordinations[index].push_back(structure.atoms().at(translatedAtomIndex.originalIndex()).ionicAtomicNumber());
+
+			for (const auto& translatedAtomIndex : constrainingAtom.getIonicBondedTranslatedAtomIndices())
+				coordinations[index].push_back(structure.atoms().at(translatedAtomIndex.originalIndex()).ionicAtomicNumber());
+		}
+	}
+
+
+	const auto& coordinationPolyhedraLinkings = structure.getCoordinationPolyhedraLinkings();
+
+	std::vector<std::vector<std::pair<IonicAtomicNumber, IonicAtomicNumber>>> vertexSharings(numAtoms);
+	std::vector<std::vector<std::pair<IonicAtomicNumber, std::array<IonicAtomicNumber, 2>>>> edgeSharings(numAtoms);
+	std::vector<std::vector<std::pair<IonicAtomicNumber, std::vector<IonicAtomicNumber>>>> faceSharings(numAtoms);
+	{
+		std::vector<std::array<std::size_t, 3>> numSharings(numAtoms, std::array<std::size_t, 3>{ 0, 0, 0 });
 		{
-			auto uniqueIter = uniqueOptimalAtoms.begin();
+			for (const auto& coordinationPolyhedraLinking : coordinationPolyhedraLinkings)
 			{
-				for (; uniqueIter != uniqueOptimalAtoms.end(); ++uniqueIter)
+				const std::size_t sharingType = std::min<std::size_t>(coordinationPolyhedraLinking.second.size(), 3);
+
+				if (0 < sharingType)
 				{
-					if (uniqueIter->first == atom)
-						break;
+					numSharings.at(coordinationPolyhedraLinking.first.originalAtomIndex())[sharingType - 1] += 1;
+					numSharings.at(coordinationPolyhedraLinking.first.translatedAtomIndex().originalIndex())[sharingType - 1] += 1;
 				}
 			}
 
-			if (uniqueIter == uniqueOptimalAtoms.end())
-				uniqueOptimalAtoms.push_back(std::make_pair(atom, 1));
+			for (std::size_t index = 0; index < numAtoms; ++index)
+			{
+				vertexSharings[index].reserve(numSharings[index][0]);
+				edgeSharings[index].reserve(numSharings[index][1]);
+				faceSharings[index].reserve(numSharings[index][2]);
+			}
+		}
+
+
+		for (const auto& coordinationPolyhedraLinking : coordinationPolyhedraLinkings)
+		{
+			const std::size_t originalIndex = coordinationPolyhedraLinking.first.originalAtomIndex();
+			const std::size_t translatedIndex = coordinationPolyhedraLinking.first.translatedAtomIndex().originalIndex();
+
+			const IonicAtomicNumber originalAtomicNumber{ structure.atoms().at(originalIndex).ionicAtomicNumber() };
+			const IonicAtomicNumber translatedAtomicNumber{ structure.atoms().at(translatedIndex).ionicAtomicNumber() };
+
+			if (1 == coordinationPolyhedraLinking.second.size())
+			{
+				const IonicAtomicNumber vertexAtomicNumber{ structure.atoms().at(coordinationPolyhedraLinking.second.back().originalIndex()).ionicAtomicNumber() };
+
+				vertexSharings[originalIndex].push_back(std::make_pair(translatedAtomicNumber, vertexAtomicNumber));
+				vertexSharings[translatedIndex].push_back(std::make_pair(originalAtomicNumber, vertexAtomicNumber));
+			}
+
+			else if (2 == coordinationPolyhedraLinking.second.size())
+			{
+				std::array<IonicAtomicNumber, 2> edgeAtomicNumbers;
+				{
+					edgeAtomicNumbers[0] = structure.atoms()[coordinationPolyhedraLinking.second[0].originalIndex()].ionicAtomicNumber();
+					edgeAtomicNumbers[1] = structure.atoms()[coordinationPolyhedraLinking.second[1].originalIndex()].ionicAtomicNumber();
+				}
+
+				edgeSharings[originalIndex].push_back(std::make_pair(translatedAtomicNumber, edgeAtomicNumbers));
+				edgeSharings[translatedIndex].push_back(std::make_pair(originalAtomicNumber, edgeAtomicNumbers));
+			}
+
+			else if (2 < coordinationPolyhedraLinking.second.size())
+			{
+				std::vector<IonicAtomicNumber> faceAtomicNumbers;
+				{
+					faceAtomicNumbers.reserve(coordinationPolyhedraLinking.second.size());
+
+					for (const auto& bridgingIndex : coordinationPolyhedraLinking.second)
+						faceAtomicNumbers.push_back(structure.atoms()[bridgingIndex.originalIndex()].ionicAtomicNumber());
+				}
+
+				faceSharings[originalIndex].push_back(std::make_pair(translatedAtomicNumber, faceAtomicNumbers));
+				faceSharings[translatedIndex].push_back(std::make_pair(originalAtomicNumber, std::move(faceAtomicNumbers)));
+			}
+
 			else
-				uniqueIter->second += 1;
+				throw System::ExceptionServices::InvalidOperationException{ typeid(*this), "buildAtomicArrangement", "The number of common bridging atoms is zero." };
 		}
 	}
 
-	return uniqueOptimalAtoms;
+
+	std::vector<OptimalAtom> atomicArrangement;
+	{
+		atomicArrangement.reserve(numAtoms);
+
+		for (std::size_t index = 0; index < numAtoms; ++index)
+		{
+			OptimalAtom optimalAtom{ structure.atoms()[index] };
+			{
+				optimalAtom.setCoordinations(std::move(coordinations[index]));
+				optimalAtom.setVertexSharings(std::move(vertexSharings[index]));
+				optimalAtom.setEdgeSharings(std::move(edgeSharings[index]));
+				optimalAtom.setFaceSharings(std::move(faceSharings[index]));
+			}
+
+			atomicArrangement.push_back(std::move(optimalAtom));
+		}
+	}
+
+	return atomicArrangement;
 }
 
 // Private methods
@@ -0,0 +1,173 @@
+#include "ParallelTaskPool.h"
+
+#include "ThreadingPolicy.h"
+
+using namespace System::Parallel;
+
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Constructors and destructor
+
+thread_local bool ParallelTaskPool::s_isWorkerThread = false;
+
+
+
+ParallelTaskPool::ParallelTaskPool(const size_type numWorkers)
+	: _workers{}
+	, m_jobs{}
+	, m_jobsMutex{}
+	, m_jobsCondition{}
+	, m_isStopping{ false }
+{
+	for (size_type workerRank = 0; workerRank < numWorkers; ++workerRank)
+		_workers.emplace_back([this]() { work(); });
+}
+
+ParallelTaskPool::~ParallelTaskPool()
+{
+	{
+		std::lock_guard<std::mutex> guard{ m_jobsMutex };
+		m_isStopping = true;
+	}
+
+	m_jobsCondition.notify_all();
+
+	for (auto& worker : _workers)
+		worker.join();
+}
+
+// Constructors and destructor
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Public methods
+
+ParallelTaskPool& ParallelTaskPool::getInstance()
+{
+	// The calling thread takes part in every job, so one worker fewer than the thread limit keeps all cores busy.
+	static ParallelTaskPool s_instance{ (ThreadingPolicy::maxThreading() < 2) ? 0 : (ThreadingPolicy::maxThreading() - 1) };
+	return s_instance;
+}
+
+// Public methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+void ParallelTaskPool::executeJob(const std::shared_ptr<Job>& job)
+{
+	{
+		std::lock_guard<std::mutex> guard{ m_jobsMutex };
+		m_jobs.push_back(job);
+	}
+
+	m_jobsCondition.notify_all();
+	processJob(*job);
+
+
+	{
+		std::unique_lock<std::mutex> guard{ job->jobMutex };
+		job->completionCondition.wait(guard, [&job]() { return (job->numCompletedTasks == job->numTasks); });
+	}
+
+	{
+		std::lock_guard<std::mutex> guard{ m_jobsMutex };
+		std::erase(m_jobs, job);
+	}
+
+	if (job->exception)
+		std::rethrow_exception(job->exception);
+}
+
+void ParallelTaskPool::work()
+{
+	s_isWorkerThread = true;
+
+	while (true)
+	{
+		std::shared_ptr<Job> job;
+		{
+			std::unique_lock<std::mutex> guard{ m_jobsMutex };
+			m_jobsCondition.wait(guard, [this]() { return (m_isStopping || !m_jobs.empty()); });
+
+			if (m_isStopping)
+				return;
+
+			job = m_jobs.front();
+			m_jobs.pop_front();
+
+			// Jobs with unclaimed tasks stay queued, so that idle workers spread over all running jobs.
+			if (job->nextTaskIndex.load() < job->numTasks)
+				m_jobs.push_back(job);
+		}
+
+		processJob(*job);
+	}
+}
+
+void ParallelTaskPool::processJob(Job& job) noexcept
+{
+	while (true)
+	{
+		const size_type taskIndex = job.nextTaskIndex.fetch_add(1);
+
+		if (job.numTasks <= taskIndex)
+			return;
+
+
+		std::exception_ptr exception;
+
+		try
+		{
+			job.task(taskIndex);
+		}
+		catch (...)
+		{
+			exception = std::current_exception();
+		}
+
+		std::lock_guard<std::mutex> guard{ job.jobMutex };
+
+		if (exception && !(job.exception))
+			job.exception = exception;
+
+		if (++job.numCompletedTasks == job.numTasks)
+			job.completionCondition.notify_all();
+	}
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -0,0 +1,120 @@
+#include "ShardedMutexTable.h"
+
+#include <chrono>
+#include <functional>
+
+using namespace System::Parallel;
+
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Constructors
+
+ShardedMutexTable::ShardedMutexTable() noexcept
+	: m_shards{}
+	, _numAcquisitions{ 0 }
+	, _numContentions{ 0 }
+	, _contentionNanoseconds{ 0 }
+{
+}
+
+// Constructors
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Public methods
+
+std::unique_lock<std::mutex> ShardedMutexTable::lock(const std::string& key)
+{
+	std::unique_lock<std::mutex> guard{ getMutex(key), std::try_to_lock };
+
+	if (!(guard.owns_lock()))
+	{
+		const auto startTime = std::chrono::steady_clock::now();
+		guard.lock();
+
+		++_numContentions;
+		_contentionNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+	}
+
+	++_numAcquisitions;
+	return guard;
+}
+
+ShardedMutexTable::size_type ShardedMutexTable::countKeys() const
+{
+	size_type numKeys = 0;
+	{
+		for (auto& shard : m_shards)
+		{
+			std::shared_lock<std::shared_mutex> guard{ shard.shardMutex };
+			numKeys += shard.keyAndMutex.size();
+		}
+	}
+
+	return numKeys;
+}
+
+void ShardedMutexTable::resetStatistics() noexcept
+{
+	_numAcquisitions = 0;
+	_numContentions = 0;
+	_contentionNanoseconds = 0;
+}
+
+// Public methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+std::mutex& ShardedMutexTable::getMutex(const std::string& key)
+{
+	Shard& shard = m_shards[std::hash<std::string>{}(key) % m_shards.size()];
+
+	{
+		std::shared_lock<std::shared_mutex> guard{ shard.shardMutex };
+		auto iter = shard.keyAndMutex.find(key);
+
+		if (!(iter == shard.keyAndMutex.end()))
+			return iter->second;
+	}
+
+
+	std::lock_guard<std::shared_mutex> guard{ shard.shardMutex };
+	return shard.keyAndMutex.try_emplace(key).first->second;
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
@@ -1,8 +1,9 @@
 #include "SpaceGroupTypeSearcher.h"
 
-#include <iostream>
 #include <algorithm>
 #include <map>
+#include <numeric>
+#include <unordered_map>
 
 #include "spglib.h"
 
@@ -23,6 +24,13 @@ using namespace ChemToolkit::Crystallography::Symmetry;
 // Constructors
 
 double SpaceGroupTypeSearcher::s_defaultPrecision{ ChemToolkit::Crystallography::Symmetry::CrystallographicSymmetryOperation::defaultPrecision() };
+std::vector<SpaceGroupTypeSearcher::IntegerMatrix> SpaceGroupTypeSearcher::s_unimodularMatrices{ SpaceGroupTypeSearcher::getUnimodularMatrices() };
+
+std::size_t SpaceGroupTypeSearcher::s_numToleranceSearches{ 0 };
+std::size_t SpaceGroupTypeSearcher::s_numToleranceTrials{ 0 };
+std::size_t SpaceGroupTypeSearcher::s_numLadderTrials{ 0 };
+std::map<std::string, SpaceGroupTypeSearcher::size_type> SpaceGroupTypeSearcher::s_learnedToleranceLevels{};
+std::mutex SpaceGroupTypeSearcher::s_toleranceMutex{};
 
 
 
@@ -52,6 +60,126 @@ SpaceGroupTypeSearcher::SpaceGroupTypeSearcher(const double val)
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
+// Methods
+
+std::vector<SpaceGroupTypeSearcher::size_type> SpaceGroupTypeSearcher::getUniqueAtomIndices(const UnitCell& unitCell, const std::vector<AtomicNumber>& atomicNumbers, const std::vector<NumericalVector>& fractionalCoordinates)
+{
+	constexpr double samePositionDistanceRange = 0.001;
+	constexpr int maxBucketsPerAxis = 64;
+
+	const NumericalMatrix inverseBasisVectors = unitCell.getInverseBasisVectors();
+
+	int numBuckets[3];
+	{
+		for (size_type row = 0; row < 3; ++row)
+		{
+			const double axisRange = samePositionDistanceRange * std::sqrt((inverseBasisVectors(row, 0) * inverseBasisVectors(row, 0)) + (inverseBasisVectors(row, 1) * inverseBasisVectors(row, 1)) + (inverseBasisVectors(row, 2) * inverseBasisVectors(row, 2)));
+
+			if (axisRange < (1.0 / static_cast<double>(maxBucketsPerAxis)))
+				numBuckets[row] = maxBucketsPerAxis;
+			else
+				numBuckets[row] = std::max(1, static_cast<int>(std::floor(1.0 / axisRange)));
+		}
+	}
+
+
+	std::vector<size_type> uniqueIndices;
+	{
+		std::unordered_map<int, std::vector<size_type>> bucketAndUniqueIndices;
+
+		for (size_type index = 0; index < atomicNumbers.size(); ++index)
+		{
+			const NumericalVector& fractionalCoordinate = fractionalCoordinates.at(index);
+
+			int bucketIndices[3];
+			{
+				for (size_type row = 0; row < 3; ++row)
+					bucketIndices[row] = std::min(static_cast<int>(std::floor(fractionalCoordinate[row] * static_cast<double>(numBuckets[row]))), (numBuckets[row] - 1));
+			}
+
+
+			bool hasSameFractionalCoordinate = false;
+			{
+				std::vector<int> neighbouringBuckets[3];
+				{
+					for (size_type row = 0; row < 3; ++row)
+					{
+						if (numBuckets[row] < 3)
+						{
+							for (int bucket = 0; bucket < numBuckets[row]; ++bucket)
+								neighbouringBuckets[row].push_back(bucket);
+						}
+
+						else
+						{
+							for (int shift = (-1); shift < 2; ++shift)
+								neighbouringBuckets[row].push_back((bucketIndices[row] + shift + numBuckets[row]) % numBuckets[row]);
+						}
+					}
+				}
+
+				for (const auto& bucketA : neighbouringBuckets[0])
+				{
+					for (const auto& bucketB : neighbouringBuckets[1])
+					{
+						for (const auto& bucketC : neighbouringBuckets[2])
+						{
+							auto iter = bucketAndUniqueIndices.find((((bucketA * numBuckets[1]) + bucketB) * numBuckets[2]) + bucketC);
+
+							if (!(iter == bucketAndUniqueIndices.end()))
+							{
+								for (const auto& uniqueIndex : iter->second)
+								{
+									if (atomicNumbers.at(index) == atomicNumbers.at(uniqueIndex))
+									{
+										if (isSameFractionalCoordinate(unitCell, fractionalCoordinates.at(uniqueIndex), fractionalCoordinate, samePositionDistanceRange))
+										{
+											hasSameFractionalCoordinate = true;
+											break;
+										}
+									}
+								}
+							}
+
+							if (hasSameFractionalCoordinate)
+								break;
+						}
+
+						if (hasSameFractionalCoordinate)
+							break;
+					}
+
+					if (hasSameFractionalCoordinate)
+						break;
+				}
+			}
+
+
+			if (!hasSameFractionalCoordinate)
+			{
+				bucketAndUniqueIndices[(((bucketIndices[0] * numBuckets[1]) + bucketIndices[1]) * numBuckets[2]) + bucketIndices[2]].push_back(index);
+				uniqueIndices.push_back(index);
+			}
+		}
+	}
+
+	return uniqueIndices;
+}
+
+// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
 // Private methods
 
 ChemToolkit::Crystallography::UnitCell SpaceGroupTypeSearcher::getDelaunayReducedUnitCell(const UnitCell& cell) const
@@ -98,403 +226,447 @@ SpaceGroupTypeSearcher::SpglibOutputVariables SpaceGroupTypeSearcher::getPrimiti
 			const UnitCell prevUnitCell = outputVariables.unitCell;
 
 			outputVariables.unitCell.basisVectors() = toNumericalMatrix(inputVariables.lattice);
-			const NumericalMatrix inverseBasisVectors = outputVariables.unitCell.getInverseBasisVectors();
-			{
-				std::vector<AtomicNumber> atomicNumbers;
-				std::vector<NumericalVector> fractionalCoordinates;
-				std::vector<std::string> siteLabels;
-				std::vector<WyckoffSymbol> wyckoffSymbols;
-				std::vector<SiteSymmetrySymbol> siteSymmetrySymbols;
-				std::vector<size_type> mappingToInputIndices;
-				{
-					constexpr double samePositionDistanceRange = 0.001;
+			removeEquivalentAtoms(outputVariables, prevUnitCell);
+		}
+	}
 
+	return outputVariables;
+}
 
-					for (size_type index = 0; index < outputVariables.atomicNumbers.size(); ++index)
-					{
-						NumericalVector originalFractionalCoordinate = inverseBasisVectors * (prevUnitCell.basisVectors() * outputVariables.fractionalCoordinates.at(index));
-						{
-							int floorValueA = static_cast<int>(std::floor(originalFractionalCoordinate[0]));
-							int floorValueB = static_cast<int>(std::floor(originalFractionalCoordinate[1]));
-							int floorValueC = static_cast<int>(std::floor(originalFractionalCoordinate[2]));
-
-							if (floorValueA != 0)
-								originalFractionalCoordinate[0] -= static_cast<double>(floorValueA);
-							if (floorValueB != 0)
-								originalFractionalCoordinate[1] -= static_cast<double>(floorValueB);
-							if (floorValueC != 0)
-								originalFractionalCoordinate[2] -= static_cast<double>(floorValueC);
-						}
+SpaceGroupTypeSearcher::SpglibOutputVariables SpaceGroupTypeSearcher::getConventionalOutputVariables(const SpglibInputVariables& inputVariables) const
+{
+	std::shared_ptr<const SymmetryDataset> symmetryDataset = getSymmetryDataset(inputVariables);
 
 
-						bool hasSameFractionalCoordinate = false;
-						{
-							for (int indexA = (-1); ((indexA < 2) && !hasSameFractionalCoordinate); ++indexA)
-							{
-								for (int indexB = (-1); ((indexB < 2) && !hasSameFractionalCoordinate); ++indexB)
-								{
-									for (int indexC = (-1); ((indexC < 2) && !hasSameFractionalCoordinate); ++indexC)
-									{
-										NumericalVector translatedFractionalCoordinate = originalFractionalCoordinate;
-										{
-											translatedFractionalCoordinate[0] += static_cast<double>(indexA);
-											translatedFractionalCoordinate[1] += static_cast<double>(indexB);
-											translatedFractionalCoordinate[2] += static_cast<double>(indexC);
-										}
 
+	const size_type inputNumAtoms = inputVariables.numAtoms;
+	SpglibOutputVariables outputVariables;
+	{
+		outputVariables.spaceGroupNumber = symmetryDataset->spaceGroupNumber;
+		outputVariables.numAtoms = static_cast<size_type>(symmetryDataset->standardizedTypes.size());
+		outputVariables.unitCell.basisVectors() = symmetryDataset->standardizedLattice;
+	}
 
-										for (size_type uniqueIndex = 0; uniqueIndex < fractionalCoordinates.size(); ++uniqueIndex)
-										{
-											if (outputVariables.atomicNumbers.at(index) == atomicNumbers.at(uniqueIndex))
-											{
-												NumericalVector displacement = outputVariables.unitCell.basisVectors() * (fractionalCoordinates.at(uniqueIndex) - translatedFractionalCoordinate);
+	{
+		std::map<size_type, size_type> primitiveToInput;
+		{
+			for (size_type index = 0; index < inputNumAtoms; ++index)
+				primitiveToInput.try_emplace(static_cast<size_type>(symmetryDataset->mappingToPrimitive[index]), index);
+		}
 
+		for (size_type index = 0; index < outputVariables.numAtoms; ++index)
+			outputVariables.mappingToInputIndices.push_back(primitiveToInput.at(static_cast<size_type>(symmetryDataset->standardizedMappingToPrimitive[index])));
+	}
 
-												if (displacement.normSquare() < (samePositionDistanceRange * samePositionDistanceRange))
-												{
-													hasSameFractionalCoordinate = true;
-													break;
-												}
-											}
-										}
-									}
-								}
-							}
-						}
 
+	std::map<size_type, size_type> equivalentAndLabelDictionary;
+	{
+		std::map<AtomicNumber, std::vector<size_type>> numberAndEquivalentsDictionary;
+		{
+			for (size_type index = 0; index < outputVariables.numAtoms; ++index)
+			{
+				size_type equivalentIndex = static_cast<size_type>(symmetryDataset->crystallographicOrbits[outputVariables.mappingToInputIndices.at(index)]);
+				AtomicNumber atomicNumber{ symmetryDataset->standardizedTypes[index] };
+
+
+				auto iter = numberAndEquivalentsDictionary.find(atomicNumber);
 
-						if (!hasSameFractionalCoordinate)
+				if (iter == numberAndEquivalentsDictionary.end())
+					numberAndEquivalentsDictionary.emplace(atomicNumber, std::vector<size_type>{ equivalentIndex });
+				else
+				{
+					bool isRegistered = false;
+					{
+						for (const auto registeredEquivalentIndex : iter->second)
 						{
-							atomicNumbers.push_back(outputVariables.atomicNumbers.at(index));
-							fractionalCoordinates.push_back(std::move(originalFractionalCoordinate));
-							siteLabels.push_back(outputVariables.siteLabels.at(index));
-							wyckoffSymbols.push_back(outputVariables.wyckoffSymbols.at(index));
-							siteSymmetrySymbols.push_back(outputVariables.siteSymmetrySymbols.at(index));
-							mappingToInputIndices.push_back(outputVariables.mappingToInputIndices.at(index));
+							if (registeredEquivalentIndex == equivalentIndex)
+							{
+								isRegistered = true;
+								break;
+							}
 						}
 					}
-				}
-
 
-				outputVariables.numAtoms = static_cast<size_type>(atomicNumbers.size());
-				outputVariables.atomicNumbers = std::move(atomicNumbers);
-				outputVariables.fractionalCoordinates = std::move(fractionalCoordinates);
-				outputVariables.siteLabels = std::move(siteLabels);
-				outputVariables.wyckoffSymbols = std::move(wyckoffSymbols);
-				outputVariables.siteSymmetrySymbols = std::move(siteSymmetrySymbols);
-				outputVariables.mappingToInputIndices = std::move(mappingToInputIndices);
+					if (!isRegistered)
+						iter->second.push_back(equivalentIndex);
+				}
 			}
 		}
+
+		for (const auto& numberAndEquivalents : numberAndEquivalentsDictionary)
+		{
+			for (size_type index = 0; index < numberAndEquivalents.second.size(); ++index)
+				equivalentAndLabelDictionary.emplace(numberAndEquivalents.second.at(index), (1 + index));
+		}
 	}
 
-	return outputVariables;
-}
 
-SpaceGroupTypeSearcher::SpglibOutputVariables SpaceGroupTypeSearcher::getConventionalOutputVariables(const SpglibInputVariables& inputVariables) const
-{
-	SpglibDataset* spglibDatasetPtr = nullptr;
+	for (int index = 0; index < outputVariables.numAtoms; ++index)
 	{
-		double prec = _precision;
+		AtomicNumber atomicNumber{ symmetryDataset->standardizedTypes[index] };
+		std::string siteLabel = atomicNumber.toElementSymbol();
+		siteLabel += std::to_string(equivalentAndLabelDictionary.at(static_cast<size_type>(symmetryDataset->crystallographicOrbits[outputVariables.mappingToInputIndices.at(index)])));
+
+		outputVariables.atomicNumbers.push_back(atomicNumber);
+		outputVariables.fractionalCoordinates.push_back(symmetryDataset->standardizedPositions[index]);
+		outputVariables.siteLabels.push_back(siteLabel);
+		outputVariables.wyckoffSymbols.push_back(symmetryDataset->wyckoffSymbols[outputVariables.mappingToInputIndices[index]]);
+		outputVariables.siteSymmetrySymbols.push_back(symmetryDataset->siteSymmetrySymbols[outputVariables.mappingToInputIndices[index]]);
+	}
 
-		for (size_type rep = 0; rep < 20; ++rep)
-		{
-			spglibDatasetPtr = spg_get_dataset(inputVariables.lattice, inputVariables.positions.get(), inputVariables.types.get(), inputVariables.numAtoms, prec);
 
-			if (spglibDatasetPtr == nullptr)
-				prec *= 0.8;
-			else
-				break;
-		}
+	return outputVariables;
+}
 
-		if (spglibDatasetPtr == nullptr)
-		{
-			spg_free_dataset(spglibDatasetPtr);
-			throw System::ExceptionServices::ApplicationException{ typeid(*this), "getDataset", "Could not obtain \"spglibDataset\"." };
-		}
-	}
+SpaceGroupTypeSearcher::SpglibOutputVariables SpaceGroupTypeSearcher::getSymmetrizedInputVariables(const SpglibInputVariables& inputVariables) const
+{
+	std::shared_ptr<const SymmetryDataset> symmetryDataset = getSymmetryDataset(inputVariables);
 
 
 
-	try
+	SpglibOutputVariables outputVariables;
 	{
-		const size_type inputNumAtoms = inputVariables.numAtoms;
-		SpglibOutputVariables outputVariables;
-		{
-			outputVariables.spaceGroupNumber = SpaceGroupNumber{ spglibDatasetPtr->spacegroup_number };
-			outputVariables.numAtoms = static_cast<size_type>(spglibDatasetPtr->n_std_atoms);
-			outputVariables.unitCell.basisVectors() = toNumericalMatrix(spglibDatasetPtr->std_lattice);
-		}
-
-		{
-			std::map<size_type, size_type> primitiveToInput;
-			{
-				for (size_type index = 0; index < inputNumAtoms; ++index)
-					primitiveToInput.try_emplace(static_cast<size_type>(spglibDatasetPtr->mapping_to_primitive[index]), index);
-			}
+		outputVariables.numAtoms = inputVariables.numAtoms;
+		outputVariables.unitCell.basisVectors() = toNumericalMatrix(inputVariables.lattice);
 
-			for (size_type index = 0; index < outputVariables.numAtoms; ++index)
-				outputVariables.mappingToInputIndices.push_back(primitiveToInput.at(static_cast<size_type>(spglibDatasetPtr->std_mapping_to_primitive[index])));
-		}
+		outputVariables.spaceGroupNumber = symmetryDataset->spaceGroupNumber;
+	}
 
 
-		std::map<size_type, size_type> equivalentAndLabelDictionary;
+	std::map<size_type, size_type> equivalentAndLabelDictionary;
+	{
+		std::map<AtomicNumber, std::vector<size_type>> numberAndEquivalentsDictionary;
 		{
-			std::map<AtomicNumber, std::vector<size_type>> numberAndEquivalentsDictionary;
+			for (size_type index = 0; index < outputVariables.numAtoms; ++index)
 			{
-				for (size_type index = 0; index < outputVariables.numAtoms; ++index)
-				{
-					size_type equivalentIndex = static_cast<size_type>(spglibDatasetPtr->crystallographic_orbits[outputVariables.mappingToInputIndices.at(index)]);
-					AtomicNumber atomicNumber{ spglibDatasetPtr->std_types[index] };
+				size_type equivalentIndex = static_cast<size_type>(symmetryDataset->crystallographicOrbits[index]);
+				AtomicNumber atomicNumber{ inputVariables.types[index] };
 
 
-					auto iter = numberAndEquivalentsDictionary.find(atomicNumber);
+				auto iter = numberAndEquivalentsDictionary.find(atomicNumber);
 
-					if (iter == numberAndEquivalentsDictionary.end())
-						numberAndEquivalentsDictionary.emplace(atomicNumber, std::vector<size_type>{ equivalentIndex });
-					else
+				if (iter == numberAndEquivalentsDictionary.end())
+					numberAndEquivalentsDictionary.emplace(atomicNumber, std::vector<size_type>{ equivalentIndex });
+				else
+				{
+					bool isRegistered = false;
 					{
-						bool isRegistered = false;
+						for (const auto registeredEquivalentIndex : iter->second)
 						{
-							for (const auto registeredEquivalentIndex : iter->second)
+							if (registeredEquivalentIndex == equivalentIndex)
 							{
-								if (registeredEquivalentIndex == equivalentIndex)
-								{
-									isRegistered = true;
-									break;
-								}
+								isRegistered = true;
+								break;
 							}
 						}
-
-						if (!isRegistered)
-							iter->second.push_back(equivalentIndex);
 					}
-				}
-			}
 
-			for (const auto& numberAndEquivalents : numberAndEquivalentsDictionary)
-			{
-				for (size_type index = 0; index < numberAndEquivalents.second.size(); ++index)
-					equivalentAndLabelDictionary.emplace(numberAndEquivalents.second.at(index), (1 + index));
+					if (!isRegistered)
+						iter->second.push_back(equivalentIndex);
+				}
 			}
 		}
 
-
-		for (int index = 0; index < outputVariables.numAtoms; ++index)
+		for (const auto& numberAndEquivalents : numberAndEquivalentsDictionary)
 		{
-			AtomicNumber atomicNumber{ spglibDatasetPtr->std_types[index] };
-			std::string siteLabel = atomicNumber.toElementSymbol();
-			siteLabel += std::to_string(equivalentAndLabelDictionary.at(static_cast<size_type>(spglibDatasetPtr->crystallographic_orbits[outputVariables.mappingToInputIndices.at(index)])));
-
-			outputVariables.atomicNumbers.push_back(atomicNumber);
-			outputVariables.fractionalCoordinates.push_back(toNumericalVector(spglibDatasetPtr->std_positions[index]));
-			outputVariables.siteLabels.push_back(siteLabel);
-			outputVariables.wyckoffSymbols.push_back(WyckoffSymbol{ spglibDatasetPtr->wyckoffs[outputVariables.mappingToInputIndices[index]] });
-			outputVariables.siteSymmetrySymbols.push_back(SiteSymmetrySymbol{ spglibDatasetPtr->site_symmetry_symbols[outputVariables.mappingToInputIndices[index]] });
+			for (size_type index = 0; index < numberAndEquivalents.second.size(); ++index)
+				equivalentAndLabelDictionary.emplace(numberAndEquivalents.second.at(index), (1 + index));
 		}
-
-
-		spg_free_dataset(spglibDatasetPtr);
-		return outputVariables;
 	}
 
 
-	catch (const System::ExceptionServices::IException& e)
+	for (int index = 0; index < outputVariables.numAtoms; ++index)
 	{
-		std::cout << e.toString() << std::endl;
-
-		spg_free_dataset(spglibDatasetPtr);
-		throw;
+		AtomicNumber atomicNumber{ inputVariables.types[index] };
+		std::string siteLabel = atomicNumber.toElementSymbol();
+		siteLabel += std::to_string(equivalentAndLabelDictionary.at(static_cast<size_type>(symmetryDataset->crystallographicOrbits[index])));
+
+		outputVariables.atomicNumbers.push_back(atomicNumber);
+		outputVariables.fractionalCoordinates.push_back(toNumericalVector(inputVariables.positions[index]));
+		outputVariables.siteLabels.push_back(siteLabel);
+		outputVariables.wyckoffSymbols.push_back(symmetryDataset->wyckoffSymbols[index]);
+		outputVariables.siteSymmetrySymbols.push_back(symmetryDataset->siteSymmetrySymbols[index]);
 	}
 
-	catch (const std::exception& e)
-	{
-		std::cout << e.what() << std::endl;
 
-		spg_free_dataset(spglibDatasetPtr);
-		throw;
-	}
+	return outputVariables;
 }
 
-SpaceGroupTypeSearcher::SpglibOutputVariables SpaceGroupTypeSearcher::getSymmetrizedInputVariables(const SpglibInputVariables& inputVariables) const
+std::vector<SpaceGroupTypeSearcher::SymmetryOperation> SpaceGroupTypeSearcher::getSymmetryOperations(const SpglibInputVariables& inputVariables, const SpaceGroupNumber& spaceGroupNumber) const
 {
-	SpglibDataset* spglibDatasetPtr = nullptr;
+	std::shared_ptr<const SymmetryDataset> symmetryDataset = nullptr;
 	{
-		double prec = _precision;
+		double prec = s_defaultPrecision;
 
 		for (size_type rep = 0; rep < 20; ++rep)
 		{
-			spglibDatasetPtr = spg_get_dataset(inputVariables.lattice, inputVariables.positions.get(), inputVariables.types.get(), inputVariables.numAtoms, prec);
+			symmetryDataset = SymmetryDatasetCache::getSymmetryDataset(inputVariables.lattice, inputVariables.positions.get(), inputVariables.types.get(), inputVariables.numAtoms, prec);
+
 
-			if (spglibDatasetPtr == nullptr)
+			if (symmetryDataset == nullptr)
 				prec *= 0.8;
+
 			else
-				break;
+			{
+				if (symmetryDataset->spaceGroupNumber == spaceGroupNumber)
+					break;
+				else
+					prec *= 0.8;
+			}
 		}
 
-		if (spglibDatasetPtr == nullptr)
-		{
-			spg_free_dataset(spglibDatasetPtr);
+		if (symmetryDataset == nullptr)
 			throw System::ExceptionServices::ApplicationException{ typeid(*this), "getDataset", "Could not obtain \"spglibDataset\"." };
+	}
+
+
+	if (symmetryDataset->spaceGroupNumber == spaceGroupNumber)
+	{
+		std::vector<SymmetryOperation> symmetryOperations;
+		{
+			for (size_type index = 0; index < symmetryDataset->rotations.size(); ++index)
+				symmetryOperations.push_back(SymmetryOperation{ symmetryDataset->rotations[index], symmetryDataset->translations[index] });
 		}
+
+
+		return symmetryOperations;
 	}
 
+	else
+		throw System::ExceptionServices::ApplicationException{ typeid(*this), "getDataset", "Could not find the argument space group number." };
+}
 
+bool SpaceGroupTypeSearcher::isTrivialSymmetry(const SpglibInputVariables& inputVariables) const
+{
+	if (inputVariables.numAtoms == 0)
+		return false;
 
-	try
+	else
 	{
-		SpglibOutputVariables outputVariables;
+		const double tolerance = screeningToleranceScale() * _precision;
+
+		UnitCell unitCell;
+		unitCell.basisVectors() = toNumericalMatrix(inputVariables.lattice);
+
+		NumericalVector axisTolerances;
+		double metricTensor[3][3];
+		double basisLengths[3];
 		{
-			outputVariables.numAtoms = inputVariables.numAtoms;
-			outputVariables.unitCell.basisVectors() = toNumericalMatrix(inputVariables.lattice);
+			const NumericalMatrix inverseBasisVectors = unitCell.getInverseBasisVectors();
+
+			for (size_type row = 0; row < 3; ++row)
+			{
+				for (size_type column = 0; column < 3; ++column)
+				{
+					metricTensor[row][column] = 0.0;
+
+					for (size_type position = 0; position < 3; ++position)
+						metricTensor[row][column] += inputVariables.lattice[position][row] * inputVariables.lattice[position][column];
+				}
+
+				basisLengths[row] = std::sqrt(metricTensor[row][row]);
+				axisTolerances[row] = tolerance * std::sqrt((inverseBasisVectors(row, 0) * inverseBasisVectors(row, 0)) + (inverseBasisVectors(row, 1) * inverseBasisVectors(row, 1)) + (inverseBasisVectors(row, 2) * inverseBasisVectors(row, 2)));
+			}
+		}
+
+
+		int referenceType = inputVariables.types[0];
+		{
+			std::map<int, int> typeAndCount;
+			{
+				for (int index = 0; index < inputVariables.numAtoms; ++index)
+					typeAndCount[inputVariables.types[index]] += 1;
+			}
 
-			outputVariables.spaceGroupNumber = SpaceGroupNumber{ spglibDatasetPtr->spacegroup_number };
+			for (const auto& typeAndCountPair : typeAndCount)
+			{
+				if (typeAndCountPair.second < typeAndCount.at(referenceType))
+					referenceType = typeAndCountPair.first;
+			}
+		}
+
+		int referenceIndex = 0;
+		{
+			while (inputVariables.types[referenceIndex] != referenceType)
+				++referenceIndex;
 		}
 
 
-		std::map<size_type, size_type> equivalentAndLabelDictionary;
+		for (const auto& rotation : s_unimodularMatrices)
 		{
-			std::map<AtomicNumber, std::vector<size_type>> numberAndEquivalentsDictionary;
+			bool isLatticeSymmetry = true;
 			{
-				for (size_type index = 0; index < outputVariables.numAtoms; ++index)
+				for (size_type row = 0; (isLatticeSymmetry && (row < 3)); ++row)
 				{
-					size_type equivalentIndex = static_cast<size_type>(spglibDatasetPtr->crystallographic_orbits[index]);
-					AtomicNumber atomicNumber{ inputVariables.types[index] };
+					for (size_type column = row; column < 3; ++column)
+					{
+						double rotatedMetric = 0.0;
+
+						for (size_type left = 0; left < 3; ++left)
+						{
+							for (size_type right = 0; right < 3; ++right)
+								rotatedMetric += static_cast<double>(rotation[left][row] * rotation[right][column]) * metricTensor[left][right];
+						}
 
+						if (((2.0 * tolerance * (basisLengths[row] + basisLengths[column])) + (tolerance * tolerance)) < std::abs(rotatedMetric - metricTensor[row][column]))
+						{
+							isLatticeSymmetry = false;
+							break;
+						}
+					}
+				}
+			}
+
+			if (isLatticeSymmetry)
+			{
+				const bool isIdentity = ChemToolkit::Crystallography::DelaunayReducer::isIdentity(rotation);
 
-					auto iter = numberAndEquivalentsDictionary.find(atomicNumber);
+				for (int index = 0; index < inputVariables.numAtoms; ++index)
+				{
+					if ((inputVariables.types[index] != referenceType) || (isIdentity && (index == referenceIndex)))
+						continue;
 
-					if (iter == numberAndEquivalentsDictionary.end())
-						numberAndEquivalentsDictionary.emplace(atomicNumber, std::vector<size_type>{ equivalentIndex });
 					else
 					{
-						bool isRegistered = false;
+						NumericalVector translation;
 						{
-							for (const auto registeredEquivalentIndex : iter->second)
+							for (size_type row = 0; row < 3; ++row)
 							{
-								if (registeredEquivalentIndex == equivalentIndex)
-								{
-									isRegistered = true;
-									break;
-								}
+								translation[row] = inputVariables.positions[index][row];
+
+								for (size_type column = 0; column < 3; ++column)
+									translation[row] -= static_cast<double>(rotation[row][column]) * inputVariables.positions[referenceIndex][column];
 							}
 						}
 
-						if (!isRegistered)
-							iter->second.push_back(equivalentIndex);
+						if (isSymmetryOperation(inputVariables, rotation, translation, axisTolerances))
+							return false;
 					}
 				}
 			}
-
-			for (const auto& numberAndEquivalents : numberAndEquivalentsDictionary)
-			{
-				for (size_type index = 0; index < numberAndEquivalents.second.size(); ++index)
-					equivalentAndLabelDictionary.emplace(numberAndEquivalents.second.at(index), (1 + index));
-			}
 		}
 
+		return true;
+	}
+}
 
-		for (int index = 0; index < outputVariables.numAtoms; ++index)
+bool SpaceGroupTypeSearcher::isSymmetryOperation(const SpglibInputVariables& inputVariables, const IntegerMatrix& rotation, const NumericalVector& translation, const NumericalVector& axisTolerances) const
+{
+	for (int index = 0; index < inputVariables.numAtoms; ++index)
+	{
+		NumericalVector transformedPosition;
 		{
-			AtomicNumber atomicNumber{ inputVariables.types[index] };
-			std::string siteLabel = atomicNumber.toElementSymbol();
-			siteLabel += std::to_string(equivalentAndLabelDictionary.at(static_cast<size_type>(spglibDatasetPtr->crystallographic_orbits[index])));
-
-			outputVariables.atomicNumbers.push_back(atomicNumber);
-			outputVariables.fractionalCoordinates.push_back(toNumericalVector(inputVariables.positions[index]));
-			outputVariables.siteLabels.push_back(siteLabel);
-			outputVariables.wyckoffSymbols.push_back(WyckoffSymbol{ spglibDatasetPtr->wyckoffs[index] });
-			outputVariables.siteSymmetrySymbols.push_back(SiteSymmetrySymbol{ spglibDatasetPtr->site_symmetry_symbols[index] });
+			for (size_type row = 0; row < 3; ++row)
+			{
+				transformedPosition[row] = translation[row];
+
+				for (size_type column = 0; column < 3; ++column)
+					transformedPosition[row] += static_cast<double>(rotation[row][column]) * inputVariables.positions[index][column];
+			}
 		}
 
+		bool isMapped = false;
+		{
+			for (int mappedIndex = 0; mappedIndex < inputVariables.numAtoms; ++mappedIndex)
+			{
+				if (inputVariables.types[mappedIndex] == inputVariables.types[index])
+				{
+					isMapped = true;
 
-		spg_free_dataset(spglibDatasetPtr);
-		return outputVariables;
-	}
+					for (size_type row = 0; row < 3; ++row)
+					{
+						const double difference = transformedPosition[row] - inputVariables.positions[mappedIndex][row];
 
+						if (axisTolerances[row] < std::abs(difference - std::round(difference)))
+						{
+							isMapped = false;
+							break;
+						}
+					}
 
-	catch (const System::ExceptionServices::IException& e)
-	{
-		std::cout << e.toString() << std::endl;
+					if (isMapped)
+						break;
+				}
+			}
+		}
 
-		spg_free_dataset(spglibDatasetPtr);
-		throw;
+		if (!isMapped)
+			return false;
 	}
 
-	catch (const std::exception& e)
-	{
-		std::cout << e.what() << std::endl;
-
-		spg_free_dataset(spglibDatasetPtr);
-		throw;
-	}
+	return true;
 }
 
-std::vector<SpaceGroupTypeSearcher::SymmetryOperation> SpaceGroupTypeSearcher::getSymmetryOperations(const SpglibInputVariables& inputVariables, const SpaceGroupNumber& spaceGroupNumber) const
+std::shared_ptr<const SpaceGroupTypeSearcher::SymmetryDataset> SpaceGroupTypeSearcher::getSymmetryDataset(const SpglibInputVariables& inputVariables) const
 {
-	SpglibDataset* spglibDatasetPtr = nullptr;
+	const std::string compositionKey = toCompositionKey(inputVariables);
+
+	size_type learnedToleranceLevel = 0;
 	{
-		double prec = s_defaultPrecision;
+		std::lock_guard<std::mutex> guard{ s_toleranceMutex };
+		++s_numToleranceSearches;
 
-		for (size_type rep = 0; rep < 20; ++rep)
-		{
-			spglibDatasetPtr = spg_get_dataset(inputVariables.lattice, inputVariables.positions.get(), inputVariables.types.get(), inputVariables.numAtoms, prec);
+		auto iter = s_learnedToleranceLevels.find(compositionKey);
 
+		if (!(iter == s_learnedToleranceLevels.end()))
+			learnedToleranceLevel = iter->second;
+	}
 
-			if (spglibDatasetPtr == nullptr)
-				prec *= 0.8;
+	// A learned level is accepted only if the next larger tolerance fails and the next smaller one finds the same space group.
+	if ((minLearnedToleranceLevel() <= learnedToleranceLevel) && ((learnedToleranceLevel + 1) < maxToleranceLevel()))
+	{
+		if (trySymmetryDataset(inputVariables, learnedToleranceLevel - 1) == nullptr)
+		{
+			std::shared_ptr<const SymmetryDataset> symmetryDataset = trySymmetryDataset(inputVariables, learnedToleranceLevel);
 
-			else
+			if (!(symmetryDataset == nullptr))
 			{
-				if (SpaceGroupNumber{ spglibDatasetPtr->spacegroup_number } == spaceGroupNumber)
-					break;
-				else
-					prec *= 0.8;
-			}
-		}
+				std::shared_ptr<const SymmetryDataset> confirmingDataset = trySymmetryDataset(inputVariables, learnedToleranceLevel + 1);
 
-		if (spglibDatasetPtr == nullptr)
-		{
-			spg_free_dataset(spglibDatasetPtr);
-			throw System::ExceptionServices::ApplicationException{ typeid(*this), "getDataset", "Could not obtain \"spglibDataset\"." };
+				if (!(confirmingDataset == nullptr) && (confirmingDataset->spaceGroupNumber == symmetryDataset->spaceGroupNumber))
+				{
+					std::lock_guard<std::mutex> guard{ s_toleranceMutex };
+					s_numLadderTrials += (learnedToleranceLevel + 1);
+
+					return symmetryDataset;
+				}
+			}
 		}
 	}
 
 
-	try
+	// spglib success is not monotonic in the tolerance, so the fallback tries every level in order and keeps the largest succeeding tolerance.
+	for (size_type toleranceLevel = 0; toleranceLevel < maxToleranceLevel(); ++toleranceLevel)
 	{
-		if (SpaceGroupNumber{ spglibDatasetPtr->spacegroup_number } == spaceGroupNumber)
-		{
-			std::vector<SymmetryOperation> symmetryOperations;
-			{
-				for (size_type index = 0; index < spglibDatasetPtr->n_operations; ++index)
-					symmetryOperations.push_back(SymmetryOperation{ toNumericalMatrix(spglibDatasetPtr->rotations[index]), toNumericalVector(spglibDatasetPtr->translations[index]) });
-			}
+		std::shared_ptr<const SymmetryDataset> symmetryDataset = trySymmetryDataset(inputVariables, toleranceLevel);
 
+		if (!(symmetryDataset == nullptr))
+		{
+			std::lock_guard<std::mutex> guard{ s_toleranceMutex };
+			s_numLadderTrials += (toleranceLevel + 1);
+			s_learnedToleranceLevels.insert_or_assign(compositionKey, toleranceLevel);
 
-			spg_free_dataset(spglibDatasetPtr);
-			return symmetryOperations;
+			return symmetryDataset;
 		}
-
-		else
-			throw System::ExceptionServices::ApplicationException{ typeid(*this), "getDataset", "Could not find the argument space group number." };
 	}
 
+	throw System::ExceptionServices::ApplicationException{ typeid(*this), "getDataset", "Could not obtain \"spglibDataset\"." };
+}
 
-	catch (const System::ExceptionServices::IException& e)
+std::shared_ptr<const SpaceGroupTypeSearcher::SymmetryDataset> SpaceGroupTypeSearcher::trySymmetryDataset(const SpglibInputVariables& inputVariables, const size_type toleranceLevel) const
+{
 	{
-		std::cout << e.toString() << std::endl;
-
-		spg_free_dataset(spglibDatasetPtr);
-		throw;
+		std::lock_guard<std::mutex> guard{ s_toleranceMutex };
+		++s_numToleranceTrials;
 	}
 
-	catch (const std::exception& e)
+	double prec = _precision;
 	{
-		std::cout << e.what() << std::endl;
-
-		spg_free_dataset(spglibDatasetPtr);
-		throw;
+		for (size_type level = 0; level < toleranceLevel; ++level)
+			prec *= toleranceScale();
 	}
+
+	return SymmetryDatasetCache::getSymmetryDataset(inputVariables.lattice, inputVariables.positions.get(), inputVariables.types.get(), inputVariables.numAtoms, prec);
 }
 
 // Private methods
@@ -518,6 +690,7 @@ SpaceGroupTypeSearcher::SpglibInputVariables SpaceGroupTypeSearcher::toSpglibInp
 	SpglibInputVariables spglibInputVariables;
 	{
 		spglibInputVariables.numAtoms = static_cast<int>(outputVariables.numAtoms);
+		spglibInputVariables.capacity = 4 * spglibInputVariables.numAtoms;
 
 		spglibInputVariables.lattice[0][0] = outputVariables.unitCell.basisVectors()(0, 0);
 		spglibInputVariables.lattice[0][1] = outputVariables.unitCell.basisVectors()(0, 1);
@@ -530,14 +703,14 @@ SpaceGroupTypeSearcher::SpglibInputVariables SpaceGroupTypeSearcher::toSpglibInp
 		spglibInputVariables.lattice[2][2] = outputVariables.unitCell.basisVectors()(2, 2);
 
 
-		spglibInputVariables.types = std::unique_ptr<int[]>{ new int[4 * spglibInputVariables.numAtoms] };
+		spglibInputVariables.types = std::unique_ptr<int[]>{ new int[spglibInputVariables.capacity] };
 		{
 			for (int index = 0; index < spglibInputVariables.numAtoms; ++index)
 				spglibInputVariables.types[index] = static_cast<int>(outputVariables.atomicNumbers.at(index));
 		}
 
 
-		spglibInputVariables.positions = std::unique_ptr<double[][3]>{ new double[4 * spglibInputVariables.numAtoms][3] };
+		spglibInputVariables.positions = std::unique_ptr<double[][3]>{ new double[spglibInputVariables.capacity][3] };
 		{
 			for (int index = 0; index < spglibInputVariables.numAtoms; ++index)
 			{
@@ -551,6 +724,159 @@ SpaceGroupTypeSearcher::SpglibInputVariables SpaceGroupTypeSearcher::toSpglibInp
 	return spglibInputVariables;
 }
 
+std::vector<SpaceGroupTypeSearcher::IntegerMatrix> SpaceGroupTypeSearcher::getUnimodularMatrices()
+{
+	std::vector<IntegerMatrix> unimodularMatrices;
+	{
+		for (int code = 0; code < 19683; ++code)
+		{
+			IntegerMatrix matrix;
+			{
+				int remainder = code;
+
+				for (size_type row = 0; row < 3; ++row)
+				{
+					for (size_type column = 0; column < 3; ++column)
+					{
+						matrix[row][column] = (remainder % 3) - 1;
+						remainder /= 3;
+					}
+				}
+			}
+
+			const int determinant = (matrix[0][0] * ((matrix[1][1] * matrix[2][2]) - (matrix[1][2] * matrix[2][1])))
+				- (matrix[0][1] * ((matrix[1][0] * matrix[2][2]) - (matrix[1][2] * matrix[2][0])))
+				+ (matrix[0][2] * ((matrix[1][0] * matrix[2][1]) - (matrix[1][1] * matrix[2][0])));
+
+			if (std::abs(determinant) == 1)
+				unimodularMatrices.push_back(matrix);
+		}
+	}
+
+	return unimodularMatrices;
+}
+
+SpaceGroupTypeSearcher::SpglibInputVariables& SpaceGroupTypeSearcher::getThreadWorkspace()
+{
+	// Each thread keeps its marshaling buffers across structures, so they only grow to the largest cell it has seen.
+	thread_local SpglibInputVariables s_workspace;
+	return s_workspace;
+}
+
+void SpaceGroupTypeSearcher::removeEquivalentAtoms(SpglibOutputVariables& outputVariables, const UnitCell& prevUnitCell) const
+{
+	const NumericalMatrix inverseBasisVectors = outputVariables.unitCell.getInverseBasisVectors();
+
+	std::vector<NumericalVector> originalFractionalCoordinates;
+	{
+		originalFractionalCoordinates.reserve(outputVariables.fractionalCoordinates.size());
+
+		for (const auto& fractionalCoordinate : outputVariables.fractionalCoordinates)
+		{
+			NumericalVector originalFractionalCoordinate = inverseBasisVectors * (prevUnitCell.basisVectors() * fractionalCoordinate);
+			{
+				int floorValueA = static_cast<int>(std::floor(originalFractionalCoordinate[0]));
+				int floorValueB = static_cast<int>(std::floor(originalFractionalCoordinate[1]));
+				int floorValueC = static_cast<int>(std::floor(originalFractionalCoordinate[2]));
+
+				if (floorValueA != 0)
+					originalFractionalCoordinate[0] -= static_cast<double>(floorValueA);
+				if (floorValueB != 0)
+					originalFractionalCoordinate[1] -= static_cast<double>(floorValueB);
+				if (floorValueC != 0)
+					originalFractionalCoordinate[2] -= static_cast<double>(floorValueC);
+			}
+
+			originalFractionalCoordinates.push_back(std::move(originalFractionalCoordinate));
+		}
+	}
+
+
+	const std::vector<size_type> uniqueIndices = getUniqueAtomIndices(outputVariables.unitCell, outputVariables.atomicNumbers, originalFractionalCoordinates);
+
+	std::vector<AtomicNumber> atomicNumbers;
+	std::vector<NumericalVector> fractionalCoordinates;
+	std::vector<std::string> siteLabels;
+	std::vector<WyckoffSymbol> wyckoffSymbols;
+	std::vector<SiteSymmetrySymbol> siteSymmetrySymbols;
+	std::vector<size_type> mappingToInputIndices;
+	{
+		for (const auto& index : uniqueIndices)
+		{
+			atomicNumbers.push_back(outputVariables.atomicNumbers.at(index));
+			fractionalCoordinates.push_back(std::move(originalFractionalCoordinates.at(index)));
+			siteLabels.push_back(outputVariables.siteLabels.at(index));
+			wyckoffSymbols.push_back(outputVariables.wyckoffSymbols.at(index));
+			siteSymmetrySymbols.push_back(outputVariables.siteSymmetrySymbols.at(index));
+			mappingToInputIndices.push_back(outputVariables.mappingToInputIndices.at(index));
+		}
+	}
+
+
+	outputVariables.numAtoms = static_cast<size_type>(atomicNumbers.size());
+	outputVariables.atomicNumbers = std::move(atomicNumbers);
+	outputVariables.fractionalCoordinates = std::move(fractionalCoordinates);
+	outputVariables.siteLabels = std::move(siteLabels);
+	outputVariables.wyckoffSymbols = std::move(wyckoffSymbols);
+	outputVariables.siteSymmetrySymbols = std::move(siteSymmetrySymbols);
+	outputVariables.mappingToInputIndices = std::move(mappingToInputIndices);
+}
+
+bool SpaceGroupTypeSearcher::isSameFractionalCoordinate(const UnitCell& unitCell, const NumericalVector& fractionalCoordinateA, const NumericalVector& fractionalCoordinateB, const double distanceRange)
+{
+	for (int indexA = (-1); indexA < 2; ++indexA)
+	{
+		for (int indexB = (-1); indexB < 2; ++indexB)
+		{
+			for (int indexC = (-1); indexC < 2; ++indexC)
+			{
+				NumericalVector translatedFractionalCoordinate = fractionalCoordinateB;
+				{
+					translatedFractionalCoordinate[0] += static_cast<double>(indexA);
+					translatedFractionalCoordinate[1] += static_cast<double>(indexB);
+					translatedFractionalCoordinate[2] += static_cast<double>(indexC);
+				}
+
+				NumericalVector displacement = unitCell.basisVectors() * (fractionalCoordinateA - translatedFractionalCoordinate);
+
+				if (displacement.normSquare() < (distanceRange * distanceRange))
+					return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+std::string SpaceGroupTypeSearcher::toCompositionKey(const SpglibInputVariables& inputVariables)
+{
+	std::map<int, int> typeAndCount;
+	{
+		for (int index = 0; index < inputVariables.numAtoms; ++index)
+			++typeAndCount[inputVariables.types[index]];
+	}
+
+	int divisor = 0;
+	{
+		for (const auto& [type, count] : typeAndCount)
+			divisor = std::gcd(divisor, count);
+	}
+
+
+	std::string compositionKey;
+	{
+		for (const auto& [type, count] : typeAndCount)
+		{
+			compositionKey += std::to_string(type);
+			compositionKey += ':';
+			compositionKey += std::to_string(count / divisor);
+			compositionKey += ' ';
+		}
+	}
+
+	return compositionKey;
+}
+
 // Private utility
 // **********************************************************************************************************************************************************************************************************************************************************************************************
 // **********************************************************************************************************************************************************************************************************************************************************************************************
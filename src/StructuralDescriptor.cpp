@@ -0,0 +1,194 @@
+#include "StructuralDescriptor.h"
+
+#include <cmath>
+#include <sstream>
+
+#include "InvalidFileException.h"
+#include "StreamWriter.h"
+
+using namespace MathematicalCrystalChemistry::CrystalModel::Components;
+
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Constructors
+
+StructuralDescriptor::StructuralDescriptor() noexcept
+	: _atomicNumbers{}
+	, _values{}
+	, _norm{ 0.0 }
+{
+}
+
+StructuralDescriptor::StructuralDescriptor(const std::vector<AtomicNumber>& atomicNumbers, std::vector<double>&& values)
+	: _atomicNumbers{ atomicNumbers }
+	, _values{ std::move(values) }
+	, _norm{ getNorm(_values) }
+{
+}
+
+StructuralDescriptor::StructuralDescriptor(const std::string& descriptorTexts)
+	: _atomicNumbers{}
+	, _values{}
+	, _norm{ 0.0 }
+{
+	std::istringstream inputStream{ descriptorTexts };
+	{
+		std::string label;
+		size_type numAtomicNumbers = 0;
+
+		if (!(inputStream >> label >> numAtomicNumbers) || !(label == "Atomic.Numbers"))
+			throw System::IO::InvalidFileException{ typeid(*this), "constructor", "Could not read Atomic.Numbers." };
+
+		for (size_type index = 0; index < numAtomicNumbers; ++index)
+		{
+			int atomicNumber = 0;
+
+			if (inputStream >> atomicNumber)
+				_atomicNumbers.push_back(AtomicNumber{ atomicNumber });
+			else
+				throw System::IO::InvalidFileException{ typeid(*this), "constructor", "The number of atomic numbers is insufficient." };
+		}
+	}
+	{
+		std::string label;
+		size_type numValues = 0;
+
+		if (!(inputStream >> label >> numValues) || !(label == "Descriptor.Values"))
+			throw System::IO::InvalidFileException{ typeid(*this), "constructor", "Could not read Descriptor.Values." };
+
+		_values.reserve(numValues);
+
+		for (size_type index = 0; index < numValues; ++index)
+		{
+			double value = 0.0;
+
+			if (inputStream >> value)
+				_values.push_back(value);
+			else
+				throw System::IO::InvalidFileException{ typeid(*this), "constructor", "The number of descriptor values is insufficient." };
+		}
+	}
+
+	_norm = getNorm(_values);
+}
+
+// Constructors
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Methods
+
+double StructuralDescriptor::getSimilarity(const StructuralDescriptor& structuralDescriptor) const noexcept
+{
+	if (!(isComparable(structuralDescriptor)) || !(0.0 < _norm) || !(0.0 < structuralDescriptor._norm))
+		return 0.0;
+
+	else
+	{
+		double innerProduct = 0.0;
+		{
+			for (size_type index = 0; index < _values.size(); ++index)
+				innerProduct += (_values[index] * structuralDescriptor._values[index]);
+		}
+
+		return (innerProduct / (_norm * structuralDescriptor._norm));
+	}
+}
+
+// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Utility
+
+std::string StructuralDescriptor::toString() const
+{
+	System::IO::StreamWriter streamWriter;
+	{
+		streamWriter.write("Atomic.Numbers\t");
+		streamWriter.write(_atomicNumbers.size());
+		{
+			for (const auto& atomicNumber : _atomicNumbers)
+			{
+				streamWriter.write(" ");
+				streamWriter.write(static_cast<int>(static_cast<unsigned short>(atomicNumber)));
+			}
+		}
+		streamWriter.breakLine();
+
+		streamWriter.write("Descriptor.Values\t");
+		streamWriter.write(_values.size());
+		{
+			for (const auto& value : _values)
+			{
+				streamWriter.write(" ");
+				streamWriter.write(value, 10);
+			}
+		}
+		streamWriter.breakLine();
+	}
+
+	return streamWriter.allTexts();
+}
+
+// Utility
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+double StructuralDescriptor::getNorm(const std::vector<double>& values) noexcept
+{
+	double normSquare = 0.0;
+	{
+		for (const auto& value : values)
+			normSquare += (value * value);
+	}
+
+	return std::sqrt(normSquare);
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
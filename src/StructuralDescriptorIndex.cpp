@@ -0,0 +1,198 @@
+#include "StructuralDescriptorIndex.h"
+
+#include <algorithm>
+#include <random>
+
+#include "ArgumentOutOfRangeException.h"
+
+using namespace MathematicalCrystalChemistry::CrystalModel::Components;
+
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Constructors
+
+StructuralDescriptorIndex::size_type StructuralDescriptorIndex::s_defaultNumHashTables{ 8 };
+StructuralDescriptorIndex::size_type StructuralDescriptorIndex::s_defaultNumHashBits{ 12 };
+
+
+
+StructuralDescriptorIndex::StructuralDescriptorIndex() noexcept
+	: _numHashTables{ s_defaultNumHashTables }
+	, _numHashBits{ s_defaultNumHashBits }
+	, _descriptors{}
+	, _dimensionAndHyperplanes{}
+	, _hashTables(s_defaultNumHashTables)
+{
+}
+
+StructuralDescriptorIndex::StructuralDescriptorIndex(const size_type numHashTables, const size_type numHashBits)
+	: _numHashTables{ numHashTables }
+	, _numHashBits{ numHashBits }
+	, _descriptors{}
+	, _dimensionAndHyperplanes{}
+	, _hashTables(numHashTables)
+{
+	if (0 == numHashTables)
+		throw System::ExceptionServices::ArgumentOutOfRangeException{ typeid(*this), "constructor", "The number of hash tables is zero." };
+
+	if ((0 == numHashBits) || (32 < numHashBits))
+		throw System::ExceptionServices::ArgumentOutOfRangeException{ typeid(*this), "constructor", "The number of hash bits is out of range." };
+}
+
+// Constructors
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Methods
+
+void StructuralDescriptorIndex::clear() noexcept
+{
+	_descriptors.clear();
+	_dimensionAndHyperplanes.clear();
+
+	for (auto& hashTable : _hashTables)
+		hashTable.clear();
+}
+
+StructuralDescriptorIndex::size_type StructuralDescriptorIndex::insert(const StructuralDescriptor& structuralDescriptor)
+{
+	const Hyperplanes& hyperplanes = getHyperplanes(structuralDescriptor.dimension());
+	const size_type descriptorIndex = _descriptors.size();
+
+	for (size_type tableIndex = 0; tableIndex < _numHashTables; ++tableIndex)
+		_hashTables[tableIndex][toBucketKey(structuralDescriptor, hyperplanes, tableIndex)].push_back(descriptorIndex);
+
+	_descriptors.push_back(structuralDescriptor);
+
+	return descriptorIndex;
+}
+
+std::pair<bool, StructuralDescriptorIndex::size_type> StructuralDescriptorIndex::findMostSimilar(const StructuralDescriptor& structuralDescriptor, const double similarityThreshold) const
+{
+	auto hyperplanesIter = _dimensionAndHyperplanes.find(structuralDescriptor.dimension());
+
+	if (hyperplanesIter == _dimensionAndHyperplanes.end())
+		return std::make_pair(false, 0);
+
+
+	std::vector<size_type> candidateIndices;
+	{
+		for (size_type tableIndex = 0; tableIndex < _numHashTables; ++tableIndex)
+		{
+			auto bucketIter = _hashTables[tableIndex].find(toBucketKey(structuralDescriptor, hyperplanesIter->second, tableIndex));
+
+			if (!(bucketIter == _hashTables[tableIndex].end()))
+				candidateIndices.insert(candidateIndices.end(), bucketIter->second.begin(), bucketIter->second.end());
+		}
+
+		std::sort(candidateIndices.begin(), candidateIndices.end());
+		candidateIndices.erase(std::unique(candidateIndices.begin(), candidateIndices.end()), candidateIndices.end());
+	}
+
+	bool isFound = false;
+	size_type mostSimilarIndex = 0;
+	double maxSimilarity = similarityThreshold;
+	{
+		for (const auto& candidateIndex : candidateIndices)
+		{
+			const double similarity = _descriptors[candidateIndex].getSimilarity(structuralDescriptor);
+
+			if (maxSimilarity <= similarity)
+			{
+				isFound = true;
+				mostSimilarIndex = candidateIndex;
+				maxSimilarity = similarity;
+			}
+		}
+	}
+
+	return std::make_pair(isFound, mostSimilarIndex);
+}
+
+// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+const StructuralDescriptorIndex::Hyperplanes& StructuralDescriptorIndex::getHyperplanes(const size_type dimension)
+{
+	auto iter = _dimensionAndHyperplanes.find(dimension);
+
+	if (!(iter == _dimensionAndHyperplanes.end()))
+		return iter->second;
+
+	else
+	{
+		std::mt19937_64 randomEngine{ static_cast<std::uint64_t>(dimension) };
+		std::normal_distribution<double> normalDistribution{ 0.0, 1.0 };
+
+		Hyperplanes hyperplanes(_numHashTables * _numHashBits, std::vector<double>(dimension, 0.0));
+		{
+			for (auto& hyperplane : hyperplanes)
+			{
+				for (auto& component : hyperplane)
+					component = normalDistribution(randomEngine);
+			}
+		}
+
+		return _dimensionAndHyperplanes.emplace(dimension, std::move(hyperplanes)).first->second;
+	}
+}
+
+std::uint64_t StructuralDescriptorIndex::toBucketKey(const StructuralDescriptor& structuralDescriptor, const Hyperplanes& hyperplanes, const size_type tableIndex) const noexcept
+{
+	std::uint64_t signature = 0;
+	{
+		for (size_type bitIndex = 0; bitIndex < _numHashBits; ++bitIndex)
+		{
+			const std::vector<double>& hyperplane = hyperplanes[(tableIndex * _numHashBits) + bitIndex];
+
+			double innerProduct = 0.0;
+			{
+				for (size_type index = 0; index < hyperplane.size(); ++index)
+					innerProduct += (hyperplane[index] * structuralDescriptor.values()[index]);
+			}
+
+			if (0.0 <= innerProduct)
+				signature |= (static_cast<std::uint64_t>(1) << bitIndex);
+		}
+	}
+
+	return ((static_cast<std::uint64_t>(structuralDescriptor.dimension()) << 32) | signature);
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
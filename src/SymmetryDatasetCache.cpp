@@ -0,0 +1,282 @@
+#include "SymmetryDatasetCache.h"
+
+#include <iostream>
+#include <cmath>
+#include <cstring>
+
+#include "spglib.h"
+
+#include "IException.h"
+
+using namespace ChemToolkit::Crystallography::Symmetry;
+
+
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Constructors
+
+std::unordered_map<SymmetryDatasetCache::SymmetryDatasetKey, std::shared_ptr<const SymmetryDatasetCache::SymmetryDataset>, SymmetryDatasetCache::SymmetryDatasetKeyHasher> SymmetryDatasetCache::s_symmetryDatasets{};
+std::deque<SymmetryDatasetCache::SymmetryDatasetKey> SymmetryDatasetCache::s_insertionOrder{};
+SymmetryDatasetCache::size_type SymmetryDatasetCache::s_capacity{ 4096 };
+SymmetryDatasetCache::size_type SymmetryDatasetCache::s_numHits{ 0 };
+SymmetryDatasetCache::size_type SymmetryDatasetCache::s_numMisses{ 0 };
+std::mutex SymmetryDatasetCache::s_mutex{};
+
+// Constructors
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Methods
+
+void SymmetryDatasetCache::initialize() noexcept
+{
+	std::lock_guard<std::mutex> guard{ s_mutex };
+
+	s_symmetryDatasets.clear();
+	s_insertionOrder.clear();
+	s_numHits = 0;
+	s_numMisses = 0;
+}
+
+SymmetryDatasetCache::size_type SymmetryDatasetCache::capacity() noexcept
+{
+	std::lock_guard<std::mutex> guard{ s_mutex };
+	return s_capacity;
+}
+
+void SymmetryDatasetCache::setCapacity(const size_type val) noexcept
+{
+	std::lock_guard<std::mutex> guard{ s_mutex };
+	s_capacity = val;
+
+	while (s_capacity < s_insertionOrder.size())
+	{
+		s_symmetryDatasets.erase(s_insertionOrder.front());
+		s_insertionOrder.pop_front();
+	}
+}
+
+SymmetryDatasetCache::size_type SymmetryDatasetCache::countHits() noexcept
+{
+	std::lock_guard<std::mutex> guard{ s_mutex };
+	return s_numHits;
+}
+
+SymmetryDatasetCache::size_type SymmetryDatasetCache::countMisses() noexcept
+{
+	std::lock_guard<std::mutex> guard{ s_mutex };
+	return s_numMisses;
+}
+
+void SymmetryDatasetCache::initializeStatistics() noexcept
+{
+	std::lock_guard<std::mutex> guard{ s_mutex };
+
+	s_numHits = 0;
+	s_numMisses = 0;
+}
+
+std::shared_ptr<const SymmetryDatasetCache::SymmetryDataset> SymmetryDatasetCache::getSymmetryDataset(const double lattice[3][3], const double positions[][3], const int types[], const int numAtoms, const double precision)
+{
+	SymmetryDatasetKey symmetryDatasetKey = toSymmetryDatasetKey(lattice, positions, types, numAtoms, precision);
+	{
+		std::lock_guard<std::mutex> guard{ s_mutex };
+		auto iter = s_symmetryDatasets.find(symmetryDatasetKey);
+
+		if (!(iter == s_symmetryDatasets.end()))
+		{
+			++s_numHits;
+			return iter->second;
+		}
+
+		else
+			++s_numMisses;
+	}
+
+	std::shared_ptr<const SymmetryDataset> symmetryDataset = computeSymmetryDataset(lattice, positions, types, numAtoms, precision);
+	{
+		std::lock_guard<std::mutex> guard{ s_mutex };
+
+		if (0 < s_capacity)
+		{
+			if (s_symmetryDatasets.emplace(symmetryDatasetKey, symmetryDataset).second)
+			{
+				s_insertionOrder.push_back(std::move(symmetryDatasetKey));
+
+				if (s_capacity < s_insertionOrder.size())
+				{
+					s_symmetryDatasets.erase(s_insertionOrder.front());
+					s_insertionOrder.pop_front();
+				}
+			}
+		}
+	}
+
+	return symmetryDataset;
+}
+
+// Methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// Private methods
+
+SymmetryDatasetCache::SymmetryDatasetKey SymmetryDatasetCache::toSymmetryDatasetKey(const double lattice[3][3], const double positions[][3], const int types[], const int numAtoms, const double precision)
+{
+	constexpr double quantizationScale = 1.0e+10;
+
+	SymmetryDatasetKey symmetryDatasetKey;
+	{
+		symmetryDatasetKey.quantizedInputs.reserve(10 + (4 * static_cast<std::size_t>(numAtoms)));
+		{
+			std::int64_t precisionBits = 0;
+			std::memcpy(&precisionBits, &precision, sizeof(double));
+			symmetryDatasetKey.quantizedInputs.push_back(precisionBits);
+
+			for (int row = 0; row < 3; ++row)
+			{
+				for (int column = 0; column < 3; ++column)
+					symmetryDatasetKey.quantizedInputs.push_back(std::llround(lattice[row][column] * quantizationScale));
+			}
+
+			for (int index = 0; index < numAtoms; ++index)
+			{
+				symmetryDatasetKey.quantizedInputs.push_back(types[index]);
+				symmetryDatasetKey.quantizedInputs.push_back(std::llround(positions[index][0] * quantizationScale));
+				symmetryDatasetKey.quantizedInputs.push_back(std::llround(positions[index][1] * quantizationScale));
+				symmetryDatasetKey.quantizedInputs.push_back(std::llround(positions[index][2] * quantizationScale));
+			}
+		}
+
+		std::uint64_t hashCode = 14695981039346656037ULL;
+		{
+			for (const auto quantizedInput : symmetryDatasetKey.quantizedInputs)
+			{
+				hashCode ^= static_cast<std::uint64_t>(quantizedInput);
+				hashCode *= 1099511628211ULL;
+			}
+		}
+
+		symmetryDatasetKey.hashCode = static_cast<std::size_t>(hashCode);
+	}
+
+	return symmetryDatasetKey;
+}
+
+std::shared_ptr<const SymmetryDatasetCache::SymmetryDataset> SymmetryDatasetCache::computeSymmetryDataset(const double lattice[3][3], const double positions[][3], const int types[], const int numAtoms, const double precision)
+{
+	SpglibDataset* spglibDatasetPtr = spg_get_dataset(lattice, positions, types, numAtoms, precision);
+
+	if (spglibDatasetPtr == nullptr)
+		return nullptr;
+
+	else
+	{
+		try
+		{
+			auto symmetryDataset = std::make_shared<SymmetryDataset>();
+			{
+				symmetryDataset->spaceGroupNumber = SpaceGroupNumber{ spglibDatasetPtr->spacegroup_number };
+
+				for (int index = 0; index < spglibDatasetPtr->n_atoms; ++index)
+				{
+					symmetryDataset->mappingToPrimitive.push_back(spglibDatasetPtr->mapping_to_primitive[index]);
+					symmetryDataset->crystallographicOrbits.push_back(spglibDatasetPtr->crystallographic_orbits[index]);
+					symmetryDataset->wyckoffSymbols.push_back(WyckoffSymbol{ spglibDatasetPtr->wyckoffs[index] });
+					symmetryDataset->siteSymmetrySymbols.push_back(SiteSymmetrySymbol{ spglibDatasetPtr->site_symmetry_symbols[index] });
+				}
+
+				for (int row = 0; row < 3; ++row)
+				{
+					for (int column = 0; column < 3; ++column)
+						symmetryDataset->standardizedLattice(row, column) = spglibDatasetPtr->std_lattice[row][column];
+				}
+
+				for (int index = 0; index < spglibDatasetPtr->n_std_atoms; ++index)
+				{
+					NumericalVector standardizedPosition;
+					{
+						standardizedPosition[0] = spglibDatasetPtr->std_positions[index][0];
+						standardizedPosition[1] = spglibDatasetPtr->std_positions[index][1];
+						standardizedPosition[2] = spglibDatasetPtr->std_positions[index][2];
+					}
+
+					symmetryDataset->standardizedTypes.push_back(spglibDatasetPtr->std_types[index]);
+					symmetryDataset->standardizedPositions.push_back(standardizedPosition);
+					symmetryDataset->standardizedMappingToPrimitive.push_back(spglibDatasetPtr->std_mapping_to_primitive[index]);
+				}
+
+				for (int index = 0; index < spglibDatasetPtr->n_operations; ++index)
+				{
+					NumericalMatrix rotation;
+					NumericalVector translation;
+					{
+						for (int row = 0; row < 3; ++row)
+						{
+							for (int column = 0; column < 3; ++column)
+								rotation(row, column) = static_cast<double>(spglibDatasetPtr->rotations[index][row][column]);
+
+							translation[row] = spglibDatasetPtr->translations[index][row];
+						}
+					}
+
+					symmetryDataset->rotations.push_back(rotation);
+					symmetryDataset->translations.push_back(translation);
+				}
+			}
+
+			spg_free_dataset(spglibDatasetPtr);
+			return symmetryDataset;
+		}
+
+		catch (const System::ExceptionServices::IException& e)
+		{
+			std::cout << e.toString() << std::endl;
+
+			spg_free_dataset(spglibDatasetPtr);
+			throw;
+		}
+
+		catch (const std::exception& e)
+		{
+			std::cout << e.what() << std::endl;
+
+			spg_free_dataset(spglibDatasetPtr);
+			throw;
+		}
+	}
+}
+
+// Private methods
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************
+// **********************************************************************************************************************************************************************************************************************************************************************************************